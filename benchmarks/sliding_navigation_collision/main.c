@@ -0,0 +1,448 @@
+#define _GNU_SOURCE
+#include "../../src/sliding_navigation_collision.h"
+#include "../../src/sliding_navigation_collision_result.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define PATH_COUNT 7
+#define VARIANT_COUNT 256
+#define CALL_COUNT 4194304
+
+typedef struct {
+  int face_count;
+  int *face_vertex_counts;
+  int *face_vertex_offsets;
+  float *face_vertex_locations;
+  float *face_normals;
+  float *edge_exit_normals;
+  int *face_edge_neighbor_counts;
+} benchmark_mesh;
+
+typedef struct {
+  int count;
+  int *face_indices;
+  float *froms;
+  float *tos;
+} benchmark_calls;
+
+typedef struct {
+  int cycles;
+  int branches;
+  int branch_misses;
+} benchmark_counters;
+
+static int face_vertex_counts[] = {4};
+
+static int face_vertex_offsets[] = {0};
+
+static float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+};
+
+static float face_normals[] = {0.0f, 0.0f, 1.0f};
+
+static float edge_exit_normals[] = {
+    0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+};
+
+static int face_edge_neighbor_counts[] = {0, 0, 1, 0};
+
+static const char *const path_names[PATH_COUNT] = {
+    "none",
+    "surface",
+    "boundary edge",
+    "neighbor edge",
+    "equal surface distance",
+    "equal boundary distance",
+    "equal neighbor distance",
+};
+
+static const float path_froms[PATH_COUNT * 3] = {
+    0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f,  0.5f, 0.5f, 0.5f, 0.5f, 0.5f,
+    0.5f, 0.5f, 0.5f, -0.5f, 1.5f, 0.5f, 0.5f, 0.5f, 1.5f, 0.5f,
+};
+
+static const float path_tos[PATH_COUNT * 3] = {
+    0.6f, 0.4f, 0.3f, 0.6f, 0.5f, -0.5f, 1.5f, 0.5f, 0.5f, 0.5f, 1.5f,
+    0.5f, 0.6f, 0.5f, -0.5f, 1.5f, 0.6f, 0.5f, 0.6f, 1.5f, 0.5f,
+};
+
+static volatile float sink;
+
+static unsigned int random_state = 1u;
+
+static float jitter(void) {
+  random_state = random_state * 1664525u + 1013904223u;
+  return ((float)(random_state >> 8) / 16777216.0f - 0.5f) * 0.1f;
+}
+
+static int open_counter(const unsigned long long config) {
+#if defined(__linux__)
+  struct perf_event_attr attributes = {0};
+  attributes.type = PERF_TYPE_HARDWARE;
+  attributes.size = sizeof(attributes);
+  attributes.config = config;
+  attributes.disabled = 1;
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+  return (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+#else
+  (void)(config);
+  return -1;
+#endif
+}
+
+static void control_counter(const int counter, const int enable) {
+#if defined(__linux__)
+  if (counter >= 0) {
+    ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter, enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+  }
+#else
+  (void)(counter);
+  (void)(enable);
+#endif
+}
+
+static long long read_counter(const int counter) {
+#if defined(__linux__)
+  long long value;
+
+  if (counter >= 0 && read(counter, &value, sizeof(value)) == sizeof(value)) {
+    return value;
+  }
+#else
+  (void)(counter);
+#endif
+  return -1;
+}
+
+static void stop_counter(const int counter) {
+#if defined(__linux__)
+  if (counter >= 0) {
+    ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+  }
+#else
+  (void)(counter);
+#endif
+}
+
+static void measure(const char *const name, const benchmark_mesh *const mesh,
+                    const benchmark_calls *const calls,
+                    const benchmark_counters *const counters,
+                    const int call_count) {
+  int results[3] = {0, 0, 0};
+  float result_from[3];
+  float result_to[3];
+  int edge_index;
+
+  for (int index = 0; index < calls->count; index++) {
+    const int result = sliding_navigation_collision(
+        calls->froms + index * 3, calls->face_indices[index],
+        calls->tos + index * 3, mesh->face_vertex_counts,
+        mesh->face_vertex_offsets, mesh->face_vertex_locations,
+        mesh->face_normals, mesh->edge_exit_normals,
+        mesh->face_edge_neighbor_counts, result_from, result_to, &edge_index);
+    results[result]++;
+  }
+
+  control_counter(counters->cycles, 1);
+  control_counter(counters->branches, 1);
+  control_counter(counters->branch_misses, 1);
+
+  const clock_t start = clock();
+  float total = 0.0f;
+
+  for (int call = 0; call < call_count; call++) {
+    const int index = call % calls->count;
+
+    total += (float)sliding_navigation_collision(
+        calls->froms + index * 3, calls->face_indices[index],
+        calls->tos + index * 3, mesh->face_vertex_counts,
+        mesh->face_vertex_offsets, mesh->face_vertex_locations,
+        mesh->face_normals, mesh->edge_exit_normals,
+        mesh->face_edge_neighbor_counts, result_from, result_to, &edge_index);
+    total += result_to[0];
+  }
+
+  const clock_t end = clock();
+
+  stop_counter(counters->cycles);
+  stop_counter(counters->branches);
+  stop_counter(counters->branch_misses);
+
+  sink = total;
+
+  const long long cycles = read_counter(counters->cycles);
+  const long long branches = read_counter(counters->branches);
+  const long long branch_misses = read_counter(counters->branch_misses);
+
+  printf("%-24s %9.2f ns/call", name,
+         (double)(end - start) * 1.0e9 / CLOCKS_PER_SEC / call_count);
+
+  if (cycles >= 0) {
+    printf(" %9.2f cycles/call", (double)cycles / call_count);
+  } else {
+    printf(" %9s cycles/call", "n/a");
+  }
+
+  if (branches > 0 && branch_misses >= 0) {
+    printf(" %6.2f%% branch misses",
+           (double)branch_misses * 100.0 / branches);
+  } else {
+    printf(" %6s  branch misses", "n/a");
+  }
+
+  printf(" (none %d, surface %d, edge %d)\n",
+         results[SLIDING_NAVIGATION_COLLISION_RESULT_NONE],
+         results[SLIDING_NAVIGATION_COLLISION_RESULT_SURFACE],
+         results[SLIDING_NAVIGATION_COLLISION_RESULT_EDGE]);
+}
+
+static void fill_path(const int path, const int offset,
+                      benchmark_calls *const calls) {
+  for (int variant = 0; variant < VARIANT_COUNT; variant++) {
+    const int index = offset + variant;
+    const float x = jitter();
+    const float y = jitter();
+
+    calls->face_indices[index] = 0;
+    calls->froms[index * 3] = path_froms[path * 3] + x;
+    calls->froms[index * 3 + 1] = path_froms[path * 3 + 1] + y;
+    calls->froms[index * 3 + 2] = path_froms[path * 3 + 2];
+    calls->tos[index * 3] = path_tos[path * 3] + x;
+    calls->tos[index * 3 + 1] = path_tos[path * 3 + 1] + y;
+    calls->tos[index * 3 + 2] = path_tos[path * 3 + 2];
+  }
+}
+
+static int synthetic(const benchmark_counters *const counters) {
+  const benchmark_mesh mesh = {
+      1,
+      face_vertex_counts,
+      face_vertex_offsets,
+      face_vertex_locations,
+      face_normals,
+      edge_exit_normals,
+      face_edge_neighbor_counts,
+  };
+
+  int face_indices[VARIANT_COUNT * PATH_COUNT];
+  float froms[VARIANT_COUNT * PATH_COUNT * 3];
+  float tos[VARIANT_COUNT * PATH_COUNT * 3];
+
+  for (int path = 0; path < PATH_COUNT; path++) {
+    benchmark_calls single = {VARIANT_COUNT, face_indices, froms, tos};
+    fill_path(path, 0, &single);
+    measure(path_names[path], &mesh, &single, counters, CALL_COUNT);
+  }
+
+  benchmark_calls mixed = {VARIANT_COUNT * PATH_COUNT, face_indices, froms,
+                           tos};
+
+  for (int path = 0; path < PATH_COUNT; path++) {
+    fill_path(path, VARIANT_COUNT * path, &mixed);
+  }
+
+  for (int index = mixed.count - 1; index > 0; index--) {
+    random_state = random_state * 1664525u + 1013904223u;
+    const int other = (int)((random_state >> 8) % (unsigned int)(index + 1));
+
+    for (int component = 0; component < 3; component++) {
+      const float from = froms[index * 3 + component];
+      froms[index * 3 + component] = froms[other * 3 + component];
+      froms[other * 3 + component] = from;
+
+      const float to = tos[index * 3 + component];
+      tos[index * 3 + component] = tos[other * 3 + component];
+      tos[other * 3 + component] = to;
+    }
+  }
+
+  measure("mixed", &mesh, &mixed, counters, CALL_COUNT);
+  return 0;
+}
+
+static int read_ints(FILE *const file, int *const values, const int count) {
+  for (int index = 0; index < count; index++) {
+    if (fscanf(file, "%d", values + index) != 1) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int read_floats(FILE *const file, float *const values,
+                       const int count) {
+  for (int index = 0; index < count; index++) {
+    if (fscanf(file, "%f", values + index) != 1) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int replay(const char *const path,
+                  const benchmark_counters *const counters) {
+  FILE *const file = fopen(path, "r");
+
+  if (file == NULL) {
+    fprintf(stderr, "Unable to open trace \"%s\".\n", path);
+    return 1;
+  }
+
+  benchmark_mesh mesh = {0, NULL, NULL, NULL, NULL, NULL, NULL};
+  benchmark_calls calls = {0, NULL, NULL, NULL};
+  int output = 1;
+  int vertex_capacity = 0;
+
+  if (!read_ints(file, &mesh.face_count, 1) || mesh.face_count <= 0) {
+    goto cleanup;
+  }
+
+  mesh.face_vertex_counts = malloc(sizeof(int) * mesh.face_count);
+  mesh.face_vertex_offsets = malloc(sizeof(int) * mesh.face_count);
+  mesh.face_normals = malloc(sizeof(float) * mesh.face_count * 3);
+
+  if (mesh.face_vertex_counts == NULL || mesh.face_vertex_offsets == NULL ||
+      mesh.face_normals == NULL) {
+    goto cleanup;
+  }
+
+  int vertex_count = 0;
+
+  for (int face_index = 0; face_index < mesh.face_count; face_index++) {
+    int relevant_vertex_count;
+
+    if (!read_ints(file, &relevant_vertex_count, 1) ||
+        relevant_vertex_count < 3 ||
+        !read_floats(file, mesh.face_normals + face_index * 3, 3)) {
+      goto cleanup;
+    }
+
+    mesh.face_vertex_counts[face_index] = relevant_vertex_count;
+    mesh.face_vertex_offsets[face_index] = vertex_count;
+
+    if (vertex_count + relevant_vertex_count > vertex_capacity) {
+      vertex_capacity = (vertex_count + relevant_vertex_count) * 2;
+
+      float *const locations = realloc(mesh.face_vertex_locations,
+                                       sizeof(float) * vertex_capacity * 3);
+
+      if (locations == NULL) {
+        goto cleanup;
+      }
+
+      mesh.face_vertex_locations = locations;
+
+      float *const normals =
+          realloc(mesh.edge_exit_normals, sizeof(float) * vertex_capacity * 3);
+
+      if (normals == NULL) {
+        goto cleanup;
+      }
+
+      mesh.edge_exit_normals = normals;
+
+      int *const neighbor_counts = realloc(mesh.face_edge_neighbor_counts,
+                                           sizeof(int) * vertex_capacity);
+
+      if (neighbor_counts == NULL) {
+        goto cleanup;
+      }
+
+      mesh.face_edge_neighbor_counts = neighbor_counts;
+    }
+
+    for (int vertex_index = vertex_count;
+         vertex_index < vertex_count + relevant_vertex_count; vertex_index++) {
+      if (!read_floats(file, mesh.face_vertex_locations + vertex_index * 3,
+                       3) ||
+          !read_floats(file, mesh.edge_exit_normals + vertex_index * 3, 3) ||
+          !read_ints(file, mesh.face_edge_neighbor_counts + vertex_index, 1)) {
+        goto cleanup;
+      }
+    }
+
+    vertex_count += relevant_vertex_count;
+  }
+
+  if (!read_ints(file, &calls.count, 1) || calls.count <= 0) {
+    goto cleanup;
+  }
+
+  calls.face_indices = malloc(sizeof(int) * calls.count);
+  calls.froms = malloc(sizeof(float) * calls.count * 3);
+  calls.tos = malloc(sizeof(float) * calls.count * 3);
+
+  if (calls.face_indices == NULL || calls.froms == NULL || calls.tos == NULL) {
+    goto cleanup;
+  }
+
+  for (int index = 0; index < calls.count; index++) {
+    if (!read_ints(file, calls.face_indices + index, 1) ||
+        calls.face_indices[index] < 0 ||
+        calls.face_indices[index] >= mesh.face_count ||
+        !read_floats(file, calls.froms + index * 3, 3) ||
+        !read_floats(file, calls.tos + index * 3, 3)) {
+      goto cleanup;
+    }
+  }
+
+  measure(path, &mesh, &calls, counters,
+          calls.count > CALL_COUNT ? calls.count : CALL_COUNT);
+  output = 0;
+
+cleanup:
+  if (output != 0) {
+    fprintf(stderr, "Unable to read trace \"%s\".\n", path);
+  }
+
+  fclose(file);
+  free(mesh.face_vertex_counts);
+  free(mesh.face_vertex_offsets);
+  free(mesh.face_vertex_locations);
+  free(mesh.face_normals);
+  free(mesh.edge_exit_normals);
+  free(mesh.face_edge_neighbor_counts);
+  free(calls.face_indices);
+  free(calls.froms);
+  free(calls.tos);
+  return output;
+}
+
+int main(const int argc, const char *const *const argv) {
+  benchmark_counters counters;
+#if defined(__linux__)
+  counters.cycles = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+  counters.branches = open_counter(PERF_COUNT_HW_BRANCH_INSTRUCTIONS);
+  counters.branch_misses = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+#else
+  counters.cycles = open_counter(0);
+  counters.branches = open_counter(0);
+  counters.branch_misses = open_counter(0);
+#endif
+
+  int output = 0;
+
+  if (argc < 2) {
+    output = synthetic(&counters);
+  }
+
+  for (int index = 1; index < argc; index++) {
+    if (replay(argv[index], &counters) != 0) {
+      output = 1;
+    }
+  }
+
+  return output;
+}
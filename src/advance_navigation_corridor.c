@@ -0,0 +1,136 @@
+#include "advance_navigation_corridor.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static bool neighbors(const int face_index_a, const int face_index_b,
+                      const int *const face_vertex_counts,
+                      const int *const face_vertex_offsets,
+                      const int *const face_edge_neighbor_counts,
+                      const int *const face_edge_neighbor_offsets,
+                      const int *const face_edge_neighbor_face_indices) {
+  const int face_vertex_offset = face_vertex_offsets[face_index_a];
+  const int face_vertex_count = face_vertex_counts[face_index_a];
+
+  for (int edge_index = face_vertex_offset;
+       edge_index < face_vertex_offset + face_vertex_count; edge_index++) {
+    const int neighbor_offset = face_edge_neighbor_offsets[edge_index];
+    const int neighbor_count = face_edge_neighbor_counts[edge_index];
+
+    for (int neighbor_index = neighbor_offset;
+         neighbor_index < neighbor_offset + neighbor_count; neighbor_index++) {
+      if (face_edge_neighbor_face_indices[neighbor_index] == face_index_b) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+static int search(const int face_index, const int first_corridor_index,
+                  const int corridor_length,
+                  const int *const corridor_face_indices,
+                  const int *const face_vertex_counts,
+                  const int *const face_vertex_offsets,
+                  const int *const face_edge_neighbor_counts,
+                  const int *const face_edge_neighbor_offsets,
+                  const int *const face_edge_neighbor_face_indices) {
+  for (int corridor_index = first_corridor_index;
+       corridor_index < corridor_length; corridor_index++) {
+    if (neighbors(face_index, corridor_face_indices[corridor_index],
+                  face_vertex_counts, face_vertex_offsets,
+                  face_edge_neighbor_counts, face_edge_neighbor_offsets,
+                  face_edge_neighbor_face_indices)) {
+      return corridor_index;
+    }
+  }
+
+  return -1;
+}
+
+int advance_navigation_corridor(
+    const int face_index, const int lookahead,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, const int corridor_length,
+    const int maximum_corridor_length, int *const corridor_face_indices,
+    int *const corridor_link_indices) {
+  const int first_corridor_index =
+      corridor_length > lookahead ? corridor_length - lookahead : 0;
+
+  for (int corridor_index = first_corridor_index;
+       corridor_index < corridor_length; corridor_index++) {
+    if (corridor_face_indices[corridor_index] == face_index) {
+      return corridor_index + 1;
+    }
+  }
+
+  const int direct_corridor_index =
+      search(face_index, first_corridor_index, corridor_length,
+             corridor_face_indices, face_vertex_counts, face_vertex_offsets,
+             face_edge_neighbor_counts, face_edge_neighbor_offsets,
+             face_edge_neighbor_face_indices);
+
+  if (direct_corridor_index != -1) {
+    if (direct_corridor_index + 2 <= maximum_corridor_length) {
+      corridor_link_indices[direct_corridor_index] = -1;
+      corridor_face_indices[direct_corridor_index + 1] = face_index;
+      corridor_link_indices[direct_corridor_index + 1] = -1;
+    }
+
+    return direct_corridor_index + 2;
+  }
+
+  int best_corridor_index = corridor_length;
+  int best_face_index = -1;
+
+  const int face_vertex_offset = face_vertex_offsets[face_index];
+  const int face_vertex_count = face_vertex_counts[face_index];
+
+  for (int edge_index = face_vertex_offset;
+       edge_index < face_vertex_offset + face_vertex_count; edge_index++) {
+    const int neighbor_offset = face_edge_neighbor_offsets[edge_index];
+    const int neighbor_count = face_edge_neighbor_counts[edge_index];
+
+    for (int neighbor_index = neighbor_offset;
+         neighbor_index < neighbor_offset + neighbor_count; neighbor_index++) {
+      const int neighbor_face_index =
+          face_edge_neighbor_face_indices[neighbor_index];
+
+      if (face_flags != NULL &&
+          ((face_flags[neighbor_face_index] & include_flags) == 0 ||
+           (face_flags[neighbor_face_index] & exclude_flags) != 0)) {
+        continue;
+      }
+
+      const int corridor_index =
+          search(neighbor_face_index, first_corridor_index,
+                 best_corridor_index, corridor_face_indices,
+                 face_vertex_counts, face_vertex_offsets,
+                 face_edge_neighbor_counts, face_edge_neighbor_offsets,
+                 face_edge_neighbor_face_indices);
+
+      if (corridor_index != -1) {
+        best_corridor_index = corridor_index;
+        best_face_index = neighbor_face_index;
+      }
+    }
+  }
+
+  if (best_face_index == -1) {
+    return -1;
+  }
+
+  if (best_corridor_index + 3 <= maximum_corridor_length) {
+    corridor_link_indices[best_corridor_index] = -1;
+    corridor_face_indices[best_corridor_index + 1] = best_face_index;
+    corridor_link_indices[best_corridor_index + 1] = -1;
+    corridor_face_indices[best_corridor_index + 2] = face_index;
+    corridor_link_indices[best_corridor_index + 2] = -1;
+  }
+
+  return best_corridor_index + 3;
+}
@@ -0,0 +1,79 @@
+#ifndef ADVANCE_NAVIGATION_CORRIDOR_H
+
+#define ADVANCE_NAVIGATION_CORRIDOR_H
+
+/**
+ * Keeps a path corridor up to date as an agent moves across a navigation mesh,
+ * so that it does not need to be replanned every time the agent crosses an
+ * edge.  A corridor is the list of faces along a path stored in reverse (goal
+ * first, the face containing the agent last), so that both trimming faces
+ * which the agent has passed through and repairing the corridor around the
+ * agent only change its end.  When the agent's face is found among the last
+ * lookahead faces of the corridor, the faces after it are trimmed.  Otherwise,
+ * when the agent has slipped into a face neighboring one of those faces, or
+ * into a face neighboring such a neighbor, the faces after that face are
+ * replaced with the one or two faces leading to the agent's face.  Each call
+ * therefore does an amount of work bounded by lookahead and face valence
+ * rather than by the size of the navigation mesh or the length of the path.
+ * @param face_index The index of the face which now contains the agent (such as
+ *                   that returned by sliding_navigation_collision or
+ *                   closest_navigable_face).
+ * @param lookahead The number of faces at the end of the corridor which are
+ *                  searched for face_index or its neighbors.  Faces closer to
+ *                  the goal are preferred.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL if faces have no flags.
+ * @param include_flags Only faces with at least one of these flags are added to
+ *                      the corridor between the agent's face and the
+ *                      corridor, where face_flags is not NULL.
+ * @param exclude_flags Faces with any of these flags are not added to the
+ *                      corridor between the agent's face and the corridor,
+ *                      where face_flags is not NULL.
+ * @param corridor_length The number of faces in the corridor.
+ * @param maximum_corridor_length The number of faces which
+ *                                corridor_face_indices and
+ *                                corridor_link_indices have space for.
+ * @param corridor_face_indices The index of each face along the corridor,
+ *                              ending with the face which previously contained
+ *                              the agent (e.g. the result_face_indices of
+ *                              find_navigation_path, reversed).  Modified in
+ *                              place to end with face_index.  Not written at
+ *                              all when the return value exceeds
+ *                              maximum_corridor_length or is -1.
+ * @param corridor_link_indices The index of the link followed to enter each
+ *                              face along the corridor from the face after it,
+ *                              or -1 where the face was entered by crossing an
+ *                              edge (e.g. the result_link_indices of
+ *                              find_navigation_path, reversed).  Modified in
+ *                              place alongside corridor_face_indices.
+ * @return The number of faces in the updated corridor, which may exceed
+ *         maximum_corridor_length, or -1 if face_index could not be reconnected
+ *         to the corridor and the path should be replanned.
+ */
+int advance_navigation_corridor(
+    const int face_index, const int lookahead,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, const int corridor_length,
+    const int maximum_corridor_length, int *const corridor_face_indices,
+    int *const corridor_link_indices);
+
+#endif
@@ -0,0 +1,20 @@
+#include "allocate_navigation_scratch.h"
+#include <stddef.h>
+#include <stdint.h>
+
+void *allocate_navigation_scratch(unsigned char *const scratch,
+                                  const int scratch_capacity,
+                                  int *const scratch_used, const int size,
+                                  const int alignment) {
+  const uintptr_t address = (uintptr_t)(scratch + *scratch_used);
+  const int padding = (int)((alignment - address % (uintptr_t)alignment) %
+                            (uintptr_t)alignment);
+
+  if (size > scratch_capacity - *scratch_used - padding) {
+    return NULL;
+  }
+
+  unsigned char *const output = scratch + *scratch_used + padding;
+  *scratch_used += padding + size;
+  return output;
+}
@@ -0,0 +1,28 @@
+#ifndef ALLOCATE_NAVIGATION_SCRATCH_H
+
+#define ALLOCATE_NAVIGATION_SCRATCH_H
+
+/**
+ * Sub-allocates temporary storage from a block of caller-owned scratch
+ * memory, without ever calling malloc.  Allocations are made by advancing
+ * scratch_used; to release every allocation made since a point, store
+ * scratch_used as a mark before allocating and restore it afterward.  Giving
+ * each thread its own block avoids contention.
+ * @param scratch The block of memory from which to allocate.
+ * @param scratch_capacity The number of bytes in scratch.
+ * @param scratch_used The number of bytes of scratch allocated so far
+ *                     (including any padding used to meet alignment), which
+ *                     is advanced past the new allocation.  Unchanged when
+ *                     there is not enough space.
+ * @param size The number of bytes to allocate.
+ * @param alignment The alignment of the allocation, in bytes.  Behavior is
+ *                  undefined if this is not a power of two.
+ * @return The start of the allocation, or NULL should there not be enough
+ *         space remaining in scratch.
+ */
+void *allocate_navigation_scratch(unsigned char *const scratch,
+                                  const int scratch_capacity,
+                                  int *const scratch_used, const int size,
+                                  const int alignment);
+
+#endif
@@ -0,0 +1,27 @@
+#include "begin_navigation_path.h"
+
+void begin_navigation_path(
+    const float *const start_location, const int start_face_index,
+    const int face_count, float *const face_costs, float *const face_priorities,
+    float *const face_entry_locations, int *const face_parent_indices,
+    int *const face_parent_link_indices, int *const face_heap_positions,
+    int *const heap, int *const heap_count) {
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    face_heap_positions[face_index] = -1;
+  }
+
+  float *const relevant_face_entry_location =
+      face_entry_locations + start_face_index * 3;
+
+  relevant_face_entry_location[0] = start_location[0];
+  relevant_face_entry_location[1] = start_location[1];
+  relevant_face_entry_location[2] = start_location[2];
+
+  face_costs[start_face_index] = 0.0f;
+  face_priorities[start_face_index] = 0.0f;
+  face_parent_indices[start_face_index] = -1;
+  face_parent_link_indices[start_face_index] = -1;
+  face_heap_positions[start_face_index] = 0;
+  heap[0] = start_face_index;
+  *heap_count = 1;
+}
@@ -0,0 +1,41 @@
+#ifndef BEGIN_NAVIGATION_PATH_H
+
+#define BEGIN_NAVIGATION_PATH_H
+
+/**
+ * Begins a resumable search for a path between two faces of a navigation mesh
+ * (see find_navigation_path), which can then be advanced a limited number of
+ * iterations at a time using step_navigation_path and retrieved using
+ * finish_navigation_path.  All search state is kept in the given buffers,
+ * which must not be modified until the search is finished or abandoned.  As
+ * with find_navigation_path, the search is only guided toward the goal when
+ * off-mesh links are not considered, as a link may be a shortcut.
+ * @param start_location The 3D vector describing the location to find a path
+ *                       from.  Behavior is undefined if any component is NaN,
+ *                       infinity or negative infinity.
+ * @param start_face_index The index of the face containing start_location.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_costs Overwritten with search state.  Must have space for
+ *                   face_count values.
+ * @param face_priorities Overwritten with search state.  Must have space for
+ *                        face_count values.
+ * @param face_entry_locations Overwritten with search state.  Must have space
+ *                             for face_count 3D vectors.
+ * @param face_parent_indices Overwritten with search state.  Must have space
+ *                            for face_count values.
+ * @param face_parent_link_indices Overwritten with search state.  Must have
+ *                                 space for face_count values.
+ * @param face_heap_positions Overwritten with search state.  Must have space
+ *                            for face_count values.
+ * @param heap Overwritten with search state.  Must have space for face_count
+ *             values.
+ * @param heap_count Overwritten with search state.
+ */
+void begin_navigation_path(
+    const float *const start_location, const int start_face_index,
+    const int face_count, float *const face_costs, float *const face_priorities,
+    float *const face_entry_locations, int *const face_parent_indices,
+    int *const face_parent_link_indices, int *const face_heap_positions,
+    int *const heap, int *const heap_count);
+
+#endif
@@ -0,0 +1,441 @@
+#include "build_navigation_tile.h"
+#include "merge_navigable_faces.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static int floor_to_int(const float value) {
+  const int truncated = (int)value;
+  return value < (float)truncated ? truncated - 1 : truncated;
+}
+
+static int ceiling_to_int(const float value) {
+  const int truncated = (int)value;
+  return value > (float)truncated ? truncated + 1 : truncated;
+}
+
+static int clip_polygon(const int vertex_count,
+                        const float *const vertex_locations, const int axis,
+                        const float limit, const float sign,
+                        float *const clipped_vertex_locations) {
+  int clipped_vertex_count = 0;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float *const next_location = vertex_index == vertex_count - 1
+                                           ? vertex_locations
+                                           : relevant_location + 3;
+    const float relevant_distance = (relevant_location[axis] - limit) * sign;
+    const float next_distance = (next_location[axis] - limit) * sign;
+
+    if (relevant_distance >= 0.0f) {
+      float *const clipped_location =
+          clipped_vertex_locations + clipped_vertex_count * 3;
+
+      clipped_location[0] = relevant_location[0];
+      clipped_location[1] = relevant_location[1];
+      clipped_location[2] = relevant_location[2];
+      clipped_vertex_count++;
+    }
+
+    if ((relevant_distance < 0.0f && next_distance > 0.0f) ||
+        (relevant_distance > 0.0f && next_distance < 0.0f)) {
+      const float progress =
+          relevant_distance / (relevant_distance - next_distance);
+      float *const clipped_location =
+          clipped_vertex_locations + clipped_vertex_count * 3;
+
+      clipped_location[0] =
+          relevant_location[0] +
+          (next_location[0] - relevant_location[0]) * progress;
+      clipped_location[1] =
+          relevant_location[1] +
+          (next_location[1] - relevant_location[1]) * progress;
+      clipped_location[2] =
+          relevant_location[2] +
+          (next_location[2] - relevant_location[2]) * progress;
+      clipped_vertex_count++;
+    }
+  }
+
+  return clipped_vertex_count;
+}
+
+static bool add_span(const int column_index, int bottom, int top,
+                     bool walkable, const int step_cells,
+                     int *const column_first_spans,
+                     const int maximum_span_count, int *const span_count,
+                     int *const free_span_index, int *const span_next_indices,
+                     int *const span_bottoms, int *const span_tops,
+                     int *const span_walkable) {
+  int previous_span_index = -1;
+  int relevant_span_index = column_first_spans[column_index];
+
+  while (relevant_span_index != -1 &&
+         span_bottoms[relevant_span_index] <= top) {
+    const int next_span_index = span_next_indices[relevant_span_index];
+
+    if (span_tops[relevant_span_index] < bottom) {
+      previous_span_index = relevant_span_index;
+    } else {
+      if (span_bottoms[relevant_span_index] < bottom) {
+        bottom = span_bottoms[relevant_span_index];
+      }
+
+      if (span_tops[relevant_span_index] - top > step_cells) {
+        walkable = span_walkable[relevant_span_index];
+      } else if (top - span_tops[relevant_span_index] <= step_cells &&
+                 span_walkable[relevant_span_index]) {
+        walkable = true;
+      }
+
+      if (span_tops[relevant_span_index] > top) {
+        top = span_tops[relevant_span_index];
+      }
+
+      if (previous_span_index == -1) {
+        column_first_spans[column_index] = next_span_index;
+      } else {
+        span_next_indices[previous_span_index] = next_span_index;
+      }
+
+      span_next_indices[relevant_span_index] = *free_span_index;
+      *free_span_index = relevant_span_index;
+    }
+
+    relevant_span_index = next_span_index;
+  }
+
+  int span_index;
+
+  if (*free_span_index != -1) {
+    span_index = *free_span_index;
+    *free_span_index = span_next_indices[span_index];
+  } else if (*span_count < maximum_span_count) {
+    span_index = *span_count;
+    (*span_count)++;
+  } else {
+    return false;
+  }
+
+  span_bottoms[span_index] = bottom;
+  span_tops[span_index] = top;
+  span_walkable[span_index] = walkable;
+  span_next_indices[span_index] = relevant_span_index;
+
+  if (previous_span_index == -1) {
+    column_first_spans[column_index] = span_index;
+  } else {
+    span_next_indices[previous_span_index] = span_index;
+  }
+
+  return true;
+}
+
+static bool has_clearance(const int floor, const int ceiling_span_index,
+                          const int clearance_cells,
+                          const int *const span_bottoms) {
+  return ceiling_span_index == -1 ||
+         span_bottoms[ceiling_span_index] - floor >= clearance_cells;
+}
+
+int build_navigation_tile(
+    const int triangle_count, const float *const triangle_vertex_locations,
+    const float *const tile_origin, const int column_count_x,
+    const int column_count_y, const float cell_size, const float cell_height,
+    const float walkable_slope_cosine, const float step_height,
+    const float agent_height, const int maximum_vertex_count,
+    int *const column_first_spans, const int maximum_span_count,
+    int *const span_next_indices, int *const span_bottoms, int *const span_tops,
+    int *const span_walkable, int *const span_face_indices,
+    const int maximum_cell_face_count, const int maximum_cell_neighbor_count,
+    int *const cell_face_vertex_counts, int *const cell_face_vertex_offsets,
+    float *const cell_face_vertex_locations, float *const cell_face_normals,
+    int *const cell_face_edge_neighbor_counts,
+    int *const cell_face_edge_neighbor_offsets,
+    int *const cell_face_edge_neighbor_face_indices, int *const face_groups,
+    int *const face_next_members, int *const group_vertex_counts,
+    float *const group_vertex_locations,
+    int *const cell_face_merged_face_indices, int *const face_vertex_counts,
+    int *const face_vertex_offsets, float *const face_vertex_locations,
+    float *const face_normals, float *const edge_normals,
+    float *const edge_exit_normals, float *const edge_coefficients,
+    float *const vertex_up_normals, int *const face_edge_neighbor_counts,
+    int *const face_edge_neighbor_offsets,
+    int *const face_edge_neighbor_face_indices, int *const cell_face_count,
+    int *const cell_neighbor_count) {
+  const int column_count = column_count_x * column_count_y;
+  const int step_cells = floor_to_int(step_height / cell_height);
+  const int clearance_cells = ceiling_to_int(agent_height / cell_height);
+  const int column_offsets_x[] = {0, 1, 0, -1};
+  const int column_offsets_y[] = {-1, 0, 1, 0};
+  int span_count = 0;
+  int free_span_index = -1;
+
+  for (int column_index = 0; column_index < column_count; column_index++) {
+    column_first_spans[column_index] = -1;
+  }
+
+  for (int triangle_index = 0; triangle_index < triangle_count;
+       triangle_index++) {
+    const float *const relevant_triangle_vertex_locations =
+        triangle_vertex_locations + triangle_index * 9;
+    const float *const a = relevant_triangle_vertex_locations;
+    const float *const b = relevant_triangle_vertex_locations + 3;
+    const float *const c = relevant_triangle_vertex_locations + 6;
+
+    const float ab[] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float ac[] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+
+    const float normal[] = {
+        ab[1] * ac[2] - ab[2] * ac[1],
+        ab[2] * ac[0] - ab[0] * ac[2],
+        ab[0] * ac[1] - ab[1] * ac[0],
+    };
+
+    const float magnitude_squared =
+        normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2];
+
+    const bool walkable = normal[2] > 0.0f &&
+                          normal[2] * normal[2] >= walkable_slope_cosine *
+                                                       walkable_slope_cosine *
+                                                       magnitude_squared;
+
+    float minimum[] = {a[0], a[1]};
+    float maximum[] = {a[0], a[1]};
+
+    for (int axis = 0; axis < 2; axis++) {
+      if (b[axis] < minimum[axis]) {
+        minimum[axis] = b[axis];
+      }
+
+      if (c[axis] < minimum[axis]) {
+        minimum[axis] = c[axis];
+      }
+
+      if (b[axis] > maximum[axis]) {
+        maximum[axis] = b[axis];
+      }
+
+      if (c[axis] > maximum[axis]) {
+        maximum[axis] = c[axis];
+      }
+    }
+
+    int first_x = floor_to_int((minimum[0] - tile_origin[0]) / cell_size);
+    int last_x = ceiling_to_int((maximum[0] - tile_origin[0]) / cell_size) - 1;
+    int first_y = floor_to_int((minimum[1] - tile_origin[1]) / cell_size);
+    int last_y = ceiling_to_int((maximum[1] - tile_origin[1]) / cell_size) - 1;
+
+    if (first_x < 0) {
+      first_x = 0;
+    }
+
+    if (last_x >= column_count_x) {
+      last_x = column_count_x - 1;
+    }
+
+    if (first_y < 0) {
+      first_y = 0;
+    }
+
+    if (last_y >= column_count_y) {
+      last_y = column_count_y - 1;
+    }
+
+    for (int y = first_y; y <= last_y; y++) {
+      for (int x = first_x; x <= last_x; x++) {
+        const float cell_minimum_x = tile_origin[0] + (float)x * cell_size;
+        const float cell_minimum_y = tile_origin[1] + (float)y * cell_size;
+
+        float polygon_vertex_locations[21];
+        float clipped_vertex_locations[21];
+
+        for (int component = 0; component < 9; component++) {
+          polygon_vertex_locations[component] =
+              relevant_triangle_vertex_locations[component];
+        }
+
+        int vertex_count = clip_polygon(3, polygon_vertex_locations, 0,
+                                        cell_minimum_x, 1.0f,
+                                        clipped_vertex_locations);
+        vertex_count = clip_polygon(vertex_count, clipped_vertex_locations, 0,
+                                    cell_minimum_x + cell_size, -1.0f,
+                                    polygon_vertex_locations);
+        vertex_count = clip_polygon(vertex_count, polygon_vertex_locations, 1,
+                                    cell_minimum_y, 1.0f,
+                                    clipped_vertex_locations);
+        vertex_count = clip_polygon(vertex_count, clipped_vertex_locations, 1,
+                                    cell_minimum_y + cell_size, -1.0f,
+                                    polygon_vertex_locations);
+
+        if (vertex_count < 3) {
+          continue;
+        }
+
+        float lowest = polygon_vertex_locations[2];
+        float highest = polygon_vertex_locations[2];
+
+        for (int vertex_index = 1; vertex_index < vertex_count;
+             vertex_index++) {
+          const float z = polygon_vertex_locations[vertex_index * 3 + 2];
+
+          if (z < lowest) {
+            lowest = z;
+          }
+
+          if (z > highest) {
+            highest = z;
+          }
+        }
+
+        int bottom = floor_to_int((lowest - tile_origin[2]) / cell_height);
+        const int top =
+            ceiling_to_int((highest - tile_origin[2]) / cell_height);
+
+        if (top < 0) {
+          continue;
+        }
+
+        if (bottom < 0) {
+          bottom = 0;
+        }
+
+        if (!add_span(y * column_count_x + x, bottom, top, walkable,
+                      step_cells, column_first_spans, maximum_span_count,
+                      &span_count, &free_span_index, span_next_indices,
+                      span_bottoms, span_tops, span_walkable)) {
+          return -1;
+        }
+      }
+    }
+  }
+
+  int faces = 0;
+
+  for (int column_index = 0; column_index < column_count; column_index++) {
+    for (int span_index = column_first_spans[column_index]; span_index != -1;
+         span_index = span_next_indices[span_index]) {
+      if (span_walkable[span_index] &&
+          has_clearance(span_tops[span_index], span_next_indices[span_index],
+                        clearance_cells, span_bottoms)) {
+        span_face_indices[span_index] = faces;
+        faces++;
+      } else {
+        span_face_indices[span_index] = -1;
+      }
+    }
+  }
+
+  int neighbors = 0;
+
+  for (int column_index = 0; column_index < column_count; column_index++) {
+    const int x = column_index % column_count_x;
+    const int y = column_index / column_count_x;
+
+    for (int span_index = column_first_spans[column_index]; span_index != -1;
+         span_index = span_next_indices[span_index]) {
+      const int face_index = span_face_indices[span_index];
+
+      if (face_index == -1) {
+        continue;
+      }
+
+      for (int edge = 0; edge < 4; edge++) {
+        const int neighbor_x = x + column_offsets_x[edge];
+        const int neighbor_y = y + column_offsets_y[edge];
+        const int edge_index = face_index * 4 + edge;
+
+        if (face_index < maximum_cell_face_count) {
+          cell_face_edge_neighbor_offsets[edge_index] = neighbors;
+          cell_face_edge_neighbor_counts[edge_index] = 0;
+        }
+
+        if (neighbor_x < 0 || neighbor_x >= column_count_x || neighbor_y < 0 ||
+            neighbor_y >= column_count_y) {
+          continue;
+        }
+
+        for (int neighbor_span_index =
+                 column_first_spans[neighbor_y * column_count_x + neighbor_x];
+             neighbor_span_index != -1;
+             neighbor_span_index = span_next_indices[neighbor_span_index]) {
+          const int difference =
+              span_tops[neighbor_span_index] - span_tops[span_index];
+          const int floor = difference > 0 ? span_tops[neighbor_span_index]
+                                           : span_tops[span_index];
+
+          if (span_face_indices[neighbor_span_index] == -1 ||
+              difference > step_cells || difference < -step_cells ||
+              !has_clearance(floor, span_next_indices[span_index],
+                             clearance_cells, span_bottoms) ||
+              !has_clearance(floor, span_next_indices[neighbor_span_index],
+                             clearance_cells, span_bottoms)) {
+            continue;
+          }
+
+          if (face_index < maximum_cell_face_count) {
+            cell_face_edge_neighbor_counts[edge_index]++;
+          }
+
+          if (neighbors < maximum_cell_neighbor_count) {
+            cell_face_edge_neighbor_face_indices[neighbors] =
+                span_face_indices[neighbor_span_index];
+          }
+
+          neighbors++;
+        }
+      }
+
+      if (face_index < maximum_cell_face_count) {
+        const float minimum_x = tile_origin[0] + (float)x * cell_size;
+        const float minimum_y = tile_origin[1] + (float)y * cell_size;
+        const float z =
+            tile_origin[2] + (float)span_tops[span_index] * cell_height;
+        const float corners_x[] = {minimum_x, minimum_x + cell_size,
+                                   minimum_x + cell_size, minimum_x};
+        const float corners_y[] = {minimum_y, minimum_y, minimum_y + cell_size,
+                                   minimum_y + cell_size};
+        float *const relevant_cell_face_vertex_locations =
+            cell_face_vertex_locations + face_index * 12;
+        float *const relevant_cell_face_normal =
+            cell_face_normals + face_index * 3;
+
+        cell_face_vertex_counts[face_index] = 4;
+        cell_face_vertex_offsets[face_index] = face_index * 4;
+
+        for (int vertex_index = 0; vertex_index < 4; vertex_index++) {
+          float *const relevant_location =
+              relevant_cell_face_vertex_locations + vertex_index * 3;
+
+          relevant_location[0] = corners_x[vertex_index];
+          relevant_location[1] = corners_y[vertex_index];
+          relevant_location[2] = z;
+        }
+
+        relevant_cell_face_normal[0] = 0.0f;
+        relevant_cell_face_normal[1] = 0.0f;
+        relevant_cell_face_normal[2] = 1.0f;
+      }
+    }
+  }
+
+  *cell_face_count = faces;
+  *cell_neighbor_count = neighbors;
+
+  if (faces > maximum_cell_face_count ||
+      neighbors > maximum_cell_neighbor_count) {
+    return -1;
+  }
+
+  return merge_navigable_faces(
+      faces, cell_face_vertex_counts, cell_face_vertex_offsets,
+      cell_face_vertex_locations, cell_face_normals,
+      cell_face_edge_neighbor_counts, cell_face_edge_neighbor_offsets,
+      cell_face_edge_neighbor_face_indices, NULL, maximum_vertex_count, 1.0f,
+      cell_height * 0.5f, face_groups, face_next_members, group_vertex_counts,
+      group_vertex_locations, cell_face_merged_face_indices, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals, edge_normals,
+      edge_exit_normals, edge_coefficients, vertex_up_normals,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, NULL);
+}
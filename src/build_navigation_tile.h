@@ -0,0 +1,152 @@
+#ifndef BUILD_NAVIGATION_TILE_H
+
+#define BUILD_NAVIGATION_TILE_H
+
+/**
+ * Builds a navigation mesh for one rectangular tile of a level from a soup of
+ * triangles.  The triangles are voxelized into columns of solid spans (walls
+ * and other steep geometry included); the top of each span which is shallow
+ * enough to walk upon and which has enough clearance above it for an agent to
+ * stand becomes a square cell face, connected to those of adjacent columns
+ * which can be stepped between without the combined clearance of the two
+ * columns falling short of the agent's height.  The cell faces are then merged
+ * into larger convex faces and all derived data is calculated (see
+ * merge_navigable_faces).  No state is shared between calls, so separate tiles
+ * may be built in parallel (one thread per tile), and a single tile may be
+ * rebuilt after an edit without rebuilding the level.
+ * @param triangle_count The number of triangles in the input geometry.
+ * @param triangle_vertex_locations Three 3D vectors describing the location of
+ *                                  each vertex of each triangle of the input
+ *                                  geometry.  Walkable triangles wind counter
+ *                                  clockwise when viewed from above.  Those
+ *                                  outside of the tile are ignored, so the
+ *                                  whole level may be given for every tile.
+ *                                  Behavior is undefined if any component is
+ *                                  NaN, infinity or negative infinity.
+ * @param tile_origin A 3D vector describing the minimum corner of the tile.
+ *                    Geometry below it is ignored.
+ * @param column_count_x The number of columns along the X axis of the tile.
+ * @param column_count_y The number of columns along the Y axis of the tile.
+ * @param cell_size The width of each column along the X and Y axes.
+ * @param cell_height The vertical resolution of the spans within each column.
+ * @param walkable_slope_cosine The cosine of the steepest slope which can be
+ *                              walked upon (e.g. 0.707 for 45 degrees).
+ * @param step_height The greatest difference in height between adjacent
+ *                    faces which can be stepped between.
+ * @param agent_height The least clearance above a walkable surface in which an
+ *                     agent can stand.
+ * @param maximum_vertex_count The greatest number of vertices a merged face may
+ *                             have.  Must be at least 4, as each face is
+ *                             merged from the 4-vertex faces of cells.
+ * @param column_first_spans Overwritten with temporary data.  Must have space
+ *                           for column_count_x * column_count_y values.
+ * @param maximum_span_count The number of spans which span_next_indices,
+ *                           span_bottoms, span_tops, span_walkable and
+ *                           span_face_indices have space for.
+ * @param span_next_indices Overwritten with temporary data.
+ * @param span_bottoms Overwritten with temporary data.
+ * @param span_tops Overwritten with temporary data.
+ * @param span_walkable Overwritten with temporary data.
+ * @param span_face_indices Overwritten with the index of the cell face built
+ *                          upon each span, or -1 where there is none.
+ * @param maximum_cell_face_count The number of cell faces which the cell face
+ *                                arrays, face_groups, face_next_members,
+ *                                group_vertex_counts and
+ *                                cell_face_merged_face_indices have space for.
+ * @param maximum_cell_neighbor_count The number of neighbors which
+ *                                    cell_face_edge_neighbor_face_indices has
+ *                                    space for.
+ * @param cell_face_vertex_counts Overwritten with temporary data.
+ * @param cell_face_vertex_offsets Overwritten with temporary data.
+ * @param cell_face_vertex_locations Overwritten with temporary data.  Must have
+ *                                   space for 4 3D vectors per cell face.
+ * @param cell_face_normals Overwritten with temporary data.  Must have space
+ *                          for a 3D vector per cell face.
+ * @param cell_face_edge_neighbor_counts Overwritten with temporary data.  Must
+ *                                       have space for 4 values per cell face.
+ * @param cell_face_edge_neighbor_offsets Overwritten with temporary data.  Must
+ *                                        have space for 4 values per cell
+ *                                        face.
+ * @param cell_face_edge_neighbor_face_indices Overwritten with temporary data.
+ * @param face_groups Overwritten with temporary data.
+ * @param face_next_members Overwritten with temporary data.
+ * @param group_vertex_counts Overwritten with temporary data.
+ * @param group_vertex_locations Overwritten with temporary data.  Must have
+ *                               space for (maximum_cell_face_count + 2) *
+ *                               maximum_vertex_count 3D vectors.
+ * @param cell_face_merged_face_indices Overwritten with the index of the face
+ *                                      containing each cell face.
+ * @param face_vertex_counts Overwritten with the number of vertices of each
+ *                           face.  Must have space for maximum_cell_face_count
+ *                           values.
+ * @param face_vertex_offsets Overwritten with the exclusive running totals of
+ *                            the vertex count of each face.  Must have space
+ *                            for maximum_cell_face_count values.
+ * @param face_vertex_locations Overwritten with a 3D vector describing the
+ *                              location of each vertex of each face.  Must
+ *                              have space for 4 per cell face.
+ * @param face_normals Overwritten with a 3D unit vector describing the surface
+ *                     normal of each face.  Must have space for one per cell
+ *                     face.
+ * @param edge_normals Overwritten with a 3D unit vector for each edge of each
+ *                     face (see rebake_navigable_faces).  Must have space for 4
+ *                     per cell face.
+ * @param edge_exit_normals Overwritten with a 3D unit vector for each edge of
+ *                          each face (see rebake_navigable_faces).  Must have
+ *                          space for 4 per cell face.
+ * @param edge_coefficients Overwritten with a 3D vector for each vertex of each
+ *                          face (see rebake_navigable_faces).  Must have space
+ *                          for 4 per cell face.
+ * @param vertex_up_normals Overwritten with a 3D unit vector for each vertex
+ *                          of each face (see rebake_navigable_faces).  Must
+ *                          have space for 4 per cell face.
+ * @param face_edge_neighbor_counts Overwritten with the number of neighboring
+ *                                  faces for each edge of each face.  Must have
+ *                                  space for 4 per cell face.
+ * @param face_edge_neighbor_offsets Overwritten with the exclusive running
+ *                                   totals of the neighbor count of each edge
+ *                                   of each face.  Must have space for 4 per
+ *                                   cell face.
+ * @param face_edge_neighbor_face_indices Overwritten with the index of each
+ *                                        neighboring face of each edge of each
+ *                                        face.  Must have space for
+ *                                        maximum_cell_neighbor_count values.
+ * @param cell_face_count Overwritten with the number of cell faces, which may
+ *                        exceed maximum_cell_face_count.  Not written should
+ *                        maximum_span_count be exceeded.
+ * @param cell_neighbor_count Overwritten with the total number of neighbors of
+ *                            the cell faces, which may exceed
+ *                            maximum_cell_neighbor_count.  Not written should
+ *                            maximum_span_count be exceeded.
+ * @return The number of faces built, or -1 should maximum_span_count,
+ *         maximum_cell_face_count or maximum_cell_neighbor_count be exceeded.
+ *         Nothing is written beyond any maximum, and nothing is merged should
+ *         any be exceeded.
+ */
+int build_navigation_tile(
+    const int triangle_count, const float *const triangle_vertex_locations,
+    const float *const tile_origin, const int column_count_x,
+    const int column_count_y, const float cell_size, const float cell_height,
+    const float walkable_slope_cosine, const float step_height,
+    const float agent_height, const int maximum_vertex_count,
+    int *const column_first_spans, const int maximum_span_count,
+    int *const span_next_indices, int *const span_bottoms, int *const span_tops,
+    int *const span_walkable, int *const span_face_indices,
+    const int maximum_cell_face_count, const int maximum_cell_neighbor_count,
+    int *const cell_face_vertex_counts, int *const cell_face_vertex_offsets,
+    float *const cell_face_vertex_locations, float *const cell_face_normals,
+    int *const cell_face_edge_neighbor_counts,
+    int *const cell_face_edge_neighbor_offsets,
+    int *const cell_face_edge_neighbor_face_indices, int *const face_groups,
+    int *const face_next_members, int *const group_vertex_counts,
+    float *const group_vertex_locations,
+    int *const cell_face_merged_face_indices, int *const face_vertex_counts,
+    int *const face_vertex_offsets, float *const face_vertex_locations,
+    float *const face_normals, float *const edge_normals,
+    float *const edge_exit_normals, float *const edge_coefficients,
+    float *const vertex_up_normals, int *const face_edge_neighbor_counts,
+    int *const face_edge_neighbor_offsets,
+    int *const face_edge_neighbor_face_indices, int *const cell_face_count,
+    int *const cell_neighbor_count);
+
+#endif
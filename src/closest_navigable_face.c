@@ -1,4 +1,71 @@
 #include "closest_navigable_face.h"
+#include <stddef.h>
+
+static inline void
+constrain_to_edges(const float *const relevant_face_vertex_locations,
+                   const float *const relevant_edge_normals,
+                   const float *const relevant_edge_coefficients,
+                   const int relevant_face_vertex_count,
+                   float *const constrained_location) {
+  for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+       vertex_index++) {
+    const float *const relevant_face_vertex_location =
+        relevant_face_vertex_locations + vertex_index * 3;
+
+    const float edge_difference[] = {
+        constrained_location[0] - relevant_face_vertex_location[0],
+        constrained_location[1] - relevant_face_vertex_location[1],
+        constrained_location[2] - relevant_face_vertex_location[2],
+    };
+
+    const float *const relevant_edge_normal =
+        relevant_edge_normals + vertex_index * 3;
+
+    const float edge_distance = edge_difference[0] * relevant_edge_normal[0] +
+                                edge_difference[1] * relevant_edge_normal[1] +
+                                edge_difference[2] * relevant_edge_normal[2];
+
+    if (edge_distance > 0.0f) {
+      const float *const relevant_edge_coefficient =
+          relevant_edge_coefficients + vertex_index * 3;
+
+      const float unclamped =
+          edge_difference[0] * relevant_edge_coefficient[0] +
+          edge_difference[1] * relevant_edge_coefficient[1] +
+          edge_difference[2] * relevant_edge_coefficient[2];
+
+      if (unclamped <= 0.0f) {
+        constrained_location[0] = relevant_face_vertex_location[0];
+        constrained_location[1] = relevant_face_vertex_location[1];
+        constrained_location[2] = relevant_face_vertex_location[2];
+        return;
+      }
+
+      const float *const next_face_vertex_location =
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
+
+      if (unclamped >= 1.0f) {
+        constrained_location[0] = next_face_vertex_location[0];
+        constrained_location[1] = next_face_vertex_location[1];
+        constrained_location[2] = next_face_vertex_location[2];
+        return;
+      }
+
+      const float inverse = 1.0f - unclamped;
+
+      constrained_location[0] = relevant_face_vertex_location[0] * inverse +
+                                next_face_vertex_location[0] * unclamped;
+      constrained_location[1] = relevant_face_vertex_location[1] * inverse +
+                                next_face_vertex_location[1] * unclamped;
+      constrained_location[2] = relevant_face_vertex_location[2] * inverse +
+                                next_face_vertex_location[2] * unclamped;
+
+      return;
+    }
+  }
+}
 
 int closest_navigable_face(const float *const location, const int face_count,
                            const int *const face_vertex_counts,
@@ -6,11 +73,19 @@ int closest_navigable_face(const float *const location, const int face_count,
                            const float *const face_vertex_locations,
                            const float *const face_normals,
                            const float *const edge_normals,
-                           const float *const edge_coefficients) {
+                           const float *const edge_coefficients,
+                           const int *const face_flags,
+                           const int include_flags, const int exclude_flags) {
   int output = -1;
   float best_distance_squared = 1.0f / 0.0f;
 
   for (int face_index = 0; face_index < face_count; face_index++) {
+    if (face_flags != NULL &&
+        ((face_flags[face_index] & include_flags) == 0 ||
+         (face_flags[face_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
     float constrained_location[3];
 
     const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
@@ -41,66 +116,27 @@ int closest_navigable_face(const float *const location, const int face_count,
 
     const float *const relevant_edge_normals =
         edge_normals + relevant_face_vertex_offset * 3;
+    const float *const relevant_edge_coefficients =
+        edge_coefficients + relevant_face_vertex_offset * 3;
 
     const int relevant_face_vertex_count = face_vertex_counts[face_index];
 
-    for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
-         vertex_index++) {
-      const float *const relevant_face_vertex_location =
-          relevant_face_vertex_locations + vertex_index * 3;
-
-      const float edge_difference[] = {
-          constrained_location[0] - relevant_face_vertex_location[0],
-          constrained_location[1] - relevant_face_vertex_location[1],
-          constrained_location[2] - relevant_face_vertex_location[2],
-      };
-
-      const float *const relevant_edge_normal =
-          relevant_edge_normals + vertex_index * 3;
-
-      const float edge_distance = edge_difference[0] * relevant_edge_normal[0] +
-                                  edge_difference[1] * relevant_edge_normal[1] +
-                                  edge_difference[2] * relevant_edge_normal[2];
-
-      if (edge_distance > 0.0f) {
-        const float *const relevant_edge_coefficient =
-            edge_coefficients + relevant_face_vertex_offset * 3 +
-            vertex_index * 3;
-
-        const float unclamped =
-            edge_difference[0] * relevant_edge_coefficient[0] +
-            edge_difference[1] * relevant_edge_coefficient[1] +
-            edge_difference[2] * relevant_edge_coefficient[2];
-
-        if (unclamped <= 0.0f) {
-          constrained_location[0] = relevant_face_vertex_location[0];
-          constrained_location[1] = relevant_face_vertex_location[1];
-          constrained_location[2] = relevant_face_vertex_location[2];
-          break;
-        }
-
-        const float *const next_face_vertex_location =
-            relevant_face_vertex_locations +
-            ((vertex_index + 1) % relevant_face_vertex_count) * 3;
-
-        if (unclamped >= 1.0f) {
-          constrained_location[0] = next_face_vertex_location[0];
-          constrained_location[1] = next_face_vertex_location[1];
-          constrained_location[2] = next_face_vertex_location[2];
-          break;
-        }
-
-        const float inverse = 1.0f - unclamped;
-
-        constrained_location[0] = relevant_face_vertex_location[0] * inverse +
-                                  next_face_vertex_location[0] * unclamped;
-        constrained_location[1] = relevant_face_vertex_location[1] * inverse +
-                                  next_face_vertex_location[1] * unclamped;
-        constrained_location[2] = relevant_face_vertex_location[2] * inverse +
-                                  next_face_vertex_location[2] * unclamped;
-
-        break;
-      }
+    switch (relevant_face_vertex_count) {
+    case 3:
+      constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                         relevant_edge_coefficients, 3, constrained_location);
+      break;
+
+    case 4:
+      constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                         relevant_edge_coefficients, 4, constrained_location);
+      break;
+
+    default:
+      constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                         relevant_edge_coefficients, relevant_face_vertex_count,
+                         constrained_location);
+      break;
     }
 
     const float delta[] = {
@@ -28,7 +28,14 @@
  *                          navigation mesh.  Each points to the next vertex of
  *                          the face, with a magnitude equal to the reciprocal
  *                          of the distance to that vertex.
- * @return The index of the closest face to the given location.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to consider every face.
+ * @param include_flags When face_flags is not NULL, only faces with at least
+ *                      one of these flags are considered.
+ * @param exclude_flags When face_flags is not NULL, faces with any of these
+ *                      flags are not considered.
+ * @return The index of the closest face to the given location, or -1 if no
+ *         face was considered.
  */
 int closest_navigable_face(const float *const location, const int face_count,
                            const int *const face_vertex_counts,
@@ -36,6 +43,8 @@ int closest_navigable_face(const float *const location, const int face_count,
                            const float *const face_vertex_locations,
                            const float *const face_normals,
                            const float *const edge_normals,
-                           const float *const edge_coefficients);
+                           const float *const edge_coefficients,
+                           const int *const face_flags,
+                           const int include_flags, const int exclude_flags);
 
 #endif
@@ -0,0 +1,177 @@
+#include "closest_navigable_face_in_buckets.h"
+#include <stddef.h>
+
+static inline void
+constrain_to_edges(const float *const relevant_face_vertex_locations,
+                   const float *const relevant_edge_normals,
+                   const float *const relevant_edge_coefficients,
+                   const int relevant_face_vertex_count,
+                   float *const constrained_location) {
+  for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+       vertex_index++) {
+    const float *const relevant_face_vertex_location =
+        relevant_face_vertex_locations + vertex_index * 3;
+
+    const float edge_difference[] = {
+        constrained_location[0] - relevant_face_vertex_location[0],
+        constrained_location[1] - relevant_face_vertex_location[1],
+        constrained_location[2] - relevant_face_vertex_location[2],
+    };
+
+    const float *const relevant_edge_normal =
+        relevant_edge_normals + vertex_index * 3;
+
+    const float edge_distance = edge_difference[0] * relevant_edge_normal[0] +
+                                edge_difference[1] * relevant_edge_normal[1] +
+                                edge_difference[2] * relevant_edge_normal[2];
+
+    if (edge_distance > 0.0f) {
+      const float *const relevant_edge_coefficient =
+          relevant_edge_coefficients + vertex_index * 3;
+
+      const float unclamped =
+          edge_difference[0] * relevant_edge_coefficient[0] +
+          edge_difference[1] * relevant_edge_coefficient[1] +
+          edge_difference[2] * relevant_edge_coefficient[2];
+
+      if (unclamped <= 0.0f) {
+        constrained_location[0] = relevant_face_vertex_location[0];
+        constrained_location[1] = relevant_face_vertex_location[1];
+        constrained_location[2] = relevant_face_vertex_location[2];
+        return;
+      }
+
+      const float *const next_face_vertex_location =
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
+
+      if (unclamped >= 1.0f) {
+        constrained_location[0] = next_face_vertex_location[0];
+        constrained_location[1] = next_face_vertex_location[1];
+        constrained_location[2] = next_face_vertex_location[2];
+        return;
+      }
+
+      const float inverse = 1.0f - unclamped;
+
+      constrained_location[0] = relevant_face_vertex_location[0] * inverse +
+                                next_face_vertex_location[0] * unclamped;
+      constrained_location[1] = relevant_face_vertex_location[1] * inverse +
+                                next_face_vertex_location[1] * unclamped;
+      constrained_location[2] = relevant_face_vertex_location[2] * inverse +
+                                next_face_vertex_location[2] * unclamped;
+
+      return;
+    }
+  }
+}
+
+static inline void search_bucket(
+    const float *const location, const int bucket_vertex_count,
+    const int bucket_face_offset, const int bucket_face_count,
+    const int bucket_vertex_offset, const float *const face_vertex_locations,
+    const float *const face_normals, const float *const edge_normals,
+    const float *const edge_coefficients, const int *const face_flags,
+    const int include_flags, const int exclude_flags, int *const output,
+    float *const best_distance_squared) {
+  for (int bucket_face_index = 0; bucket_face_index < bucket_face_count;
+       bucket_face_index++) {
+    const int face_index = bucket_face_offset + bucket_face_index;
+
+    if (face_flags != NULL &&
+        ((face_flags[face_index] & include_flags) == 0 ||
+         (face_flags[face_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
+    float constrained_location[3];
+
+    const int relevant_face_vertex_offset =
+        bucket_vertex_offset + bucket_face_index * bucket_vertex_count;
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+
+    const float difference[] = {
+        location[0] - relevant_face_vertex_locations[0],
+        location[1] - relevant_face_vertex_locations[1],
+        location[2] - relevant_face_vertex_locations[2],
+    };
+
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+
+    const float surface_distance = difference[0] * relevant_face_normal[0] +
+                                   difference[1] * relevant_face_normal[1] +
+                                   difference[2] * relevant_face_normal[2];
+
+    constrained_location[0] =
+        location[0] - relevant_face_normal[0] * surface_distance;
+    constrained_location[1] =
+        location[1] - relevant_face_normal[1] * surface_distance;
+    constrained_location[2] =
+        location[2] - relevant_face_normal[2] * surface_distance;
+
+    constrain_to_edges(relevant_face_vertex_locations,
+                       edge_normals + relevant_face_vertex_offset * 3,
+                       edge_coefficients + relevant_face_vertex_offset * 3,
+                       bucket_vertex_count, constrained_location);
+
+    const float delta[] = {
+        constrained_location[0] - location[0],
+        constrained_location[1] - location[1],
+        constrained_location[2] - location[2],
+    };
+
+    const float distance_squared =
+        delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+    if (distance_squared <= *best_distance_squared) {
+      *output = face_index;
+      *best_distance_squared = distance_squared;
+    }
+  }
+}
+
+int closest_navigable_face_in_buckets(
+    const float *const location, const int bucket_count,
+    const int *const bucket_vertex_counts, const int *const bucket_face_offsets,
+    const int *const bucket_face_counts, const int *const bucket_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags) {
+  int output = -1;
+  float best_distance_squared = 1.0f / 0.0f;
+
+  for (int bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+    const int bucket_face_offset = bucket_face_offsets[bucket_index];
+    const int bucket_face_count = bucket_face_counts[bucket_index];
+    const int bucket_vertex_offset = bucket_vertex_offsets[bucket_index];
+
+    switch (bucket_vertex_counts[bucket_index]) {
+    case 3:
+      search_bucket(location, 3, bucket_face_offset, bucket_face_count,
+                    bucket_vertex_offset, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, face_flags, include_flags,
+                    exclude_flags, &output, &best_distance_squared);
+      break;
+
+    case 4:
+      search_bucket(location, 4, bucket_face_offset, bucket_face_count,
+                    bucket_vertex_offset, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, face_flags, include_flags,
+                    exclude_flags, &output, &best_distance_squared);
+      break;
+
+    default:
+      search_bucket(location, bucket_vertex_counts[bucket_index],
+                    bucket_face_offset, bucket_face_count,
+                    bucket_vertex_offset, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, face_flags, include_flags,
+                    exclude_flags, &output, &best_distance_squared);
+      break;
+    }
+  }
+
+  return output;
+}
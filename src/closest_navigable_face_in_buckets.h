@@ -0,0 +1,55 @@
+#ifndef CLOSEST_NAVIGABLE_FACE_IN_BUCKETS_H
+
+#define CLOSEST_NAVIGABLE_FACE_IN_BUCKETS_H
+
+/**
+ * Finds the closest navigable face to a given location within a navigation
+ * mesh whose faces have been grouped into buckets of equal vertex count (see
+ * navigable_face_vertex_count_buckets).  As every face of a bucket has the
+ * same number of vertices, no per-face vertex counts or offsets are read, and
+ * the loop over each face's edges has a fixed number of iterations.  Gives
+ * the same result as closest_navigable_face.
+ * @param location The 3D vector describing the location to search from.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param bucket_count The number of buckets in the navigation mesh.
+ * @param bucket_vertex_counts The number of vertices of each face within each
+ *                             bucket.  Behavior is undefined if any is less
+ *                             than 3.
+ * @param bucket_face_offsets The index of the first face of each bucket.
+ * @param bucket_face_counts The number of faces within each bucket.
+ * @param bucket_vertex_offsets The index of the first vertex of the first face
+ *                              of each bucket.
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to consider every face.
+ * @param include_flags When face_flags is not NULL, only faces with at least
+ *                      one of these flags are considered.
+ * @param exclude_flags When face_flags is not NULL, faces with any of these
+ *                      flags are not considered.
+ * @return The index of the closest face to the given location, or -1 if no
+ *         face was considered.
+ */
+int closest_navigable_face_in_buckets(
+    const float *const location, const int bucket_count,
+    const int *const bucket_vertex_counts, const int *const bucket_face_offsets,
+    const int *const bucket_face_counts, const int *const bucket_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags);
+
+#endif
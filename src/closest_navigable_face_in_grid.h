@@ -0,0 +1,62 @@
+#ifndef CLOSEST_NAVIGABLE_FACE_IN_GRID_H
+
+#define CLOSEST_NAVIGABLE_FACE_IN_GRID_H
+
+/**
+ * Finds the closest navigable face to a given location using a grid built by
+ * navigable_face_grid.  Only the cell containing the location is searched at
+ * first, followed by successive rings of surrounding cells until no face
+ * outside of those searched could be closer, so the cost depends upon the
+ * density of faces near the location rather than the size of the navigation
+ * mesh.
+ * @param location The 3D vector describing the location to search from.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param cell_size The cell size with which the grid was built.
+ * @param bucket_count The bucket count with which the grid was built.
+ * @param bucket_face_offsets The bucket face offsets of the grid.
+ * @param bucket_face_indices The bucket face indices of the grid.
+ * @param maximum_rings The number of rings of cells surrounding the cell
+ *                      containing the location to search at most.  Faces
+ *                      further away than this may not be found.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to consider every face.
+ * @param include_flags When face_flags is not NULL, only faces with at least
+ *                      one of these flags are considered.
+ * @param exclude_flags When face_flags is not NULL, faces with any of these
+ *                      flags are not considered.
+ * @return The index of the closest face to the given location, or -1 if no
+ *         face was found within maximum_rings.  Where faces are equally close,
+ *         the highest index is returned, as with closest_navigable_face.
+ */
+int closest_navigable_face_in_grid(
+    const float *const location, const float cell_size, const int bucket_count,
+    const int *const bucket_face_offsets, const int *const bucket_face_indices,
+    const int maximum_rings, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags);
+
+#endif
@@ -0,0 +1,190 @@
+#include "closest_navigable_point.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static inline bool
+constrain_to_edges(const float *const relevant_face_vertex_locations,
+                   const float *const relevant_edge_normals,
+                   const float *const relevant_edge_coefficients,
+                   const int relevant_face_vertex_count,
+                   const float surface_distance_squared,
+                   const float best_distance_squared,
+                   float *const constrained_location) {
+  for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+       vertex_index++) {
+    const float *const relevant_face_vertex_location =
+        relevant_face_vertex_locations + vertex_index * 3;
+
+    const float edge_difference[] = {
+        constrained_location[0] - relevant_face_vertex_location[0],
+        constrained_location[1] - relevant_face_vertex_location[1],
+        constrained_location[2] - relevant_face_vertex_location[2],
+    };
+
+    const float *const relevant_edge_normal =
+        relevant_edge_normals + vertex_index * 3;
+
+    const float edge_distance = edge_difference[0] * relevant_edge_normal[0] +
+                                edge_difference[1] * relevant_edge_normal[1] +
+                                edge_difference[2] * relevant_edge_normal[2];
+
+    if (edge_distance > 0.0f) {
+      if (surface_distance_squared + edge_distance * edge_distance >
+          best_distance_squared) {
+        return false;
+      }
+
+      const float *const relevant_edge_coefficient =
+          relevant_edge_coefficients + vertex_index * 3;
+
+      const float unclamped =
+          edge_difference[0] * relevant_edge_coefficient[0] +
+          edge_difference[1] * relevant_edge_coefficient[1] +
+          edge_difference[2] * relevant_edge_coefficient[2];
+
+      if (unclamped <= 0.0f) {
+        constrained_location[0] = relevant_face_vertex_location[0];
+        constrained_location[1] = relevant_face_vertex_location[1];
+        constrained_location[2] = relevant_face_vertex_location[2];
+        return true;
+      }
+
+      const float *const next_face_vertex_location =
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
+
+      if (unclamped >= 1.0f) {
+        constrained_location[0] = next_face_vertex_location[0];
+        constrained_location[1] = next_face_vertex_location[1];
+        constrained_location[2] = next_face_vertex_location[2];
+        return true;
+      }
+
+      const float inverse = 1.0f - unclamped;
+
+      constrained_location[0] = relevant_face_vertex_location[0] * inverse +
+                                next_face_vertex_location[0] * unclamped;
+      constrained_location[1] = relevant_face_vertex_location[1] * inverse +
+                                next_face_vertex_location[1] * unclamped;
+      constrained_location[2] = relevant_face_vertex_location[2] * inverse +
+                                next_face_vertex_location[2] * unclamped;
+
+      return true;
+    }
+  }
+
+  return true;
+}
+
+int closest_navigable_point(
+    const float *const location, const float maximum_distance,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, float *const result_location,
+    float *const result_distance_squared) {
+  int output = -1;
+  float best_distance_squared = maximum_distance * maximum_distance;
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    if (face_flags != NULL &&
+        ((face_flags[face_index] & include_flags) == 0 ||
+         (face_flags[face_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
+    float constrained_location[3];
+
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+
+    const float difference[] = {
+        location[0] - relevant_face_vertex_locations[0],
+        location[1] - relevant_face_vertex_locations[1],
+        location[2] - relevant_face_vertex_locations[2],
+    };
+
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+
+    const float surface_distance = difference[0] * relevant_face_normal[0] +
+                                   difference[1] * relevant_face_normal[1] +
+                                   difference[2] * relevant_face_normal[2];
+
+    const float surface_distance_squared = surface_distance * surface_distance;
+
+    if (surface_distance_squared > best_distance_squared) {
+      continue;
+    }
+
+    const float surface_offset[] = {
+        relevant_face_normal[0] * surface_distance,
+        relevant_face_normal[1] * surface_distance,
+        relevant_face_normal[2] * surface_distance,
+    };
+
+    constrained_location[0] = location[0] - surface_offset[0];
+    constrained_location[1] = location[1] - surface_offset[1];
+    constrained_location[2] = location[2] - surface_offset[2];
+
+    const float *const relevant_edge_normals =
+        edge_normals + relevant_face_vertex_offset * 3;
+    const float *const relevant_edge_coefficients =
+        edge_coefficients + relevant_face_vertex_offset * 3;
+
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+    bool within_bound;
+
+    switch (relevant_face_vertex_count) {
+    case 3:
+      within_bound = constrain_to_edges(
+          relevant_face_vertex_locations, relevant_edge_normals,
+          relevant_edge_coefficients, 3, surface_distance_squared,
+          best_distance_squared, constrained_location);
+      break;
+
+    case 4:
+      within_bound = constrain_to_edges(
+          relevant_face_vertex_locations, relevant_edge_normals,
+          relevant_edge_coefficients, 4, surface_distance_squared,
+          best_distance_squared, constrained_location);
+      break;
+
+    default:
+      within_bound = constrain_to_edges(
+          relevant_face_vertex_locations, relevant_edge_normals,
+          relevant_edge_coefficients, relevant_face_vertex_count,
+          surface_distance_squared, best_distance_squared,
+          constrained_location);
+      break;
+    }
+
+    if (!within_bound) {
+      continue;
+    }
+
+    const float delta[] = {
+        constrained_location[0] - location[0],
+        constrained_location[1] - location[1],
+        constrained_location[2] - location[2],
+    };
+
+    const float distance_squared =
+        delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+    if (distance_squared <= best_distance_squared) {
+      output = face_index;
+      best_distance_squared = distance_squared;
+      result_location[0] = constrained_location[0];
+      result_location[1] = constrained_location[1];
+      result_location[2] = constrained_location[2];
+      *result_distance_squared = distance_squared;
+    }
+  }
+
+  return output;
+}
@@ -0,0 +1,75 @@
+#ifndef CLOSEST_NAVIGABLE_POINT_IN_VOLUME_H
+
+#define CLOSEST_NAVIGABLE_POINT_IN_VOLUME_H
+
+/**
+ * Finds the closest navigable face to a given location, within a maximum
+ * distance, then constrains the location to the volume of that face.  This is
+ * equivalent to calling closest_navigable_face followed by
+ * constrain_to_navigable_volume, but locations below the surface reuse the
+ * surface constraint calculated during the search, and the face's data is
+ * only loaded again when the location is above its surface.
+ * @param location The 3D vector describing the location to search from.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param maximum_distance The maximum distance from the location to the
+ *                         surface of a face for it to be found.  Behavior is
+ *                         undefined if NaN or negative.  Infinity searches
+ *                         every face.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_exit_normals A 3D unit vector perpendicular to each edge of each
+ *                          face of the navigation mesh, pointing out of the
+ *                          face into a hypothetical neighboring face.  Where no
+ *                          neighbors exist, this is perpendicular to the face's
+ *                          surface normal.  It is otherwise averaged with the
+ *                          neighboring edge exit normals to ensure that there
+ *                          is a consistent plane to cross to enter or exit the
+ *                          face.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.
+ * @param vertex_up_normals A 3D unit vector for each vertex of each face,
+ *                          perpendicular to the edge exit normal either side of
+ *                          it and facing "up" (in the same general direction as
+ *                          the face normal).
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to consider every face.
+ * @param include_flags When face_flags is not NULL, only faces with at least
+ *                      one of these flags are considered.
+ * @param exclude_flags When face_flags is not NULL, faces with any of these
+ *                      flags are not considered.
+ * @param result_location The 3D vector which is overwritten with the location
+ *                        constrained to the volume of the face found.  May
+ *                        overlap with the location.  Not written when no face
+ *                        is found.
+ * @return The index of the closest face to the given location, or -1 if no
+ *         face was considered within the maximum distance.
+ */
+int closest_navigable_point_in_volume(
+    const float *const location, const float maximum_distance,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals, const float *const edge_normals,
+    const float *const edge_coefficients, const float *const vertex_up_normals,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, float *const result_location);
+
+#endif
@@ -1,42 +1,11 @@
 #include "constrain_to_navigable_surface.h"
 
-void constrain_to_navigable_surface(
-    const float *const unconstrained_location,
-    const int *const face_vertex_counts, const int *const face_vertex_offsets,
-    const float *const face_vertex_locations, const float *const face_normals,
-    const float *const edge_normals, const float *const edge_coefficients,
-    const int face_index, float *const constrained_location) {
-  const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
-  const float *const relevant_face_vertex_locations =
-      face_vertex_locations + relevant_face_vertex_offset * 3;
-
-  const float difference[] = {
-      unconstrained_location[0] - relevant_face_vertex_locations[0],
-      unconstrained_location[1] - relevant_face_vertex_locations[1],
-      unconstrained_location[2] - relevant_face_vertex_locations[2],
-  };
-
-  const float *const relevant_face_normal = face_normals + face_index * 3;
-
-  const float surface_distance = difference[0] * relevant_face_normal[0] +
-                                 difference[1] * relevant_face_normal[1] +
-                                 difference[2] * relevant_face_normal[2];
-
-  const float surface_offset[] = {
-      relevant_face_normal[0] * surface_distance,
-      relevant_face_normal[1] * surface_distance,
-      relevant_face_normal[2] * surface_distance,
-  };
-
-  constrained_location[0] = unconstrained_location[0] - surface_offset[0];
-  constrained_location[1] = unconstrained_location[1] - surface_offset[1];
-  constrained_location[2] = unconstrained_location[2] - surface_offset[2];
-
-  const float *const relevant_edge_normals =
-      edge_normals + relevant_face_vertex_offset * 3;
-
-  const int relevant_face_vertex_count = face_vertex_counts[face_index];
-
+static inline void
+constrain_to_edges(const float *const relevant_face_vertex_locations,
+                   const float *const relevant_edge_normals,
+                   const float *const relevant_edge_coefficients,
+                   const int relevant_face_vertex_count,
+                   float *const constrained_location) {
   for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
        vertex_index++) {
     const float *const relevant_face_vertex_location =
@@ -57,8 +26,7 @@ void constrain_to_navigable_surface(
 
     if (edge_distance > 0.0f) {
       const float *const relevant_edge_coefficient =
-          edge_coefficients + relevant_face_vertex_offset * 3 +
-          vertex_index * 3;
+          relevant_edge_coefficients + vertex_index * 3;
 
       const float unclamped =
           edge_difference[0] * relevant_edge_coefficient[0] +
@@ -73,8 +41,9 @@ void constrain_to_navigable_surface(
       }
 
       const float *const next_face_vertex_location =
-          relevant_face_vertex_locations +
-          ((vertex_index + 1) % relevant_face_vertex_count) * 3;
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
 
       if (unclamped >= 1.0f) {
         constrained_location[0] = next_face_vertex_location[0];
@@ -96,3 +65,61 @@ void constrain_to_navigable_surface(
     }
   }
 }
+
+void constrain_to_navigable_surface(
+    const float *const unconstrained_location,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int face_index, float *const constrained_location) {
+  const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+  const float *const relevant_face_vertex_locations =
+      face_vertex_locations + relevant_face_vertex_offset * 3;
+
+  const float difference[] = {
+      unconstrained_location[0] - relevant_face_vertex_locations[0],
+      unconstrained_location[1] - relevant_face_vertex_locations[1],
+      unconstrained_location[2] - relevant_face_vertex_locations[2],
+  };
+
+  const float *const relevant_face_normal = face_normals + face_index * 3;
+
+  const float surface_distance = difference[0] * relevant_face_normal[0] +
+                                 difference[1] * relevant_face_normal[1] +
+                                 difference[2] * relevant_face_normal[2];
+
+  const float surface_offset[] = {
+      relevant_face_normal[0] * surface_distance,
+      relevant_face_normal[1] * surface_distance,
+      relevant_face_normal[2] * surface_distance,
+  };
+
+  constrained_location[0] = unconstrained_location[0] - surface_offset[0];
+  constrained_location[1] = unconstrained_location[1] - surface_offset[1];
+  constrained_location[2] = unconstrained_location[2] - surface_offset[2];
+
+  const float *const relevant_edge_normals =
+      edge_normals + relevant_face_vertex_offset * 3;
+  const float *const relevant_edge_coefficients =
+      edge_coefficients + relevant_face_vertex_offset * 3;
+
+  const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+  switch (relevant_face_vertex_count) {
+  case 3:
+    constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                       relevant_edge_coefficients, 3, constrained_location);
+    break;
+
+  case 4:
+    constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                       relevant_edge_coefficients, 4, constrained_location);
+    break;
+
+  default:
+    constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                       relevant_edge_coefficients, relevant_face_vertex_count,
+                       constrained_location);
+    break;
+  }
+}
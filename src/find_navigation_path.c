@@ -0,0 +1,50 @@
+#include "find_navigation_path.h"
+#include "begin_navigation_path.h"
+#include "finish_navigation_path.h"
+#include "step_navigation_path.h"
+
+int find_navigation_path(
+    const float *const start_location, const int start_face_index,
+    const float *const goal_location, const int goal_face_index,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, float *const face_costs,
+    float *const face_priorities, float *const face_entry_locations,
+    int *const face_parent_indices, int *const face_parent_link_indices,
+    int *const face_heap_positions, int *const heap,
+    const int maximum_path_length, int *const result_face_indices,
+    int *const result_link_indices) {
+  int heap_count;
+  int iteration_count = 0;
+
+  begin_navigation_path(start_location, start_face_index, face_count,
+                        face_costs, face_priorities, face_entry_locations,
+                        face_parent_indices, face_parent_link_indices,
+                        face_heap_positions, heap, &heap_count);
+
+  step_navigation_path(
+      goal_location, goal_face_index, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_edge_neighbor_counts,
+      face_edge_neighbor_offsets, face_edge_neighbor_face_indices, face_flags,
+      face_cost_multipliers, face_link_offsets, face_link_indices,
+      link_end_face_indices, link_start_locations, link_end_locations,
+      link_costs, link_flags, include_flags, exclude_flags, face_costs,
+      face_priorities, face_entry_locations, face_parent_indices,
+      face_parent_link_indices, face_heap_positions, heap, &heap_count,
+      face_count, &iteration_count);
+
+  return finish_navigation_path(goal_face_index, face_parent_indices,
+                                face_parent_link_indices, face_heap_positions,
+                                maximum_path_length, result_face_indices,
+                                result_link_indices);
+}
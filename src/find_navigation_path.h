@@ -0,0 +1,127 @@
+#ifndef FIND_NAVIGATION_PATH_H
+
+#define FIND_NAVIGATION_PATH_H
+
+/**
+ * Finds a path between two faces of a navigation mesh using A* search,
+ * crossing both the edges shared by neighboring faces and off-mesh links
+ * (such as jumps, ladders and teleporters).  Faces are entered at the midpoint
+ * of the edge crossed or at the end of the link followed, and the cost of
+ * travel is the distance between consecutive entry points plus the cost of
+ * each link followed.  As a link can be cheaper to follow than the straight
+ * line distance between its ends, the search is not guided toward the goal
+ * while links are considered, and so expands more faces.
+ * @param start_location The 3D vector describing the location to find a path
+ *                       from.  Behavior is undefined if any component is NaN,
+ *                       infinity or negative infinity.
+ * @param start_face_index The index of the face containing start_location.
+ * @param goal_location The 3D vector describing the location to find a path
+ *                      to.  Behavior is undefined if any component is NaN,
+ *                      infinity or negative infinity.
+ * @param goal_face_index The index of the face containing goal_location.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL if faces have no flags.
+ * @param face_cost_multipliers A multiplier for the distance travelled across
+ *                              each face of the navigation mesh (e.g. 3 for
+ *                              mud), or NULL if every face has a multiplier of
+ *                              1.  Paths may not be the cheapest if any is
+ *                              less than 1.  Behavior is undefined if any is
+ *                              NaN, infinity, negative infinity or negative.
+ * @param face_link_offsets The face link offsets produced by
+ *                          navigation_link_table, or NULL to ignore off-mesh
+ *                          links.
+ * @param face_link_indices The face link indices produced by
+ *                          navigation_link_table.  Ignored when
+ *                          face_link_offsets is NULL.
+ * @param link_end_face_indices The index of the face at which each link ends.
+ *                              Ignored when face_link_offsets is NULL.
+ * @param link_start_locations A 3D vector describing the location at which
+ *                             each link starts.  Ignored when
+ *                             face_link_offsets is NULL.
+ * @param link_end_locations A 3D vector describing the location at which each
+ *                           link ends.  Ignored when face_link_offsets is
+ *                           NULL.
+ * @param link_costs The cost of following each link, in addition to the
+ *                   distance travelled to reach its start.  Behavior is
+ *                   undefined if any is NaN, infinity, negative infinity or
+ *                   negative.  Ignored when face_link_offsets is NULL.
+ * @param link_flags Flags describing each link (e.g. 1 for jumps, 2 for
+ *                   ladders), or NULL if links have no flags.  Ignored when
+ *                   face_link_offsets is NULL.
+ * @param include_flags Only faces (other than the start face) and links with
+ *                      at least one of these flags are entered, where
+ *                      face_flags or link_flags respectively is not NULL.
+ * @param exclude_flags Faces (other than the start face) and links with any of
+ *                      these flags are not entered, where face_flags or
+ *                      link_flags respectively is not NULL.
+ * @param face_costs Used as temporary storage.  Must have space for face_count
+ *                   values.
+ * @param face_priorities Used as temporary storage.  Must have space for
+ *                        face_count values.
+ * @param face_entry_locations Used as temporary storage.  Must have space for
+ *                             face_count 3D vectors.
+ * @param face_parent_indices Used as temporary storage.  Must have space for
+ *                            face_count values.
+ * @param face_parent_link_indices Used as temporary storage.  Must have space
+ *                                 for face_count values.
+ * @param face_heap_positions Used as temporary storage.  Must have space for
+ *                            face_count values.
+ * @param heap Used as temporary storage.  Must have space for face_count
+ *             values.
+ * @param maximum_path_length The number of faces which result_face_indices and
+ *                            result_link_indices have space for.
+ * @param result_face_indices Overwritten with the index of each face along the
+ *                            path, starting with start_face_index and ending
+ *                            with goal_face_index.  Not written at all when
+ *                            the return value exceeds maximum_path_length.
+ * @param result_link_indices Overwritten with the index of the link followed to
+ *                            enter each face along the path, or -1 where the
+ *                            face was entered by crossing an edge (and for the
+ *                            first face).  Not written at all when the return
+ *                            value exceeds maximum_path_length.
+ * @return The number of faces along the path, which may exceed
+ *         maximum_path_length, or -1 if no path exists.
+ */
+int find_navigation_path(
+    const float *const start_location, const int start_face_index,
+    const float *const goal_location, const int goal_face_index,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, float *const face_costs,
+    float *const face_priorities, float *const face_entry_locations,
+    int *const face_parent_indices, int *const face_parent_link_indices,
+    int *const face_heap_positions, int *const heap,
+    const int maximum_path_length, int *const result_face_indices,
+    int *const result_link_indices);
+
+#endif
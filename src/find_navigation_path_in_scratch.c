@@ -0,0 +1,73 @@
+#include "find_navigation_path_in_scratch.h"
+#include "allocate_navigation_scratch.h"
+#include "find_navigation_path.h"
+#include "navigation_scratch.h"
+#include <stddef.h>
+
+int find_navigation_path_in_scratch(
+    const float *const start_location, const int start_face_index,
+    const float *const goal_location, const int goal_face_index,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, unsigned char *const scratch,
+    const int scratch_capacity, int *const scratch_used,
+    const int maximum_path_length, int *const result_face_indices,
+    int *const result_link_indices) {
+  const int mark = *scratch_used;
+  const int float_array_size = (int)sizeof(float) * face_count;
+  const int int_array_size = (int)sizeof(int) * face_count;
+
+  float *const face_costs = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, float_array_size,
+      (int)sizeof(float));
+  float *const face_priorities = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, float_array_size,
+      (int)sizeof(float));
+  float *const face_entry_locations = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, float_array_size * 3,
+      (int)sizeof(float));
+  int *const face_parent_indices = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, int_array_size,
+      (int)sizeof(int));
+  int *const face_parent_link_indices = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, int_array_size,
+      (int)sizeof(int));
+  int *const face_heap_positions = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, int_array_size,
+      (int)sizeof(int));
+  int *const heap = allocate_navigation_scratch(
+      scratch, scratch_capacity, scratch_used, int_array_size,
+      (int)sizeof(int));
+
+  int output = NAVIGATION_SCRATCH_EXHAUSTED;
+
+  if (face_costs != NULL && face_priorities != NULL &&
+      face_entry_locations != NULL && face_parent_indices != NULL &&
+      face_parent_link_indices != NULL && face_heap_positions != NULL &&
+      heap != NULL) {
+    output = find_navigation_path(
+        start_location, start_face_index, goal_location, goal_face_index,
+        face_count, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_edge_neighbor_counts,
+        face_edge_neighbor_offsets, face_edge_neighbor_face_indices,
+        face_flags, face_cost_multipliers, face_link_offsets,
+        face_link_indices, link_end_face_indices, link_start_locations,
+        link_end_locations, link_costs, link_flags, include_flags,
+        exclude_flags, face_costs, face_priorities, face_entry_locations,
+        face_parent_indices, face_parent_link_indices, face_heap_positions,
+        heap, maximum_path_length, result_face_indices, result_link_indices);
+  }
+
+  *scratch_used = mark;
+  return output;
+}
@@ -0,0 +1,39 @@
+#ifndef FIND_NAVIGATION_PATH_IN_SCRATCH_H
+
+#define FIND_NAVIGATION_PATH_IN_SCRATCH_H
+
+/**
+ * Calls find_navigation_path, allocating its temporary storage from scratch
+ * memory (see allocate_navigation_scratch) rather than requiring a separate
+ * buffer for each.  The allocations are released before returning.
+ * Parameters and return value are otherwise identical to those of
+ * find_navigation_path.
+ * @param scratch The block of memory from which to allocate.
+ * @param scratch_capacity The number of bytes in scratch.  Sufficient space is
+ *                         guaranteed by find_navigation_path_scratch_size.
+ * @param scratch_used The number of bytes of scratch allocated so far, which is
+ *                     unchanged upon return.
+ * @return As find_navigation_path, or NAVIGATION_SCRATCH_EXHAUSTED should
+ *         there not be enough space remaining in scratch.
+ */
+int find_navigation_path_in_scratch(
+    const float *const start_location, const int start_face_index,
+    const float *const goal_location, const int goal_face_index,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, unsigned char *const scratch,
+    const int scratch_capacity, int *const scratch_used,
+    const int maximum_path_length, int *const result_face_indices,
+    int *const result_link_indices);
+
+#endif
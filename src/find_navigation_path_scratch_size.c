@@ -0,0 +1,11 @@
+#include "find_navigation_path_scratch_size.h"
+
+static int array_size(const int count, const int element_size) {
+  return count * element_size + element_size - 1;
+}
+
+int find_navigation_path_scratch_size(const int face_count) {
+  return array_size(face_count, (int)sizeof(float)) * 2 +
+         array_size(face_count * 3, (int)sizeof(float)) +
+         array_size(face_count, (int)sizeof(int)) * 4;
+}
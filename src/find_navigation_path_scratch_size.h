@@ -0,0 +1,14 @@
+#ifndef FIND_NAVIGATION_PATH_SCRATCH_SIZE_H
+
+#define FIND_NAVIGATION_PATH_SCRATCH_SIZE_H
+
+/**
+ * Calculates the number of bytes of scratch memory which is always sufficient
+ * for find_navigation_path_in_scratch, regardless of the alignment of the
+ * scratch memory.
+ * @param face_count The number of faces in the navigation mesh.
+ * @return The number of bytes required.
+ */
+int find_navigation_path_scratch_size(const int face_count);
+
+#endif
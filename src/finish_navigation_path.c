@@ -0,0 +1,35 @@
+#include "finish_navigation_path.h"
+
+int finish_navigation_path(const int goal_face_index,
+                           const int *const face_parent_indices,
+                           const int *const face_parent_link_indices,
+                           const int *const face_heap_positions,
+                           const int maximum_path_length,
+                           int *const result_face_indices,
+                           int *const result_link_indices) {
+  if (face_heap_positions[goal_face_index] != -2) {
+    return -1;
+  }
+
+  int output = 0;
+
+  for (int face_index = goal_face_index; face_index != -1;
+       face_index = face_parent_indices[face_index]) {
+    output++;
+  }
+
+  if (output > maximum_path_length) {
+    return output;
+  }
+
+  int path_index = output;
+
+  for (int face_index = goal_face_index; face_index != -1;
+       face_index = face_parent_indices[face_index]) {
+    path_index--;
+    result_face_indices[path_index] = face_index;
+    result_link_indices[path_index] = face_parent_link_indices[face_index];
+  }
+
+  return output;
+}
@@ -0,0 +1,36 @@
+#ifndef FINISH_NAVIGATION_PATH_H
+
+#define FINISH_NAVIGATION_PATH_H
+
+/**
+ * Retrieves the path found by a search begun using begin_navigation_path and
+ * advanced using step_navigation_path.
+ * @param goal_face_index The index of the face containing the goal location.
+ * @param face_parent_indices The search state given to step_navigation_path.
+ * @param face_parent_link_indices The search state given to
+ *                                 step_navigation_path.
+ * @param face_heap_positions The search state given to step_navigation_path.
+ * @param maximum_path_length The number of faces which result_face_indices and
+ *                            result_link_indices have space for.
+ * @param result_face_indices Overwritten with the index of each face along the
+ *                            path, starting with the start face and ending
+ *                            with goal_face_index.  Not written at all when
+ *                            the return value exceeds maximum_path_length.
+ * @param result_link_indices Overwritten with the index of the link followed to
+ *                            enter each face along the path, or -1 where the
+ *                            face was entered by crossing an edge (and for the
+ *                            first face).  Not written at all when the return
+ *                            value exceeds maximum_path_length.
+ * @return The number of faces along the path, which may exceed
+ *         maximum_path_length, or -1 if the search has not (or not yet) reached
+ *         goal_face_index.
+ */
+int finish_navigation_path(const int goal_face_index,
+                           const int *const face_parent_indices,
+                           const int *const face_parent_link_indices,
+                           const int *const face_heap_positions,
+                           const int maximum_path_length,
+                           int *const result_face_indices,
+                           int *const result_link_indices);
+
+#endif
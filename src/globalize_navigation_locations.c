@@ -0,0 +1,12 @@
+#include "globalize_navigation_locations.h"
+
+void globalize_navigation_locations(const int location_count,
+                                    const float *const tile_locations,
+                                    const double *const tile_origin,
+                                    double *const world_locations) {
+  for (int index = 0; index < location_count * 3; index += 3) {
+    world_locations[index] = tile_origin[0] + tile_locations[index];
+    world_locations[index + 1] = tile_origin[1] + tile_locations[index + 1];
+    world_locations[index + 2] = tile_origin[2] + tile_locations[index + 2];
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef GLOBALIZE_NAVIGATION_LOCATIONS_H
+
+#define GLOBALIZE_NAVIGATION_LOCATIONS_H
+
+/**
+ * Converts single-precision locations relative to the origin of a tile (see
+ * localize_navigation_locations) back to double-precision world-space
+ * locations.
+ * @param location_count The number of locations to convert.
+ * @param tile_locations A 3D vector describing each location relative to
+ *                       tile_origin.  Behavior is undefined if any component is
+ *                       NaN, infinity or negative infinity.
+ * @param tile_origin A 3D vector describing the location of the tile's origin
+ *                    in world space.  Behavior is undefined if any component is
+ *                    NaN, infinity or negative infinity.
+ * @param world_locations Overwritten with a 3D vector describing each location
+ *                        in world space.
+ */
+void globalize_navigation_locations(const int location_count,
+                                    const float *const tile_locations,
+                                    const double *const tile_origin,
+                                    double *const world_locations);
+
+#endif
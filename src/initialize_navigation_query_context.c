@@ -0,0 +1,12 @@
+#include "initialize_navigation_query_context.h"
+
+void initialize_navigation_query_context(
+    unsigned char *const scratch, const int scratch_capacity,
+    union navigation_query_context *const context) {
+  context->state.scratch = scratch;
+  context->state.scratch_capacity = scratch_capacity;
+  context->state.scratch_used = 0;
+  context->state.face_index_hint = -1;
+  context->state.query_count = 0;
+  context->state.scratch_exhausted_count = 0;
+}
@@ -0,0 +1,19 @@
+#ifndef INITIALIZE_NAVIGATION_QUERY_CONTEXT_H
+
+#define INITIALIZE_NAVIGATION_QUERY_CONTEXT_H
+
+#include "navigation_query_context.h"
+
+/**
+ * Prepares a navigation_query_context for use by one thread.
+ * @param scratch The block of memory from which queries made using the context
+ *                allocate temporary storage.  Must not be shared with any
+ *                other context.
+ * @param scratch_capacity The number of bytes in scratch.
+ * @param context Overwritten with an empty context using scratch.
+ */
+void initialize_navigation_query_context(
+    unsigned char *const scratch, const int scratch_capacity,
+    union navigation_query_context *const context);
+
+#endif
@@ -0,0 +1,34 @@
+#include "instanced_closest_navigable_face.h"
+#include "closest_navigable_face.h"
+
+static void to_local(const float *const instance_transform,
+                     const float *const world, float *const local) {
+  const float delta[] = {
+      world[0] - instance_transform[9],
+      world[1] - instance_transform[10],
+      world[2] - instance_transform[11],
+  };
+
+  for (int axis = 0; axis < 3; axis++) {
+    const float *const relevant_axis = instance_transform + axis * 3;
+
+    local[axis] = delta[0] * relevant_axis[0] + delta[1] * relevant_axis[1] +
+                  delta[2] * relevant_axis[2];
+  }
+}
+
+int instanced_closest_navigable_face(
+    const float *const location, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const float *const instance_transform, const int *const face_flags,
+    const int include_flags, const int exclude_flags) {
+  float local_location[3];
+  to_local(instance_transform, location, local_location);
+
+  return closest_navigable_face(
+      local_location, face_count, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+      face_flags, include_flags, exclude_flags);
+}
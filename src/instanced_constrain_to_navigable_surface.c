@@ -0,0 +1,46 @@
+#include "instanced_constrain_to_navigable_surface.h"
+#include "constrain_to_navigable_surface.h"
+
+static void to_local(const float *const instance_transform,
+                     const float *const world, float *const local) {
+  const float delta[] = {
+      world[0] - instance_transform[9],
+      world[1] - instance_transform[10],
+      world[2] - instance_transform[11],
+  };
+
+  for (int axis = 0; axis < 3; axis++) {
+    const float *const relevant_axis = instance_transform + axis * 3;
+
+    local[axis] = delta[0] * relevant_axis[0] + delta[1] * relevant_axis[1] +
+                  delta[2] * relevant_axis[2];
+  }
+}
+
+static void to_world(const float *const instance_transform,
+                     const float *const local, float *const world) {
+  for (int component = 0; component < 3; component++) {
+    world[component] = instance_transform[9 + component] +
+                       local[0] * instance_transform[component] +
+                       local[1] * instance_transform[3 + component] +
+                       local[2] * instance_transform[6 + component];
+  }
+}
+
+void instanced_constrain_to_navigable_surface(
+    const float *const unconstrained_location,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const float *const instance_transform, const int face_index,
+    float *const constrained_location) {
+  float local_location[3];
+  to_local(instance_transform, unconstrained_location, local_location);
+
+  constrain_to_navigable_surface(local_location, face_vertex_counts,
+                                 face_vertex_offsets, face_vertex_locations,
+                                 face_normals, edge_normals, edge_coefficients,
+                                 face_index, local_location);
+
+  to_world(instance_transform, local_location, constrained_location);
+}
@@ -0,0 +1,57 @@
+#ifndef INSTANCED_CONSTRAIN_TO_NAVIGABLE_SURFACE_H
+
+#define INSTANCED_CONSTRAIN_TO_NAVIGABLE_SURFACE_H
+
+/**
+ * Constrains a given location to the surface of its containing navigation
+ * face, as constrain_to_navigable_surface does, for an instance of a
+ * navigation mesh which has been placed in the world using a rigid transform
+ * (see instanced_closest_navigable_face).
+ * @param unconstrained_location The 3D vector describing the location to
+ *                               constrain to the surface of the containing
+ *                               navigation face, in world space.  Behavior is
+ *                               undefined if any component is NaN, infinity
+ *                               or negative infinity.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh,
+ *                              in its local space.  Behavior is undefined if
+ *                              any component is NaN, infinity or negative
+ *                              infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh, in its local space.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face, in its local space.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh, in its local space.  Each points
+ *                          to the next vertex of the face, with a magnitude
+ *                          equal to the reciprocal of the distance to that
+ *                          vertex.
+ * @param instance_transform The rigid transform from the local space of the
+ *                           navigation mesh to world space: 3D unit vectors
+ *                           describing the local X, Y and Z axes in world
+ *                           space (which must be perpendicular to one
+ *                           another), followed by a 3D vector describing the
+ *                           location of the local origin in world space.
+ * @param face_index The index of the face to which the location is to be
+ *                   constrained.
+ * @param constrained_location The 3D vector which is overwritten with the
+ *                             resulting location, in world space.  May overlap
+ *                             with the unconstrained location.
+ */
+void instanced_constrain_to_navigable_surface(
+    const float *const unconstrained_location,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const float *const instance_transform, const int face_index,
+    float *const constrained_location);
+
+#endif
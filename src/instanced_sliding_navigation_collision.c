@@ -0,0 +1,53 @@
+#include "instanced_sliding_navigation_collision.h"
+#include "sliding_navigation_collision.h"
+
+static void to_local(const float *const instance_transform,
+                     const float *const world, float *const local) {
+  const float delta[] = {
+      world[0] - instance_transform[9],
+      world[1] - instance_transform[10],
+      world[2] - instance_transform[11],
+  };
+
+  for (int axis = 0; axis < 3; axis++) {
+    const float *const relevant_axis = instance_transform + axis * 3;
+
+    local[axis] = delta[0] * relevant_axis[0] + delta[1] * relevant_axis[1] +
+                  delta[2] * relevant_axis[2];
+  }
+}
+
+static void to_world(const float *const instance_transform,
+                     const float *const local, float *const world) {
+  for (int component = 0; component < 3; component++) {
+    world[component] = instance_transform[9 + component] +
+                       local[0] * instance_transform[component] +
+                       local[1] * instance_transform[3 + component] +
+                       local[2] * instance_transform[6 + component];
+  }
+}
+
+int instanced_sliding_navigation_collision(
+    const float *const from, const int face_index, const float *const to,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts,
+    const float *const instance_transform, float *const result_from,
+    float *const result_to, int *const edge_index) {
+  float local_from[3];
+  float local_to[3];
+  to_local(instance_transform, from, local_from);
+  to_local(instance_transform, to, local_to);
+
+  const int output = sliding_navigation_collision(
+      local_from, face_index, local_to, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals,
+      edge_exit_normals, face_edge_neighbor_counts, local_from, local_to,
+      edge_index);
+
+  to_world(instance_transform, local_from, result_from);
+  to_world(instance_transform, local_to, result_to);
+
+  return output;
+}
@@ -0,0 +1,87 @@
+#ifndef INSTANCED_SLIDING_NAVIGATION_COLLISION_H
+
+#define INSTANCED_SLIDING_NAVIGATION_COLLISION_H
+
+/**
+ * Performs a single iteration of sliding collision, as
+ * sliding_navigation_collision does, against an instance of a navigation mesh
+ * which has been placed in the world using a rigid transform (see
+ * instanced_closest_navigable_face).
+ * @param from The 3D vector describing the point the object is traveling from,
+ *             in world space.  Behavior is undefined if outside of the face's
+ *             volume or if any component is NaN, infinity or negative
+ *             infinity.
+ * @param face_index The index of the face within which an iteration of sliding
+ *                   collision is to be performed.
+ * @param to The 3D vector describing the point the object is traveling to, in
+ *           world space.  Behavior is undefined if any component is NaN,
+ *           infinity or negative infinity.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh,
+ *                              in its local space.  Behavior is undefined if
+ *                              any component is NaN, infinity or negative
+ *                              infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh, in its local space.
+ * @param edge_exit_normals A 3D unit vector perpendicular to each edge of each
+ *                          face of the navigation mesh, pointing out of the
+ *                          face into a hypothetical neighboring face, in its
+ *                          local space.  Where no neighbors exist, this is
+ *                          perpendicular to the face's surface normal.  It is
+ *                          otherwise averaged with the neighboring edge exit
+ *                          normals to ensure that there is a consistent plane
+ *                          to cross to enter or exit the face.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param instance_transform The rigid transform from the local space of the
+ *                           navigation mesh to world space: 3D unit vectors
+ *                           describing the local X, Y and Z axes in world
+ *                           space (which must be perpendicular to one
+ *                           another), followed by a 3D vector describing the
+ *                           location of the local origin in world space.
+ * @param result_from Overwritten, in world space, depending upon the result:
+ *                    - None: Equal to "from".
+ *                    - Surface: Equal to the point of impact, for "sticky"
+ *                               collision.
+ *                    - Edge (without neighbors): Equal to the point of impact,
+ *                                                for "sticky" collision.
+ *                    - Other (with neighbors): Equal to the point at which the
+ *                                              motion crossed into the
+ *                                              neighboring face, for "sticky"
+ *                                              collision.
+ *                    May be "from".
+ * @param result_to Overwritten, in world space, depending upon the result:
+ *                  - None: Equal to "to".
+ *                  - Surface: Equal to "to" projected onto the surface, for
+ *                             "sliding" collision.  May land outside the volume
+ *                             of the face.
+ *                  - Edge (without neighbors): Equal to "to" projected onto the
+ *                                              plane of the edge, for "sliding"
+ *                                              collision.  May land outside the
+ *                                              volume of the face.
+ *                  - Other (with neighbors): Equal to "to" projected onto the
+ *                                            corresponding edge, for "sliding"
+ *                                            collision.
+ *                  May be "to".
+ * @param edge_index Overwritten depending upon the result:
+ *                   - None: Undefined.
+ *                   - Surface: Undefined.
+ *                   - Edge: The index of the edge crossed or collided with.
+ * @return A sliding navigation collision result.
+ */
+int instanced_sliding_navigation_collision(
+    const float *const from, const int face_index, const float *const to,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts,
+    const float *const instance_transform, float *const result_from,
+    float *const result_to, int *const edge_index);
+
+#endif
@@ -0,0 +1,14 @@
+#include "localize_navigation_locations.h"
+
+void localize_navigation_locations(const int location_count,
+                                   const double *const world_locations,
+                                   const double *const tile_origin,
+                                   float *const tile_locations) {
+  for (int index = 0; index < location_count * 3; index += 3) {
+    tile_locations[index] = (float)(world_locations[index] - tile_origin[0]);
+    tile_locations[index + 1] =
+        (float)(world_locations[index + 1] - tile_origin[1]);
+    tile_locations[index + 2] =
+        (float)(world_locations[index + 2] - tile_origin[2]);
+  }
+}
@@ -0,0 +1,31 @@
+#ifndef LOCALIZE_NAVIGATION_LOCATIONS_H
+
+#define LOCALIZE_NAVIGATION_LOCATIONS_H
+
+/**
+ * Converts double-precision world-space locations to single-precision
+ * locations relative to the origin of a tile.  Far from the world origin,
+ * single-precision floats cannot represent the small distances which the
+ * navigation functions depend upon (such as the offset which
+ * sliding_navigation_collision keeps from edges).  Storing each tile of a
+ * large world as its own navigation mesh, baked in coordinates relative to its
+ * origin, and converting query locations into and out of that space (see
+ * globalize_navigation_locations) keeps every calculation close to zero, where
+ * precision is highest.  Meshes near the world origin can continue to use
+ * world-space floats directly.
+ * @param location_count The number of locations to convert.
+ * @param world_locations A 3D vector describing each location in world space.
+ *                        Behavior is undefined if any component is NaN,
+ *                        infinity or negative infinity.
+ * @param tile_origin A 3D vector describing the location of the tile's origin
+ *                    in world space.  Behavior is undefined if any component is
+ *                    NaN, infinity or negative infinity.
+ * @param tile_locations Overwritten with a 3D vector describing each location
+ *                       relative to tile_origin.
+ */
+void localize_navigation_locations(const int location_count,
+                                   const double *const world_locations,
+                                   const double *const tile_origin,
+                                   float *const tile_locations);
+
+#endif
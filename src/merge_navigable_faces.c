@@ -0,0 +1,482 @@
+#include "merge_navigable_faces.h"
+#include "rebake_navigable_faces.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static bool vertices_match(const float *const a, const float *const b) {
+  return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+static int classify_vertex(const int vertex_count,
+                           const float *const vertex_locations,
+                           const int vertex_index, const float *const normal) {
+  const float *const relevant_location = vertex_locations + vertex_index * 3;
+  const float *const previous_location =
+      vertex_index == 0 ? vertex_locations + (vertex_count - 1) * 3
+                        : relevant_location - 3;
+  const float *const next_location = vertex_index == vertex_count - 1
+                                         ? vertex_locations
+                                         : relevant_location + 3;
+
+  const float incoming[] = {
+      relevant_location[0] - previous_location[0],
+      relevant_location[1] - previous_location[1],
+      relevant_location[2] - previous_location[2],
+  };
+
+  const float outgoing[] = {
+      next_location[0] - relevant_location[0],
+      next_location[1] - relevant_location[1],
+      next_location[2] - relevant_location[2],
+  };
+
+  const float cross[] = {
+      incoming[1] * outgoing[2] - incoming[2] * outgoing[1],
+      incoming[2] * outgoing[0] - incoming[0] * outgoing[2],
+      incoming[0] * outgoing[1] - incoming[1] * outgoing[0],
+  };
+
+  const float incoming_squared = incoming[0] * incoming[0] +
+                                 incoming[1] * incoming[1] +
+                                 incoming[2] * incoming[2];
+
+  const float outgoing_squared = outgoing[0] * outgoing[0] +
+                                 outgoing[1] * outgoing[1] +
+                                 outgoing[2] * outgoing[2];
+
+  const float threshold = 0.00000001f * incoming_squared * outgoing_squared;
+
+  if (cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2] <=
+      threshold) {
+    const float along = incoming[0] * outgoing[0] +
+                        incoming[1] * outgoing[1] +
+                        incoming[2] * outgoing[2];
+
+    return along > 0.0f ? 0 : -1;
+  }
+
+  const float turn =
+      cross[0] * normal[0] + cross[1] * normal[1] + cross[2] * normal[2];
+
+  return turn > 0.0f || turn * turn <= threshold ? 1 : -1;
+}
+
+static int join_rings(const int vertex_count_a,
+                      const float *const vertex_locations_a,
+                      const int vertex_count_b,
+                      const float *const vertex_locations_b,
+                      const float *const normal,
+                      float *const joined_vertex_locations,
+                      int *const joined_vertex_count) {
+  for (int edge_a = 0; edge_a < vertex_count_a; edge_a++) {
+    const float *const start_a = vertex_locations_a + edge_a * 3;
+    const float *const end_a =
+        edge_a == vertex_count_a - 1 ? vertex_locations_a : start_a + 3;
+
+    for (int edge_b = 0; edge_b < vertex_count_b; edge_b++) {
+      const float *const start_b = vertex_locations_b + edge_b * 3;
+      const float *const end_b =
+          edge_b == vertex_count_b - 1 ? vertex_locations_b : start_b + 3;
+
+      if (!vertices_match(start_a, end_b) || !vertices_match(end_a, start_b)) {
+        continue;
+      }
+
+      int count = 0;
+      int vertex_index = edge_a;
+
+      for (int copied = 0; copied < vertex_count_a; copied++) {
+        vertex_index =
+            vertex_index == vertex_count_a - 1 ? 0 : vertex_index + 1;
+
+        const float *const relevant_location =
+            vertex_locations_a + vertex_index * 3;
+        float *const joined_location = joined_vertex_locations + count * 3;
+
+        joined_location[0] = relevant_location[0];
+        joined_location[1] = relevant_location[1];
+        joined_location[2] = relevant_location[2];
+        count++;
+      }
+
+      vertex_index = edge_b == vertex_count_b - 1 ? 0 : edge_b + 1;
+
+      for (int copied = 2; copied < vertex_count_b; copied++) {
+        vertex_index =
+            vertex_index == vertex_count_b - 1 ? 0 : vertex_index + 1;
+
+        const float *const relevant_location =
+            vertex_locations_b + vertex_index * 3;
+        float *const joined_location = joined_vertex_locations + count * 3;
+
+        joined_location[0] = relevant_location[0];
+        joined_location[1] = relevant_location[1];
+        joined_location[2] = relevant_location[2];
+        count++;
+      }
+
+      *joined_vertex_count = count;
+
+      int kept_count = 0;
+
+      for (vertex_index = 0; vertex_index < count; vertex_index++) {
+        const int classification = classify_vertex(
+            count, joined_vertex_locations, vertex_index, normal);
+
+        if (classification < 0) {
+          return 0;
+        }
+
+        kept_count += classification;
+      }
+
+      return kept_count;
+    }
+  }
+
+  return 0;
+}
+
+static bool within_plane(const int vertex_count,
+                         const float *const vertex_locations,
+                         const float maximum_plane_distance) {
+  float normal[] = {0.0f, 0.0f, 0.0f};
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float *const next_location = vertex_index == vertex_count - 1
+                                           ? vertex_locations
+                                           : relevant_location + 3;
+
+    normal[0] += (relevant_location[1] - next_location[1]) *
+                 (relevant_location[2] + next_location[2]);
+    normal[1] += (relevant_location[2] - next_location[2]) *
+                 (relevant_location[0] + next_location[0]);
+    normal[2] += (relevant_location[0] - next_location[0]) *
+                 (relevant_location[1] + next_location[1]);
+  }
+
+  const float limit_squared =
+      maximum_plane_distance * maximum_plane_distance *
+      (normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+  for (int vertex_index = 1; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+
+    const float distance =
+        (relevant_location[0] - vertex_locations[0]) * normal[0] +
+        (relevant_location[1] - vertex_locations[1]) * normal[1] +
+        (relevant_location[2] - vertex_locations[2]) * normal[2];
+
+    if (distance * distance > limit_squared) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static bool lies_along(const float *const start, const float *const end,
+                       const float *const location) {
+  const float direction[] = {
+      end[0] - start[0],
+      end[1] - start[1],
+      end[2] - start[2],
+  };
+
+  const float offset[] = {
+      location[0] - start[0],
+      location[1] - start[1],
+      location[2] - start[2],
+  };
+
+  const float cross[] = {
+      direction[1] * offset[2] - direction[2] * offset[1],
+      direction[2] * offset[0] - direction[0] * offset[2],
+      direction[0] * offset[1] - direction[1] * offset[0],
+  };
+
+  const float length_squared = direction[0] * direction[0] +
+                               direction[1] * direction[1] +
+                               direction[2] * direction[2];
+
+  const float along = direction[0] * offset[0] + direction[1] * offset[1] +
+                      direction[2] * offset[2];
+
+  return cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2] <=
+             0.00000001f * length_squared * length_squared &&
+         along >= -0.0001f * length_squared &&
+         along <= 1.0001f * length_squared;
+}
+
+int merge_navigable_faces(
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int maximum_vertex_count,
+    const float minimum_normal_dot, const float maximum_plane_distance,
+    int *const face_groups, int *const face_next_members,
+    int *const group_vertex_counts, float *const group_vertex_locations,
+    int *const result_face_indices, int *const result_face_vertex_counts,
+    int *const result_face_vertex_offsets,
+    float *const result_face_vertex_locations, float *const result_face_normals,
+    float *const result_edge_normals, float *const result_edge_exit_normals,
+    float *const result_edge_coefficients,
+    float *const result_vertex_up_normals,
+    int *const result_face_edge_neighbor_counts,
+    int *const result_face_edge_neighbor_offsets,
+    int *const result_face_edge_neighbor_face_indices,
+    int *const result_face_flags) {
+  const int group_stride = maximum_vertex_count * 3;
+  float *const joined_vertex_locations =
+      group_vertex_locations + face_count * group_stride;
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + face_vertex_offsets[face_index] * 3;
+    float *const relevant_group_vertex_locations =
+        group_vertex_locations + face_index * group_stride;
+
+    for (int component = 0; component < relevant_face_vertex_count * 3;
+         component++) {
+      relevant_group_vertex_locations[component] =
+          relevant_face_vertex_locations[component];
+    }
+
+    face_groups[face_index] = face_index;
+    face_next_members[face_index] = -1;
+    group_vertex_counts[face_index] = relevant_face_vertex_count;
+  }
+
+  for (int group_index = 0; group_index < face_count; group_index++) {
+    const float *const relevant_group_normal = face_normals + group_index * 3;
+    float *const relevant_group_vertex_locations =
+        group_vertex_locations + group_index * group_stride;
+    bool merged = true;
+
+    while (merged && group_vertex_counts[group_index] > 0) {
+      merged = false;
+
+      for (int member_index = group_index; member_index != -1 && !merged;
+           member_index = face_next_members[member_index]) {
+        const int relevant_face_vertex_offset =
+            face_vertex_offsets[member_index];
+        const int last_edge_index = relevant_face_vertex_offset +
+                                    face_vertex_counts[member_index] - 1;
+        const int neighbor_end = face_edge_neighbor_offsets[last_edge_index] +
+                                 face_edge_neighbor_counts[last_edge_index];
+
+        for (int neighbor_index =
+                 face_edge_neighbor_offsets[relevant_face_vertex_offset];
+             neighbor_index < neighbor_end && !merged; neighbor_index++) {
+          const int other_group_index =
+              face_groups[face_edge_neighbor_face_indices[neighbor_index]];
+          const float *const other_group_normal =
+              face_normals + other_group_index * 3;
+
+          if (other_group_index == group_index ||
+              (face_flags != NULL &&
+               face_flags[other_group_index] != face_flags[group_index]) ||
+              relevant_group_normal[0] * other_group_normal[0] +
+                      relevant_group_normal[1] * other_group_normal[1] +
+                      relevant_group_normal[2] * other_group_normal[2] <
+                  minimum_normal_dot) {
+            continue;
+          }
+
+          int joined_vertex_count = 0;
+
+          const int kept_vertex_count = join_rings(
+              group_vertex_counts[group_index],
+              relevant_group_vertex_locations,
+              group_vertex_counts[other_group_index],
+              group_vertex_locations + other_group_index * group_stride,
+              relevant_group_normal, joined_vertex_locations,
+              &joined_vertex_count);
+
+          if (kept_vertex_count < 3 ||
+              kept_vertex_count > maximum_vertex_count) {
+            continue;
+          }
+
+          int written_vertex_count = 0;
+
+          for (int vertex_index = 0; vertex_index < joined_vertex_count;
+               vertex_index++) {
+            if (classify_vertex(joined_vertex_count, joined_vertex_locations,
+                                vertex_index, relevant_group_normal) == 0) {
+              continue;
+            }
+
+            const float *const relevant_location =
+                joined_vertex_locations + vertex_index * 3;
+            float *const written_location =
+                joined_vertex_locations + written_vertex_count * 3;
+
+            written_location[0] = relevant_location[0];
+            written_location[1] = relevant_location[1];
+            written_location[2] = relevant_location[2];
+            written_vertex_count++;
+          }
+
+          if (!within_plane(kept_vertex_count, joined_vertex_locations,
+                            maximum_plane_distance)) {
+            continue;
+          }
+
+          for (int component = 0; component < kept_vertex_count * 3;
+               component++) {
+            relevant_group_vertex_locations[component] =
+                joined_vertex_locations[component];
+          }
+
+          group_vertex_counts[group_index] = kept_vertex_count;
+          group_vertex_counts[other_group_index] = 0;
+
+          int tail_index = other_group_index;
+
+          for (int absorbed_index = other_group_index; absorbed_index != -1;
+               absorbed_index = face_next_members[absorbed_index]) {
+            face_groups[absorbed_index] = group_index;
+            tail_index = absorbed_index;
+          }
+
+          face_next_members[tail_index] = face_next_members[group_index];
+          face_next_members[group_index] = other_group_index;
+          merged = true;
+        }
+      }
+    }
+  }
+
+  int result_face_count = 0;
+
+  for (int group_index = 0; group_index < face_count; group_index++) {
+    if (group_vertex_counts[group_index] > 0) {
+      result_face_indices[group_index] = result_face_count;
+      result_face_count++;
+    }
+  }
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    if (face_groups[face_index] != face_index) {
+      result_face_indices[face_index] =
+          result_face_indices[face_groups[face_index]];
+    }
+  }
+
+  int result_vertex_count = 0;
+  int result_neighbor_count = 0;
+
+  for (int group_index = 0; group_index < face_count; group_index++) {
+    const int relevant_group_vertex_count = group_vertex_counts[group_index];
+    const float *const relevant_group_vertex_locations =
+        group_vertex_locations + group_index * group_stride;
+    const int result_face_index = result_face_indices[group_index];
+
+    if (relevant_group_vertex_count == 0) {
+      continue;
+    }
+
+    result_face_vertex_counts[result_face_index] = relevant_group_vertex_count;
+    result_face_vertex_offsets[result_face_index] = result_vertex_count;
+
+    if (face_flags != NULL) {
+      result_face_flags[result_face_index] = face_flags[group_index];
+    }
+
+    for (int vertex_index = 0; vertex_index < relevant_group_vertex_count;
+         vertex_index++) {
+      const float *const start_location =
+          relevant_group_vertex_locations + vertex_index * 3;
+      const float *const end_location =
+          vertex_index == relevant_group_vertex_count - 1
+              ? relevant_group_vertex_locations
+              : start_location + 3;
+      const int edge_index = result_vertex_count + vertex_index;
+      float *const result_location =
+          result_face_vertex_locations + edge_index * 3;
+
+      result_location[0] = start_location[0];
+      result_location[1] = start_location[1];
+      result_location[2] = start_location[2];
+      result_face_edge_neighbor_offsets[edge_index] = result_neighbor_count;
+      result_face_edge_neighbor_counts[edge_index] = 0;
+
+      for (int member_index = group_index; member_index != -1;
+           member_index = face_next_members[member_index]) {
+        const int relevant_face_vertex_count =
+            face_vertex_counts[member_index];
+        const int relevant_face_vertex_offset =
+            face_vertex_offsets[member_index];
+
+        for (int member_vertex_index = 0;
+             member_vertex_index < relevant_face_vertex_count;
+             member_vertex_index++) {
+          const int member_edge_index =
+              relevant_face_vertex_offset + member_vertex_index;
+          const float *const member_start_location =
+              face_vertex_locations + member_edge_index * 3;
+          const float *const member_end_location =
+              member_vertex_index == relevant_face_vertex_count - 1
+                  ? face_vertex_locations + relevant_face_vertex_offset * 3
+                  : member_start_location + 3;
+
+          if (!lies_along(start_location, end_location,
+                          member_start_location) ||
+              !lies_along(start_location, end_location, member_end_location)) {
+            continue;
+          }
+
+          const int neighbor_end =
+              face_edge_neighbor_offsets[member_edge_index] +
+              face_edge_neighbor_counts[member_edge_index];
+
+          for (int neighbor_index =
+                   face_edge_neighbor_offsets[member_edge_index];
+               neighbor_index < neighbor_end; neighbor_index++) {
+            const int neighbor_face_index = result_face_indices
+                [face_edge_neighbor_face_indices[neighbor_index]];
+            bool duplicate = neighbor_face_index == result_face_index;
+
+            for (int existing_index =
+                     result_face_edge_neighbor_offsets[edge_index];
+                 existing_index < result_neighbor_count && !duplicate;
+                 existing_index++) {
+              duplicate =
+                  result_face_edge_neighbor_face_indices[existing_index] ==
+                  neighbor_face_index;
+            }
+
+            if (!duplicate) {
+              result_face_edge_neighbor_face_indices[result_neighbor_count] =
+                  neighbor_face_index;
+              result_face_edge_neighbor_counts[edge_index]++;
+              result_neighbor_count++;
+            }
+          }
+        }
+      }
+    }
+
+    result_vertex_count += relevant_group_vertex_count;
+  }
+
+  for (int face_index = 0; face_index < result_face_count; face_index++) {
+    face_next_members[face_index] = face_index;
+  }
+
+  rebake_navigable_faces(
+      result_face_count, face_next_members, result_face_vertex_counts,
+      result_face_vertex_offsets, result_face_vertex_locations,
+      result_face_edge_neighbor_counts, result_face_edge_neighbor_offsets,
+      result_face_edge_neighbor_face_indices, result_face_normals,
+      result_edge_normals, result_edge_exit_normals, result_edge_coefficients,
+      result_vertex_up_normals);
+
+  return result_face_count;
+}
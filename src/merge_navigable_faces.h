@@ -0,0 +1,126 @@
+#ifndef MERGE_NAVIGABLE_FACES_H
+
+#define MERGE_NAVIGABLE_FACES_H
+
+/**
+ * Reduces the number of faces in a navigation mesh by merging neighboring
+ * faces which share an edge and are close to coplanar into larger convex
+ * faces, dropping any vertices left in the middle of an edge which is straight
+ * in 3D (vertices along a crease between faces of differing slopes are kept).
+ * The neighbor lists are carried over (neighbors within the same merged face
+ * are dropped) and all derived data is recalculated (see
+ * rebake_navigable_faces).
+ * Fewer faces means fewer iterations of queries such as closest_navigable_face
+ * and fewer edge crossings in sliding_navigation_collision.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is undefined if any is
+ *                           less than 3 or greater than maximum_vertex_count.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Faces are only merged where the vertices of
+ *                              their shared edge are identical.  Behavior is
+ *                              undefined if any component is NaN, infinity or
+ *                              negative infinity, or if any face is not convex.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.  Only neighboring
+ *                                        faces are considered for merging.
+ * @param face_flags Flags describing each face of the navigation mesh.  When
+ *                   not NULL, only faces with identical flags are merged.
+ * @param maximum_vertex_count The greatest number of vertices a merged face may
+ *                             have.
+ * @param minimum_normal_dot The least dot product of the surface normals of
+ *                           two faces (or of the first face of each of two
+ *                           merged faces) which may be merged (e.g. 0.999 to
+ *                           permit a deviation of roughly 2.5 degrees).
+ * @param maximum_plane_distance The greatest distance any vertex of a merged
+ *                               face may lie from the plane of that face.
+ *                               Merges which would exceed it are skipped.
+ * @param face_groups Overwritten with temporary data.  Must have space for
+ *                    face_count values.
+ * @param face_next_members Overwritten with temporary data.  Must have space
+ *                          for face_count values.
+ * @param group_vertex_counts Overwritten with temporary data.  Must have space
+ *                            for face_count values.
+ * @param group_vertex_locations Overwritten with temporary data.  Must have
+ *                               space for (face_count + 2) *
+ *                               maximum_vertex_count 3D vectors.
+ * @param result_face_indices Overwritten with the index of the merged face
+ *                            containing each face of the navigation mesh.
+ *                            Must have space for face_count values.
+ * @param result_face_vertex_counts Overwritten with the number of vertices of
+ *                                  each merged face.  Needs no more space than
+ *                                  face_vertex_counts.
+ * @param result_face_vertex_offsets Overwritten with the exclusive running
+ *                                   totals of the vertex count of each merged
+ *                                   face.  Needs no more space than
+ *                                   face_vertex_offsets.
+ * @param result_face_vertex_locations Overwritten with a 3D vector describing
+ *                                     the location of each vertex within each
+ *                                     merged face.  Needs no more space than
+ *                                     face_vertex_locations.
+ * @param result_face_normals Overwritten with a 3D unit vector describing the
+ *                            surface normal of each merged face.
+ * @param result_edge_normals Overwritten with a 3D unit vector for each edge of
+ *                            each merged face (see rebake_navigable_faces).
+ * @param result_edge_exit_normals Overwritten with a 3D unit vector for each
+ *                                 edge of each merged face (see
+ *                                 rebake_navigable_faces).
+ * @param result_edge_coefficients Overwritten with a 3D vector for each vertex
+ *                                 of each merged face (see
+ *                                 rebake_navigable_faces).
+ * @param result_vertex_up_normals Overwritten with a 3D unit vector for each
+ *                                 vertex of each merged face (see
+ *                                 rebake_navigable_faces).
+ * @param result_face_edge_neighbor_counts Overwritten with the number of
+ *                                         neighboring merged faces for each
+ *                                         edge of each merged face.
+ * @param result_face_edge_neighbor_offsets Overwritten with the exclusive
+ *                                          running totals of the neighbor
+ *                                          count of each edge of each merged
+ *                                          face.
+ * @param result_face_edge_neighbor_face_indices Overwritten with the index of
+ *                                               each neighboring merged face
+ *                                               of each edge of each merged
+ *                                               face.  Needs no more space
+ *                                               than
+ *                                               face_edge_neighbor_face_indices.
+ * @param result_face_flags Overwritten with the flags of each merged face.
+ *                          Ignored when face_flags is NULL.
+ * @return The number of merged faces, which is never greater than face_count.
+ */
+int merge_navigable_faces(
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int maximum_vertex_count,
+    const float minimum_normal_dot, const float maximum_plane_distance,
+    int *const face_groups, int *const face_next_members,
+    int *const group_vertex_counts, float *const group_vertex_locations,
+    int *const result_face_indices, int *const result_face_vertex_counts,
+    int *const result_face_vertex_offsets,
+    float *const result_face_vertex_locations, float *const result_face_normals,
+    float *const result_edge_normals, float *const result_edge_exit_normals,
+    float *const result_edge_coefficients,
+    float *const result_vertex_up_normals,
+    int *const result_face_edge_neighbor_counts,
+    int *const result_face_edge_neighbor_offsets,
+    int *const result_face_edge_neighbor_face_indices,
+    int *const result_face_flags);
+
+#endif
@@ -0,0 +1,294 @@
+#include "move_across_navigation_mesh.h"
+#include "sliding_navigation_collision.h"
+#include "sliding_navigation_collision_result.h"
+#include <stddef.h>
+
+static const float offset = 0.0001f;
+
+static void collide_with_excluded_edge(
+    const float *const from, const float *const relevant_face_vertex_location,
+    const float *const relevant_edge_exit_normal, float *const result_from,
+    float *const to) {
+  const float adjusted_from_edge_distance =
+      (from[0] - relevant_face_vertex_location[0]) *
+          relevant_edge_exit_normal[0] +
+      (from[1] - relevant_face_vertex_location[1]) *
+          relevant_edge_exit_normal[1] +
+      (from[2] - relevant_face_vertex_location[2]) *
+          relevant_edge_exit_normal[2] +
+      offset;
+
+  const float adjusted_to_edge_distance =
+      (to[0] - relevant_face_vertex_location[0]) *
+          relevant_edge_exit_normal[0] +
+      (to[1] - relevant_face_vertex_location[1]) *
+          relevant_edge_exit_normal[1] +
+      (to[2] - relevant_face_vertex_location[2]) *
+          relevant_edge_exit_normal[2] +
+      offset;
+
+  const float along =
+      adjusted_to_edge_distance == adjusted_from_edge_distance
+          ? adjusted_from_edge_distance
+          : adjusted_from_edge_distance /
+                (adjusted_from_edge_distance - adjusted_to_edge_distance);
+
+  const float forward = along > 1.0f ? 1.0f : (along < 0.0f ? 0.0f : along);
+  const float inverse = 1.0f - forward;
+
+  result_from[0] = from[0] * inverse + to[0] * forward;
+  result_from[1] = from[1] * inverse + to[1] * forward;
+  result_from[2] = from[2] * inverse + to[2] * forward;
+
+  to[0] -= relevant_edge_exit_normal[0] * adjusted_to_edge_distance;
+  to[1] -= relevant_edge_exit_normal[1] * adjusted_to_edge_distance;
+  to[2] -= relevant_edge_exit_normal[2] * adjusted_to_edge_distance;
+}
+
+static int reached_link(const float *const origin, const float *const from,
+                        const float *const to, const int face_index,
+                        const int *const face_link_offsets,
+                        const int *const face_link_indices,
+                        const float *const link_start_locations,
+                        const int *const link_flags, const float link_reach,
+                        const int include_flags, const int exclude_flags) {
+  const float motion[] = {to[0] - from[0], to[1] - from[1], to[2] - from[2]};
+
+  const float motion_squared =
+      motion[0] * motion[0] + motion[1] * motion[1] + motion[2] * motion[2];
+
+  int best_link_index = -1;
+  float best_progress = 2.0f;
+
+  for (int face_link_index = face_link_offsets[face_index];
+       face_link_index < face_link_offsets[face_index + 1];
+       face_link_index++) {
+    const int link_index = face_link_indices[face_link_index];
+
+    if (link_flags != NULL &&
+        ((link_flags[link_index] & include_flags) == 0 ||
+         (link_flags[link_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
+    const float *const relevant_link_start_location =
+        link_start_locations + link_index * 3;
+
+    const float origin_difference[] = {
+        relevant_link_start_location[0] - origin[0],
+        relevant_link_start_location[1] - origin[1],
+        relevant_link_start_location[2] - origin[2],
+    };
+
+    if (origin_difference[0] * origin_difference[0] +
+            origin_difference[1] * origin_difference[1] +
+            origin_difference[2] * origin_difference[2] <=
+        link_reach * link_reach) {
+      continue;
+    }
+
+    const float start_difference[] = {
+        relevant_link_start_location[0] - from[0],
+        relevant_link_start_location[1] - from[1],
+        relevant_link_start_location[2] - from[2],
+    };
+
+    const float along = motion_squared > 0.0f
+                            ? (start_difference[0] * motion[0] +
+                               start_difference[1] * motion[1] +
+                               start_difference[2] * motion[2]) /
+                                  motion_squared
+                            : 0.0f;
+
+    const float progress =
+        along > 1.0f ? 1.0f : (along < 0.0f ? 0.0f : along);
+
+    const float delta[] = {
+        start_difference[0] - motion[0] * progress,
+        start_difference[1] - motion[1] * progress,
+        start_difference[2] - motion[2] * progress,
+    };
+
+    if (delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2] <=
+            link_reach * link_reach &&
+        progress < best_progress) {
+      best_link_index = link_index;
+      best_progress = progress;
+    }
+  }
+
+  return best_link_index;
+}
+
+static void record_event(const int event_agent_index, const int from_face_index,
+                         const int to_face_index, const int edge_index,
+                         const float *const location, const int maximum_events,
+                         int *const event_count, int *const event_agent_indices,
+                         int *const event_from_face_indices,
+                         int *const event_to_face_indices,
+                         int *const event_edge_indices,
+                         float *const event_locations) {
+  if (event_count == NULL) {
+    return;
+  }
+
+  const int event_index = *event_count;
+
+  if (event_index < maximum_events) {
+    event_agent_indices[event_index] = event_agent_index;
+    event_from_face_indices[event_index] = from_face_index;
+    event_to_face_indices[event_index] = to_face_index;
+    event_edge_indices[event_index] = edge_index;
+    event_locations[event_index * 3] = location[0];
+    event_locations[event_index * 3 + 1] = location[1];
+    event_locations[event_index * 3 + 2] = location[2];
+  }
+
+  (*event_count)++;
+}
+
+int move_across_navigation_mesh(
+    const float *const from, const int face_index, const float *const to,
+    const int maximum_iterations, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int *const face_link_offsets,
+    const int *const face_link_indices, const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const int *const link_flags,
+    const float link_reach, const int include_flags, const int exclude_flags,
+    float *const result_location, int *const result_face_index,
+    const int event_agent_index, const int maximum_events,
+    int *const event_count, int *const event_agent_indices,
+    int *const event_from_face_indices, int *const event_to_face_indices,
+    int *const event_edge_indices, float *const event_locations) {
+  float current_from[] = {from[0], from[1], from[2]};
+  float current_to[] = {to[0], to[1], to[2]};
+  int current_face_index = face_index;
+
+  for (int iteration = 0; iteration < maximum_iterations; iteration++) {
+    int edge_index;
+
+    const float previous_from[] = {current_from[0], current_from[1],
+                                   current_from[2]};
+
+    const int result = sliding_navigation_collision(
+        current_from, current_face_index, current_to, face_vertex_counts,
+        face_vertex_offsets, face_vertex_locations, face_normals,
+        edge_exit_normals, face_edge_neighbor_counts, current_from, current_to,
+        &edge_index);
+
+    if (face_link_offsets != NULL) {
+      const int link_index = reached_link(
+          from, previous_from,
+          result == SLIDING_NAVIGATION_COLLISION_RESULT_NONE ? current_to
+                                                             : current_from,
+          current_face_index, face_link_offsets, face_link_indices,
+          link_start_locations, link_flags, link_reach, include_flags,
+          exclude_flags);
+
+      if (link_index != -1) {
+        const float *const relevant_link_start_location =
+            link_start_locations + link_index * 3;
+        const float *const relevant_link_end_location =
+            link_end_locations + link_index * 3;
+
+        record_event(event_agent_index, current_face_index,
+                     link_end_face_indices[link_index], -1,
+                     relevant_link_start_location, maximum_events,
+                     event_count, event_agent_indices,
+                     event_from_face_indices, event_to_face_indices,
+                     event_edge_indices, event_locations);
+
+        result_location[0] = relevant_link_end_location[0];
+        result_location[1] = relevant_link_end_location[1];
+        result_location[2] = relevant_link_end_location[2];
+        *result_face_index = link_end_face_indices[link_index];
+        return iteration + 1;
+      }
+    }
+
+    if (result == SLIDING_NAVIGATION_COLLISION_RESULT_NONE) {
+      result_location[0] = current_to[0];
+      result_location[1] = current_to[1];
+      result_location[2] = current_to[2];
+      *result_face_index = current_face_index;
+      return iteration + 1;
+    }
+
+    if (result == SLIDING_NAVIGATION_COLLISION_RESULT_EDGE) {
+      const int relevant_edge = face_vertex_offsets[current_face_index] +
+                                edge_index;
+      const int relevant_face_edge_neighbor_count =
+          face_edge_neighbor_counts[relevant_edge];
+
+      if (relevant_face_edge_neighbor_count > 0) {
+        const int *const relevant_face_edge_neighbor_face_indices =
+            face_edge_neighbor_face_indices +
+            face_edge_neighbor_offsets[relevant_edge];
+
+        int best_face_index = -1;
+        float best_surface_distance = 1.0f / 0.0f;
+
+        for (int neighbor_index = 0;
+             neighbor_index < relevant_face_edge_neighbor_count;
+             neighbor_index++) {
+          const int neighbor_face_index =
+              relevant_face_edge_neighbor_face_indices[neighbor_index];
+
+          if (face_flags != NULL &&
+              ((face_flags[neighbor_face_index] & include_flags) == 0 ||
+               (face_flags[neighbor_face_index] & exclude_flags) != 0)) {
+            continue;
+          }
+
+          const float *const neighbor_face_vertex_location =
+              face_vertex_locations +
+              face_vertex_offsets[neighbor_face_index] * 3;
+          const float *const neighbor_face_normal =
+              face_normals + neighbor_face_index * 3;
+
+          const float surface_distance =
+              (current_from[0] - neighbor_face_vertex_location[0]) *
+                  neighbor_face_normal[0] +
+              (current_from[1] - neighbor_face_vertex_location[1]) *
+                  neighbor_face_normal[1] +
+              (current_from[2] - neighbor_face_vertex_location[2]) *
+                  neighbor_face_normal[2];
+
+          const float absolute_surface_distance =
+              surface_distance < 0.0f ? -surface_distance : surface_distance;
+
+          if (absolute_surface_distance < best_surface_distance) {
+            best_face_index = neighbor_face_index;
+            best_surface_distance = absolute_surface_distance;
+          }
+        }
+
+        if (best_face_index != -1) {
+          record_event(event_agent_index, current_face_index, best_face_index,
+                       edge_index, current_from, maximum_events, event_count,
+                       event_agent_indices, event_from_face_indices,
+                       event_to_face_indices, event_edge_indices,
+                       event_locations);
+
+          current_face_index = best_face_index;
+        } else {
+          collide_with_excluded_edge(
+              previous_from, face_vertex_locations + relevant_edge * 3,
+              edge_exit_normals + relevant_edge * 3, current_from, current_to);
+        }
+      }
+    }
+  }
+
+  result_location[0] = current_from[0];
+  result_location[1] = current_from[1];
+  result_location[2] = current_from[2];
+  *result_face_index = current_face_index;
+  return maximum_iterations;
+}
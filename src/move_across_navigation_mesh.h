@@ -0,0 +1,134 @@
+#ifndef MOVE_ACROSS_NAVIGATION_MESH_H
+
+#define MOVE_ACROSS_NAVIGATION_MESH_H
+
+/**
+ * Moves an object across a navigation mesh by repeatedly performing sliding
+ * navigation collision, following the motion into neighboring faces.  Should
+ * the motion pass within reach of the start of an off-mesh link from the face
+ * it is crossing, the first such link is followed and the motion ends there.
+ * Links which start within reach of "from" are never followed, so an object
+ * which has just arrived at the end of a two-way link is not sent straight
+ * back.
+ * @param from The 3D vector describing the point the object is traveling from.
+ *             Behavior is undefined if outside of the face's volume or if any
+ *             component is NaN, infinity or negative infinity.
+ * @param face_index The index of the face containing "from".
+ * @param to The 3D vector describing the point the object is traveling to.
+ *           Behavior is undefined if any component is NaN, infinity or negative
+ *           infinity.
+ * @param maximum_iterations The maximum number of iterations of sliding
+ *                           navigation collision to perform.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_exit_normals A 3D unit vector perpendicular to each edge of each
+ *                          face of the navigation mesh, pointing out of the
+ *                          face into a hypothetical neighboring face.  Where no
+ *                          neighbors exist, this is perpendicular to the face's
+ *                          surface normal.  It is otherwise averaged with the
+ *                          neighboring edge exit normals to ensure that there
+ *                          is a consistent plane to cross to enter or exit the
+ *                          face.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to allow entry to every
+ *                   face.
+ * @param face_link_offsets The face link offsets produced by
+ *                          navigation_link_table, or NULL to ignore off-mesh
+ *                          links.
+ * @param face_link_indices The face link indices produced by
+ *                          navigation_link_table.  Ignored when
+ *                          face_link_offsets is NULL.
+ * @param link_end_face_indices The index of the face at which each link ends.
+ *                              Ignored when face_link_offsets is NULL.
+ * @param link_start_locations A 3D vector describing the location at which
+ *                             each link starts.  Ignored when
+ *                             face_link_offsets is NULL.
+ * @param link_end_locations A 3D vector describing the location at which each
+ *                           link ends.  Ignored when face_link_offsets is
+ *                           NULL.
+ * @param link_flags Flags describing each link (e.g. 1 for jumps, 2 for
+ *                   ladders), or NULL to allow every link to be followed.
+ *                   Ignored when face_link_offsets is NULL.
+ * @param link_reach The maximum distance between the motion and the start of a
+ *                   link for the link to be followed (see
+ *                   traverse_navigation_link).  Behavior is undefined if NaN,
+ *                   infinity, negative infinity or negative.  Ignored when
+ *                   face_link_offsets is NULL.
+ * @param include_flags Only faces and links with at least one of these flags
+ *                      are entered, where face_flags or link_flags
+ *                      respectively is not NULL.
+ * @param exclude_flags Faces and links with any of these flags are not
+ *                      entered, where face_flags or link_flags respectively is
+ *                      not NULL.  Edges whose neighbors are all excluded are
+ *                      collided with as though they had no neighbors.
+ * @param result_location The 3D vector which is overwritten with the location
+ *                        the object reached.  May be "from" or "to".
+ * @param result_face_index Overwritten with the index of the face containing
+ *                          result_location.
+ * @param event_agent_index The value written to event_agent_indices for each
+ *                          event (e.g. the index of the agent moved).
+ * @param maximum_events The number of events which the event arrays have
+ *                       space for.
+ * @param event_count Incremented by one for each face entered by crossing an
+ *                    edge or following a link, in the order in which they are
+ *                    entered.  Events
+ *                    which would exceed maximum_events are counted but not
+ *                    written.  May be NULL, in which case no events are
+ *                    recorded and the event arrays are ignored.
+ * @param event_agent_indices Overwritten with event_agent_index for each
+ *                            event.
+ * @param event_from_face_indices Overwritten with the index of the face left
+ *                                by each event.
+ * @param event_to_face_indices Overwritten with the index of the face entered
+ *                              by each event.
+ * @param event_edge_indices Overwritten with the index of the edge crossed by
+ *                           each event, within the face left, or -1 when a
+ *                           link was followed.
+ * @param event_locations Overwritten with a 3D vector describing the location
+ *                        at which each event crossed its edge, or the start of
+ *                        the link followed.
+ * @return The number of iterations of sliding navigation collision performed.
+ *         When this is maximum_iterations, the motion was cut short and
+ *         result_location is the last point known to be within the volume of
+ *         the face.
+ */
+int move_across_navigation_mesh(
+    const float *const from, const int face_index, const float *const to,
+    const int maximum_iterations, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int *const face_link_offsets,
+    const int *const face_link_indices, const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const int *const link_flags,
+    const float link_reach, const int include_flags, const int exclude_flags,
+    float *const result_location, int *const result_face_index,
+    const int event_agent_index, const int maximum_events,
+    int *const event_count, int *const event_agent_indices,
+    int *const event_from_face_indices, int *const event_to_face_indices,
+    int *const event_edge_indices, float *const event_locations);
+
+#endif
@@ -0,0 +1,66 @@
+#include "navigable_face_areas.h"
+
+void navigable_face_areas(const int face_count,
+                          const int *const face_vertex_counts,
+                          const int *const face_vertex_offsets,
+                          const float *const face_vertex_locations,
+                          const float *const face_normals,
+                          float *const face_fan_areas,
+                          float *const cumulative_face_areas) {
+  float total = 0.0f;
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+    float *const relevant_face_fan_areas =
+        face_fan_areas + relevant_face_vertex_offset;
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+    float face_area = 0.0f;
+
+    relevant_face_fan_areas[0] = 0.0f;
+    relevant_face_fan_areas[1] = 0.0f;
+
+    for (int vertex_index = 2; vertex_index < relevant_face_vertex_count;
+         vertex_index++) {
+      const float *const previous_face_vertex_location =
+          relevant_face_vertex_locations + (vertex_index - 1) * 3;
+      const float *const relevant_face_vertex_location =
+          relevant_face_vertex_locations + vertex_index * 3;
+
+      const float previous_difference[] = {
+          previous_face_vertex_location[0] - relevant_face_vertex_locations[0],
+          previous_face_vertex_location[1] - relevant_face_vertex_locations[1],
+          previous_face_vertex_location[2] - relevant_face_vertex_locations[2],
+      };
+
+      const float relevant_difference[] = {
+          relevant_face_vertex_location[0] - relevant_face_vertex_locations[0],
+          relevant_face_vertex_location[1] - relevant_face_vertex_locations[1],
+          relevant_face_vertex_location[2] - relevant_face_vertex_locations[2],
+      };
+
+      const float cross[] = {
+          previous_difference[1] * relevant_difference[2] -
+              previous_difference[2] * relevant_difference[1],
+          previous_difference[2] * relevant_difference[0] -
+              previous_difference[0] * relevant_difference[2],
+          previous_difference[0] * relevant_difference[1] -
+              previous_difference[1] * relevant_difference[0],
+      };
+
+      const float triangle_area =
+          0.5f * (cross[0] * relevant_face_normal[0] +
+                  cross[1] * relevant_face_normal[1] +
+                  cross[2] * relevant_face_normal[2]);
+
+      face_area += triangle_area > 0.0f ? triangle_area : 0.0f;
+      relevant_face_fan_areas[vertex_index] = face_area;
+    }
+
+    total += face_area;
+    cumulative_face_areas[face_index] = total;
+  }
+}
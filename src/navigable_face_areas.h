@@ -0,0 +1,40 @@
+#ifndef NAVIGABLE_FACE_AREAS_H
+
+#define NAVIGABLE_FACE_AREAS_H
+
+/**
+ * Calculates the area tables used to uniformly sample the surface of a
+ * navigation mesh.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param face_fan_areas Overwritten with a value for each vertex of each face
+ *                       of the navigation mesh.  Each is the inclusive running
+ *                       total of the areas of the triangles fanned from the
+ *                       first vertex of the face up to that vertex (e.g. for a
+ *                       pentagon ABCDE, this would contain 0, 0, ABC,
+ *                       ABC + ACD, ABC + ACD + ADE).  The last value of each
+ *                       face is therefore the area of that face.
+ * @param cumulative_face_areas Overwritten with the inclusive running totals of
+ *                              the area of each face (e.g. for areas 3, 5, 4,
+ *                              this would contain 3, 8, 12).
+ */
+void navigable_face_areas(const int face_count,
+                          const int *const face_vertex_counts,
+                          const int *const face_vertex_offsets,
+                          const float *const face_vertex_locations,
+                          const float *const face_normals,
+                          float *const face_fan_areas,
+                          float *const cumulative_face_areas);
+
+#endif
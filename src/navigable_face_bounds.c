@@ -0,0 +1,84 @@
+#include "navigable_face_bounds.h"
+#include <stddef.h>
+
+void navigable_face_bounds(const int face_count, const int *const face_indices,
+                           const int *const face_vertex_counts,
+                           const int *const face_vertex_offsets,
+                           const float *const face_vertex_locations,
+                           const float *const face_normals,
+                           float *const face_plane_constants,
+                           float *const face_bounds,
+                           float *const face_bounding_spheres) {
+  for (int candidate_index = 0; candidate_index < face_count;
+       candidate_index++) {
+    const int face_index =
+        face_indices == NULL ? candidate_index : face_indices[candidate_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + face_vertex_offsets[face_index] * 3;
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+    float *const relevant_face_bounds = face_bounds + face_index * 6;
+    float *const relevant_face_bounding_sphere =
+        face_bounding_spheres + face_index * 4;
+
+    face_plane_constants[face_index] =
+        relevant_face_vertex_locations[0] * relevant_face_normal[0] +
+        relevant_face_vertex_locations[1] * relevant_face_normal[1] +
+        relevant_face_vertex_locations[2] * relevant_face_normal[2];
+
+    for (int component = 0; component < 3; component++) {
+      relevant_face_bounds[component] =
+          relevant_face_vertex_locations[component];
+      relevant_face_bounds[component + 3] =
+          relevant_face_vertex_locations[component];
+    }
+
+    for (int vertex_index = 1; vertex_index < relevant_face_vertex_count;
+         vertex_index++) {
+      const float *const relevant_face_vertex_location =
+          relevant_face_vertex_locations + vertex_index * 3;
+
+      for (int component = 0; component < 3; component++) {
+        const float value = relevant_face_vertex_location[component];
+
+        if (value < relevant_face_bounds[component]) {
+          relevant_face_bounds[component] = value;
+        }
+
+        if (value > relevant_face_bounds[component + 3]) {
+          relevant_face_bounds[component + 3] = value;
+        }
+      }
+    }
+
+    for (int component = 0; component < 3; component++) {
+      relevant_face_bounding_sphere[component] =
+          (relevant_face_bounds[component] +
+           relevant_face_bounds[component + 3]) *
+          0.5f;
+    }
+
+    float radius_squared = 0.0f;
+
+    for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+         vertex_index++) {
+      const float *const relevant_face_vertex_location =
+          relevant_face_vertex_locations + vertex_index * 3;
+
+      const float delta[] = {
+          relevant_face_vertex_location[0] - relevant_face_bounding_sphere[0],
+          relevant_face_vertex_location[1] - relevant_face_bounding_sphere[1],
+          relevant_face_vertex_location[2] - relevant_face_bounding_sphere[2],
+      };
+
+      const float distance_squared =
+          delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+      if (distance_squared > radius_squared) {
+        radius_squared = distance_squared;
+      }
+    }
+
+    relevant_face_bounding_sphere[3] = radius_squared;
+  }
+}
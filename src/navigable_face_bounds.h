@@ -0,0 +1,51 @@
+#ifndef NAVIGABLE_FACE_BOUNDS_H
+
+#define NAVIGABLE_FACE_BOUNDS_H
+
+/**
+ * Calculates the plane constants, axis-aligned bounding boxes and bounding
+ * spheres used by closest_navigable_face_with_bounds and
+ * navigable_faces_within_radius_with_bounds to reject faces without visiting
+ * their vertices.  These must be recalculated for any face whose vertices
+ * move (such as those given to rebake_navigable_faces).
+ * @param face_count The number of faces to calculate.  When face_indices is
+ *                   NULL, this is the number of faces in the navigation mesh.
+ * @param face_indices The indices of the faces to calculate (e.g. those which
+ *                     have moved), or NULL to calculate every face of the
+ *                     navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is undefined if any is
+ *                           less than 1.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param face_plane_constants Overwritten with the dot product of the first
+ *                             vertex of each face and its surface normal, so
+ *                             that the distance from a location to the plane
+ *                             of the face is the dot product of the location
+ *                             and the surface normal, minus this value.
+ * @param face_bounds Overwritten with the minimum 3D vector, followed by the
+ *                    maximum 3D vector, of the vertices of each face.
+ * @param face_bounding_spheres Overwritten with a 3D vector describing the
+ *                              center of the bounds of each face, followed by
+ *                              the square of the distance from that center to
+ *                              the farthest vertex of the face (kept squared so
+ *                              that no rounding of a square root can shrink
+ *                              the sphere).
+ */
+void navigable_face_bounds(const int face_count, const int *const face_indices,
+                           const int *const face_vertex_counts,
+                           const int *const face_vertex_offsets,
+                           const float *const face_vertex_locations,
+                           const float *const face_normals,
+                           float *const face_plane_constants,
+                           float *const face_bounds,
+                           float *const face_bounding_spheres);
+
+#endif
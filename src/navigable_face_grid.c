@@ -0,0 +1,108 @@
+#include "navigable_face_grid.h"
+#include "navigable_face_grid_bucket.h"
+
+static int cell(const float coordinate, const float cell_size) {
+  const float scaled = coordinate / cell_size;
+  const int truncated = (int)scaled;
+  return scaled < truncated ? truncated - 1 : truncated;
+}
+
+static void calculate_cell_bounds(const int *const face_vertex_counts,
+                                  const int *const face_vertex_offsets,
+                                  const float *const face_vertex_locations,
+                                  const float cell_size, const int face_index,
+                                  int *const minimum, int *const maximum) {
+  const int relevant_face_vertex_count = face_vertex_counts[face_index];
+  const float *const relevant_face_vertex_locations =
+      face_vertex_locations + face_vertex_offsets[face_index] * 3;
+
+  float minimum_location[] = {relevant_face_vertex_locations[0],
+                              relevant_face_vertex_locations[1]};
+  float maximum_location[] = {relevant_face_vertex_locations[0],
+                              relevant_face_vertex_locations[1]};
+
+  for (int vertex_index = 1; vertex_index < relevant_face_vertex_count;
+       vertex_index++) {
+    for (int axis = 0; axis < 2; axis++) {
+      const float component =
+          relevant_face_vertex_locations[vertex_index * 3 + axis];
+      minimum_location[axis] = component < minimum_location[axis]
+                                   ? component
+                                   : minimum_location[axis];
+      maximum_location[axis] = component > maximum_location[axis]
+                                   ? component
+                                   : maximum_location[axis];
+    }
+  }
+
+  for (int axis = 0; axis < 2; axis++) {
+    minimum[axis] = cell(minimum_location[axis], cell_size);
+    maximum[axis] = cell(maximum_location[axis], cell_size);
+  }
+}
+
+int navigable_face_grid(const int face_count,
+                        const int *const face_vertex_counts,
+                        const int *const face_vertex_offsets,
+                        const float *const face_vertex_locations,
+                        const float cell_size, const int bucket_count,
+                        const int maximum_entries,
+                        int *const bucket_face_offsets,
+                        int *const bucket_face_indices) {
+  for (int bucket_index = 0; bucket_index <= bucket_count; bucket_index++) {
+    bucket_face_offsets[bucket_index] = 0;
+  }
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    int minimum[2];
+    int maximum[2];
+
+    calculate_cell_bounds(face_vertex_counts, face_vertex_offsets,
+                          face_vertex_locations, cell_size, face_index,
+                          minimum, maximum);
+
+    for (int cell_y = minimum[1]; cell_y <= maximum[1]; cell_y++) {
+      for (int cell_x = minimum[0]; cell_x <= maximum[0]; cell_x++) {
+        bucket_face_offsets[navigable_face_grid_bucket(cell_x, cell_y,
+                                                       bucket_count) +
+                            1]++;
+      }
+    }
+  }
+
+  for (int bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+    bucket_face_offsets[bucket_index + 1] += bucket_face_offsets[bucket_index];
+  }
+
+  const int output = bucket_face_offsets[bucket_count];
+
+  if (output > maximum_entries) {
+    return output;
+  }
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    int minimum[2];
+    int maximum[2];
+
+    calculate_cell_bounds(face_vertex_counts, face_vertex_offsets,
+                          face_vertex_locations, cell_size, face_index,
+                          minimum, maximum);
+
+    for (int cell_y = minimum[1]; cell_y <= maximum[1]; cell_y++) {
+      for (int cell_x = minimum[0]; cell_x <= maximum[0]; cell_x++) {
+        const int bucket_index =
+            navigable_face_grid_bucket(cell_x, cell_y, bucket_count);
+        bucket_face_indices[bucket_face_offsets[bucket_index]] = face_index;
+        bucket_face_offsets[bucket_index]++;
+      }
+    }
+  }
+
+  for (int bucket_index = bucket_count; bucket_index > 0; bucket_index--) {
+    bucket_face_offsets[bucket_index] = bucket_face_offsets[bucket_index - 1];
+  }
+
+  bucket_face_offsets[0] = 0;
+
+  return output;
+}
@@ -0,0 +1,51 @@
+#ifndef NAVIGABLE_FACE_GRID_H
+
+#define NAVIGABLE_FACE_GRID_H
+
+/**
+ * Builds a hashed grid of square cells over the X and Y axes of a navigation
+ * mesh, listing each face under every cell which its bounding box overlaps.
+ * Faces above one another (such as the storeys of a building) share cells.
+ * This suits navigation meshes which are broadly horizontal; see
+ * closest_navigable_face_in_grid and nearest_navigable_faces_in_grid.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity, or if any X or Y
+ *                              component divided by cell_size cannot be
+ *                              represented as an int.
+ * @param cell_size The width and depth of each cell.  Behavior is undefined if
+ *                  NaN, infinity, negative infinity, zero or negative.
+ * @param bucket_count The number of buckets to hash cells into.  Behavior is
+ *                     undefined if less than 1.
+ * @param maximum_entries The number of face indices which
+ *                        bucket_face_indices has space for.
+ * @param bucket_face_offsets Overwritten with the exclusive running totals of
+ *                            the number of faces listed in each bucket,
+ *                            followed by the total.  Must have space for
+ *                            bucket_count + 1 values.
+ * @param bucket_face_indices Overwritten with the indices of the faces listed
+ *                            in each bucket, grouped by bucket in ascending
+ *                            order.  Not written at all when the return value
+ *                            exceeds maximum_entries.
+ * @return The number of face indices listed across all buckets.  When this
+ *         exceeds maximum_entries, the grid must be built again with more
+ *         space, a larger cell_size or both.
+ */
+int navigable_face_grid(const int face_count,
+                        const int *const face_vertex_counts,
+                        const int *const face_vertex_offsets,
+                        const float *const face_vertex_locations,
+                        const float cell_size, const int bucket_count,
+                        const int maximum_entries,
+                        int *const bucket_face_offsets,
+                        int *const bucket_face_indices);
+
+#endif
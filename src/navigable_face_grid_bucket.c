@@ -0,0 +1,8 @@
+#include "navigable_face_grid_bucket.h"
+
+int navigable_face_grid_bucket(const int cell_x, const int cell_y,
+                               const int bucket_count) {
+  const unsigned int hash =
+      ((unsigned int)cell_x * 73856093u) ^ ((unsigned int)cell_y * 19349663u);
+  return (int)(hash % (unsigned int)bucket_count);
+}
@@ -0,0 +1,20 @@
+#ifndef NAVIGABLE_FACE_GRID_BUCKET_H
+
+#define NAVIGABLE_FACE_GRID_BUCKET_H
+
+/**
+ * Hashes the X and Y coordinates of a cell of a navigable face grid to the
+ * index of the bucket which holds the faces overlapping that cell.  Distinct
+ * cells may share a bucket.
+ * @param cell_x The X coordinate of the cell (the X coordinate of a location
+ *               divided by the cell size, rounded down).
+ * @param cell_y The Y coordinate of the cell (the Y coordinate of a location
+ *               divided by the cell size, rounded down).
+ * @param bucket_count The number of buckets in the navigable face grid.
+ *                     Behavior is undefined if less than 1.
+ * @return The index of the bucket, between 0 and bucket_count - 1.
+ */
+int navigable_face_grid_bucket(const int cell_x, const int cell_y,
+                               const int bucket_count);
+
+#endif
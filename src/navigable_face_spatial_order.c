@@ -0,0 +1,123 @@
+#include "navigable_face_spatial_order.h"
+#include <stdbool.h>
+
+static void calculate_centroid(const int *const face_vertex_counts,
+                               const int *const face_vertex_offsets,
+                               const float *const face_vertex_locations,
+                               const int face_index, float *const centroid) {
+  const float *const relevant_face_vertex_locations =
+      face_vertex_locations + face_vertex_offsets[face_index] * 3;
+  const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+  centroid[0] = 0.0f;
+  centroid[1] = 0.0f;
+  centroid[2] = 0.0f;
+
+  for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+       vertex_index++) {
+    const float *const relevant_face_vertex_location =
+        relevant_face_vertex_locations + vertex_index * 3;
+
+    centroid[0] += relevant_face_vertex_location[0];
+    centroid[1] += relevant_face_vertex_location[1];
+    centroid[2] += relevant_face_vertex_location[2];
+  }
+
+  const float inverse = 1.0f / relevant_face_vertex_count;
+
+  centroid[0] *= inverse;
+  centroid[1] *= inverse;
+  centroid[2] *= inverse;
+}
+
+static int spread_bits(const int value) {
+  int output = value & 1023;
+  output = (output | (output << 16)) & 0x030000FF;
+  output = (output | (output << 8)) & 0x0300F00F;
+  output = (output | (output << 4)) & 0x030C30C3;
+  output = (output | (output << 2)) & 0x09249249;
+  return output;
+}
+
+static bool precedes(const int *const face_keys, const int face_index_a,
+                     const int face_index_b) {
+  return face_keys[face_index_a] < face_keys[face_index_b] ||
+         (face_keys[face_index_a] == face_keys[face_index_b] &&
+          face_index_a < face_index_b);
+}
+
+static void sift_down(const int *const face_keys, int *const face_order,
+                      int root, const int count) {
+  while (root * 2 + 1 < count) {
+    int child = root * 2 + 1;
+
+    if (child + 1 < count &&
+        precedes(face_keys, face_order[child], face_order[child + 1])) {
+      child++;
+    }
+
+    if (!precedes(face_keys, face_order[root], face_order[child])) {
+      return;
+    }
+
+    const int swap = face_order[root];
+    face_order[root] = face_order[child];
+    face_order[child] = swap;
+    root = child;
+  }
+}
+
+void navigable_face_spatial_order(const int face_count,
+                                  const int *const face_vertex_counts,
+                                  const int *const face_vertex_offsets,
+                                  const float *const face_vertex_locations,
+                                  int *const face_keys, int *const face_order) {
+  float minimum[] = {1.0f / 0.0f, 1.0f / 0.0f, 1.0f / 0.0f};
+  float maximum[] = {-1.0f / 0.0f, -1.0f / 0.0f, -1.0f / 0.0f};
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    float centroid[3];
+
+    calculate_centroid(face_vertex_counts, face_vertex_offsets,
+                       face_vertex_locations, face_index, centroid);
+
+    for (int axis = 0; axis < 3; axis++) {
+      minimum[axis] = centroid[axis] < minimum[axis] ? centroid[axis]
+                                                     : minimum[axis];
+      maximum[axis] = centroid[axis] > maximum[axis] ? centroid[axis]
+                                                     : maximum[axis];
+    }
+  }
+
+  float scale[3];
+
+  for (int axis = 0; axis < 3; axis++) {
+    const float extent = maximum[axis] - minimum[axis];
+    scale[axis] = extent > 0.0f ? 1023.0f / extent : 0.0f;
+  }
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    float centroid[3];
+
+    calculate_centroid(face_vertex_counts, face_vertex_offsets,
+                       face_vertex_locations, face_index, centroid);
+
+    face_keys[face_index] =
+        spread_bits((int)((centroid[0] - minimum[0]) * scale[0])) |
+        (spread_bits((int)((centroid[1] - minimum[1]) * scale[1])) << 1) |
+        (spread_bits((int)((centroid[2] - minimum[2]) * scale[2])) << 2);
+
+    face_order[face_index] = face_index;
+  }
+
+  for (int root = face_count / 2 - 1; root >= 0; root--) {
+    sift_down(face_keys, face_order, root, face_count);
+  }
+
+  for (int end = face_count - 1; end > 0; end--) {
+    const int swap = face_order[0];
+    face_order[0] = face_order[end];
+    face_order[end] = swap;
+    sift_down(face_keys, face_order, 0, end);
+  }
+}
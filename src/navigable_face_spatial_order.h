@@ -0,0 +1,34 @@
+#ifndef NAVIGABLE_FACE_SPATIAL_ORDER_H
+
+#define NAVIGABLE_FACE_SPATIAL_ORDER_H
+
+/**
+ * Orders the faces of a navigation mesh along a space-filling (Morton/Z-order)
+ * curve through their centroids, so that faces which are near one another
+ * spatially are also near one another in memory once reordered using
+ * reorder_navigable_faces.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_keys Overwritten with the position of each face along the curve.
+ *                  Must have space for face_count values.
+ * @param face_order Overwritten with the index of the face which should be
+ *                   placed at each index once reordered (e.g. 2, 0, 1 would
+ *                   move the third face to the start).  Must have space for
+ *                   face_count values.
+ */
+void navigable_face_spatial_order(const int face_count,
+                                  const int *const face_vertex_counts,
+                                  const int *const face_vertex_offsets,
+                                  const float *const face_vertex_locations,
+                                  int *const face_keys, int *const face_order);
+
+#endif
@@ -0,0 +1,49 @@
+#include "navigable_face_vertex_count_buckets.h"
+
+int navigable_face_vertex_count_buckets(
+    const int face_count, const int *const face_vertex_counts,
+    const int maximum_bucket_count, int *const bucket_vertex_counts,
+    int *const bucket_face_offsets, int *const bucket_face_counts,
+    int *const bucket_vertex_offsets, int *const face_order) {
+  int bucket_count = 0;
+  int ordered_face_count = 0;
+  int ordered_vertex_count = 0;
+  int previous_vertex_count = 0;
+
+  while (ordered_face_count < face_count) {
+    int vertex_count = -1;
+
+    for (int face_index = 0; face_index < face_count; face_index++) {
+      const int candidate = face_vertex_counts[face_index];
+
+      if (candidate > previous_vertex_count &&
+          (vertex_count == -1 || candidate < vertex_count)) {
+        vertex_count = candidate;
+      }
+    }
+
+    const int bucket_face_offset = ordered_face_count;
+
+    for (int face_index = 0; face_index < face_count; face_index++) {
+      if (face_vertex_counts[face_index] == vertex_count) {
+        face_order[ordered_face_count] = face_index;
+        ordered_face_count++;
+      }
+    }
+
+    if (bucket_count < maximum_bucket_count) {
+      bucket_vertex_counts[bucket_count] = vertex_count;
+      bucket_face_offsets[bucket_count] = bucket_face_offset;
+      bucket_face_counts[bucket_count] =
+          ordered_face_count - bucket_face_offset;
+      bucket_vertex_offsets[bucket_count] = ordered_vertex_count;
+    }
+
+    ordered_vertex_count +=
+        (ordered_face_count - bucket_face_offset) * vertex_count;
+    previous_vertex_count = vertex_count;
+    bucket_count++;
+  }
+
+  return bucket_count;
+}
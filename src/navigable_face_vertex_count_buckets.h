@@ -0,0 +1,42 @@
+#ifndef NAVIGABLE_FACE_VERTEX_COUNT_BUCKETS_H
+
+#define NAVIGABLE_FACE_VERTEX_COUNT_BUCKETS_H
+
+/**
+ * Orders the faces of a navigation mesh by vertex count, so that once
+ * reordered using reorder_navigable_faces, faces with equal vertex counts form
+ * contiguous buckets which can be processed using loops with a fixed number of
+ * iterations (see closest_navigable_face_in_buckets).  Faces with equal vertex
+ * counts keep their relative order.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is undefined if any is
+ *                           less than 3.
+ * @param maximum_bucket_count The number of buckets which bucket_vertex_counts,
+ *                             bucket_face_offsets, bucket_face_counts and
+ *                             bucket_vertex_offsets have space for.
+ * @param bucket_vertex_counts Overwritten with the number of vertices of each
+ *                             face within each bucket, in ascending order.
+ * @param bucket_face_offsets Overwritten with the index of the first face of
+ *                            each bucket once reordered.
+ * @param bucket_face_counts Overwritten with the number of faces within each
+ *                           bucket.
+ * @param bucket_vertex_offsets Overwritten with the index of the first vertex
+ *                              of the first face of each bucket once
+ *                              reordered.
+ * @param face_order Overwritten with the index of the face which should be
+ *                   placed at each index once reordered (e.g. 2, 0, 1 would
+ *                   move the third face to the start).  This also maps each
+ *                   reordered face index back to its original face index.
+ *                   Must have space for face_count values.
+ * @return The number of buckets, which may exceed maximum_bucket_count.
+ *         Nothing is written to the bucket arrays beyond maximum_bucket_count,
+ *         though face_order is always written in full.
+ */
+int navigable_face_vertex_count_buckets(
+    const int face_count, const int *const face_vertex_counts,
+    const int maximum_bucket_count, int *const bucket_vertex_counts,
+    int *const bucket_face_offsets, int *const bucket_face_counts,
+    int *const bucket_vertex_offsets, int *const face_order);
+
+#endif
@@ -0,0 +1,73 @@
+#include "navigable_faces_within_radius.h"
+#include "constrain_to_navigable_surface.h"
+#include <stddef.h>
+
+int navigable_faces_within_radius(
+    const float *const location, const float radius, const int face_count,
+    const int *const face_indices, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags,
+    const int maximum_results, int *const result_face_indices,
+    float *const result_distances_squared) {
+  int output = 0;
+  const float radius_squared = radius * radius;
+
+  for (int candidate_index = 0; candidate_index < face_count;
+       candidate_index++) {
+    const int face_index =
+        face_indices == NULL ? candidate_index : face_indices[candidate_index];
+
+    if (face_flags != NULL &&
+        ((face_flags[face_index] & include_flags) == 0 ||
+         (face_flags[face_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+
+    const float surface_distance =
+        (location[0] - relevant_face_vertex_locations[0]) *
+            relevant_face_normal[0] +
+        (location[1] - relevant_face_vertex_locations[1]) *
+            relevant_face_normal[1] +
+        (location[2] - relevant_face_vertex_locations[2]) *
+            relevant_face_normal[2];
+
+    if (surface_distance * surface_distance > radius_squared) {
+      continue;
+    }
+
+    float constrained_location[3];
+
+    constrain_to_navigable_surface(
+        location, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+        face_index, constrained_location);
+
+    const float delta[] = {
+        constrained_location[0] - location[0],
+        constrained_location[1] - location[1],
+        constrained_location[2] - location[2],
+    };
+
+    const float distance_squared =
+        delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+    if (distance_squared <= radius_squared) {
+      if (output < maximum_results) {
+        result_face_indices[output] = face_index;
+        result_distances_squared[output] = distance_squared;
+      }
+
+      output++;
+    }
+  }
+
+  return output;
+}
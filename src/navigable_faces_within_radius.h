@@ -0,0 +1,67 @@
+#ifndef NAVIGABLE_FACES_WITHIN_RADIUS_H
+
+#define NAVIGABLE_FACES_WITHIN_RADIUS_H
+
+/**
+ * Finds every navigable face within a given radius of a given location, in a
+ * single scan.
+ * @param location The 3D vector describing the location to search from.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param radius The maximum distance from the location to the surface of a
+ *               face for it to be found.  Behavior is undefined if NaN,
+ *               infinity, negative infinity or negative.
+ * @param face_count The number of faces to consider.  When face_indices is
+ *                   NULL, this is the number of faces in the navigation mesh.
+ * @param face_indices The indices of the faces to consider (e.g. candidates
+ *                     returned by a spatial index), or NULL to consider every
+ *                     face of the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to consider every face.
+ * @param include_flags When face_flags is not NULL, only faces with at least
+ *                      one of these flags are considered.
+ * @param exclude_flags When face_flags is not NULL, faces with any of these
+ *                      flags are not considered.
+ * @param maximum_results The number of faces which result_face_indices and
+ *                        result_distances_squared have space for.
+ * @param result_face_indices Overwritten with the indices of the faces found,
+ *                            in the order in which they were considered.  Any
+ *                            beyond maximum_results are not written.
+ * @param result_distances_squared Overwritten with the squared distance from
+ *                                 the location to the surface of each of the
+ *                                 faces written to result_face_indices.
+ * @return The number of faces within the radius, which may exceed
+ *         maximum_results.
+ */
+int navigable_faces_within_radius(
+    const float *const location, const float radius, const int face_count,
+    const int *const face_indices, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags,
+    const int maximum_results, int *const result_face_indices,
+    float *const result_distances_squared);
+
+#endif
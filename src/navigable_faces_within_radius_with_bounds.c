@@ -0,0 +1,181 @@
+#include "navigable_faces_within_radius_with_bounds.h"
+#include <stddef.h>
+
+static inline void
+constrain_to_edges(const float *const relevant_face_vertex_locations,
+                   const float *const relevant_edge_normals,
+                   const float *const relevant_edge_coefficients,
+                   const int relevant_face_vertex_count,
+                   float *const constrained_location) {
+  for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+       vertex_index++) {
+    const float *const relevant_face_vertex_location =
+        relevant_face_vertex_locations + vertex_index * 3;
+
+    const float edge_difference[] = {
+        constrained_location[0] - relevant_face_vertex_location[0],
+        constrained_location[1] - relevant_face_vertex_location[1],
+        constrained_location[2] - relevant_face_vertex_location[2],
+    };
+
+    const float *const relevant_edge_normal =
+        relevant_edge_normals + vertex_index * 3;
+
+    const float edge_distance = edge_difference[0] * relevant_edge_normal[0] +
+                                edge_difference[1] * relevant_edge_normal[1] +
+                                edge_difference[2] * relevant_edge_normal[2];
+
+    if (edge_distance > 0.0f) {
+      const float *const relevant_edge_coefficient =
+          relevant_edge_coefficients + vertex_index * 3;
+
+      const float unclamped =
+          edge_difference[0] * relevant_edge_coefficient[0] +
+          edge_difference[1] * relevant_edge_coefficient[1] +
+          edge_difference[2] * relevant_edge_coefficient[2];
+
+      if (unclamped <= 0.0f) {
+        constrained_location[0] = relevant_face_vertex_location[0];
+        constrained_location[1] = relevant_face_vertex_location[1];
+        constrained_location[2] = relevant_face_vertex_location[2];
+        return;
+      }
+
+      const float *const next_face_vertex_location =
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
+
+      if (unclamped >= 1.0f) {
+        constrained_location[0] = next_face_vertex_location[0];
+        constrained_location[1] = next_face_vertex_location[1];
+        constrained_location[2] = next_face_vertex_location[2];
+        return;
+      }
+
+      const float inverse = 1.0f - unclamped;
+
+      constrained_location[0] = relevant_face_vertex_location[0] * inverse +
+                                next_face_vertex_location[0] * unclamped;
+      constrained_location[1] = relevant_face_vertex_location[1] * inverse +
+                                next_face_vertex_location[1] * unclamped;
+      constrained_location[2] = relevant_face_vertex_location[2] * inverse +
+                                next_face_vertex_location[2] * unclamped;
+
+      return;
+    }
+  }
+}
+
+int navigable_faces_within_radius_with_bounds(
+    const float *const location, const float radius, const int face_count,
+    const int *const face_indices, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const face_plane_constants,
+    const float *const face_bounding_spheres, const float *const edge_normals,
+    const float *const edge_coefficients, const int *const face_flags,
+    const int include_flags, const int exclude_flags,
+    const int maximum_results, int *const result_face_indices,
+    float *const result_distances_squared) {
+  int output = 0;
+  const float radius_squared = radius * radius;
+
+  for (int candidate_index = 0; candidate_index < face_count;
+       candidate_index++) {
+    const int face_index =
+        face_indices == NULL ? candidate_index : face_indices[candidate_index];
+
+    if (face_flags != NULL &&
+        ((face_flags[face_index] & include_flags) == 0 ||
+         (face_flags[face_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
+    const float *const relevant_face_bounding_sphere =
+        face_bounding_spheres + face_index * 4;
+
+    const float center_delta[] = {
+        relevant_face_bounding_sphere[0] - location[0],
+        relevant_face_bounding_sphere[1] - location[1],
+        relevant_face_bounding_sphere[2] - location[2],
+    };
+
+    const float excess = center_delta[0] * center_delta[0] +
+                         center_delta[1] * center_delta[1] +
+                         center_delta[2] * center_delta[2] -
+                         relevant_face_bounding_sphere[3] - radius_squared;
+
+    if (excess > 0.0f &&
+        excess * excess >
+            4.0f * relevant_face_bounding_sphere[3] * radius_squared) {
+      continue;
+    }
+
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+
+    const float surface_distance = location[0] * relevant_face_normal[0] +
+                                   location[1] * relevant_face_normal[1] +
+                                   location[2] * relevant_face_normal[2] -
+                                   face_plane_constants[face_index];
+
+    if (surface_distance * surface_distance > radius_squared) {
+      continue;
+    }
+
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+
+    float constrained_location[] = {
+        location[0] - relevant_face_normal[0] * surface_distance,
+        location[1] - relevant_face_normal[1] * surface_distance,
+        location[2] - relevant_face_normal[2] * surface_distance,
+    };
+
+    const float *const relevant_edge_normals =
+        edge_normals + relevant_face_vertex_offset * 3;
+    const float *const relevant_edge_coefficients =
+        edge_coefficients + relevant_face_vertex_offset * 3;
+
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+    switch (relevant_face_vertex_count) {
+    case 3:
+      constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                         relevant_edge_coefficients, 3, constrained_location);
+      break;
+
+    case 4:
+      constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                         relevant_edge_coefficients, 4, constrained_location);
+      break;
+
+    default:
+      constrain_to_edges(relevant_face_vertex_locations, relevant_edge_normals,
+                         relevant_edge_coefficients, relevant_face_vertex_count,
+                         constrained_location);
+      break;
+    }
+
+    const float delta[] = {
+        constrained_location[0] - location[0],
+        constrained_location[1] - location[1],
+        constrained_location[2] - location[2],
+    };
+
+    const float distance_squared =
+        delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+    if (distance_squared <= radius_squared) {
+      if (output < maximum_results) {
+        result_face_indices[output] = face_index;
+        result_distances_squared[output] = distance_squared;
+      }
+
+      output++;
+    }
+  }
+
+  return output;
+}
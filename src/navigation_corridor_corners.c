@@ -0,0 +1,157 @@
+#include "navigation_corridor_corners.h"
+#include <stdbool.h>
+
+static void copy(const float *const source, float *const destination) {
+  destination[0] = source[0];
+  destination[1] = source[1];
+  destination[2] = source[2];
+}
+
+static bool equal(const float *const a, const float *const b) {
+  return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+static float cross(const float *const apex, const float *const a,
+                   const float *const b) {
+  return (a[0] - apex[0]) * (b[1] - apex[1]) -
+         (a[1] - apex[1]) * (b[0] - apex[0]);
+}
+
+static bool portal(const int portal_index, const float *const goal_location,
+                   const int corridor_length,
+                   const int *const corridor_face_indices,
+                   const int *const corridor_link_indices,
+                   const int *const face_vertex_counts,
+                   const int *const face_vertex_offsets,
+                   const float *const face_vertex_locations,
+                   const int *const face_edge_neighbor_counts,
+                   const int *const face_edge_neighbor_offsets,
+                   const int *const face_edge_neighbor_face_indices,
+                   const float *const link_start_locations, float *const left,
+                   float *const right) {
+  if (portal_index >= corridor_length) {
+    copy(goal_location, left);
+    copy(goal_location, right);
+    return true;
+  }
+
+  const int entered_corridor_index = corridor_length - 1 - portal_index;
+  const int link_index = corridor_link_indices[entered_corridor_index];
+
+  if (link_index != -1) {
+    copy(link_start_locations + link_index * 3, left);
+    copy(link_start_locations + link_index * 3, right);
+    return true;
+  }
+
+  const int face_index = corridor_face_indices[entered_corridor_index + 1];
+  const int entered_face_index = corridor_face_indices[entered_corridor_index];
+  const int face_vertex_offset = face_vertex_offsets[face_index];
+  const int face_vertex_count = face_vertex_counts[face_index];
+
+  int edge_index = 0;
+
+  for (int candidate_edge_index = 0; candidate_edge_index < face_vertex_count;
+       candidate_edge_index++) {
+    const int neighbor_offset =
+        face_edge_neighbor_offsets[face_vertex_offset + candidate_edge_index];
+    const int neighbor_count =
+        face_edge_neighbor_counts[face_vertex_offset + candidate_edge_index];
+
+    for (int neighbor_index = neighbor_offset;
+         neighbor_index < neighbor_offset + neighbor_count; neighbor_index++) {
+      if (face_edge_neighbor_face_indices[neighbor_index] ==
+          entered_face_index) {
+        edge_index = candidate_edge_index;
+      }
+    }
+  }
+
+  const int next_edge_index =
+      edge_index == face_vertex_count - 1 ? 0 : edge_index + 1;
+
+  copy(face_vertex_locations + (face_vertex_offset + next_edge_index) * 3,
+       left);
+  copy(face_vertex_locations + (face_vertex_offset + edge_index) * 3, right);
+
+  return false;
+}
+
+int navigation_corridor_corners(
+    const float *const location, const float *const goal_location,
+    const int corridor_length, const int *const corridor_face_indices,
+    const int *const corridor_link_indices,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const float *const link_start_locations, const int maximum_corner_count,
+    float *const result_corner_locations) {
+  float apex[3];
+  float funnel_left[3];
+  float funnel_right[3];
+  copy(location, apex);
+  copy(location, funnel_left);
+  copy(location, funnel_right);
+
+  int apex_portal_index = 0;
+  int left_portal_index = 0;
+  int right_portal_index = 0;
+  int corner_count = 0;
+
+  for (int portal_index = 1; corner_count < maximum_corner_count;
+       portal_index++) {
+    float left[3];
+    float right[3];
+
+    const bool final = portal(
+        portal_index, goal_location, corridor_length, corridor_face_indices,
+        corridor_link_indices, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_edge_neighbor_counts,
+        face_edge_neighbor_offsets, face_edge_neighbor_face_indices,
+        link_start_locations, left, right);
+
+    if (cross(apex, funnel_right, right) >= 0.0f) {
+      if (equal(apex, funnel_right) ||
+          cross(apex, funnel_left, right) <= 0.0f) {
+        copy(right, funnel_right);
+        right_portal_index = portal_index;
+      } else {
+        copy(funnel_left, result_corner_locations + corner_count * 3);
+        corner_count++;
+        copy(funnel_left, apex);
+        copy(funnel_left, funnel_right);
+        apex_portal_index = left_portal_index;
+        right_portal_index = left_portal_index;
+        portal_index = apex_portal_index;
+        continue;
+      }
+    }
+
+    if (cross(apex, funnel_left, left) <= 0.0f) {
+      if (equal(apex, funnel_left) ||
+          cross(apex, funnel_right, left) >= 0.0f) {
+        copy(left, funnel_left);
+        left_portal_index = portal_index;
+      } else {
+        copy(funnel_right, result_corner_locations + corner_count * 3);
+        corner_count++;
+        copy(funnel_right, apex);
+        copy(funnel_right, funnel_left);
+        apex_portal_index = right_portal_index;
+        left_portal_index = right_portal_index;
+        portal_index = apex_portal_index;
+        continue;
+      }
+    }
+
+    if (final) {
+      copy(left, result_corner_locations + corner_count * 3);
+      corner_count++;
+      break;
+    }
+  }
+
+  return corner_count;
+}
@@ -0,0 +1,77 @@
+#ifndef NAVIGATION_CORRIDOR_CORNERS_H
+
+#define NAVIGATION_CORRIDOR_CORNERS_H
+
+/**
+ * Finds the next few corners of the shortest route over the X and Y axes
+ * through a path corridor (see advance_navigation_corridor) using the funnel
+ * algorithm.  Portals (the edges shared by consecutive faces) are produced
+ * from the corridor as they are reached, and the search stops once
+ * maximum_corner_count corners have been found, so the cost of a call depends
+ * upon the number of corners requested rather than the length of the
+ * corridor.  Corners end at goal_location, or at the start of the first
+ * off-mesh link along the corridor (which should be followed, such as by
+ * traverse_navigation_link, before the corridor is advanced past it).
+ * @param location The 3D vector describing the agent's location, which should
+ *                 be within the last face of the corridor.  Behavior is
+ *                 undefined if any component is NaN, infinity or negative
+ *                 infinity.
+ * @param goal_location The 3D vector describing the location at which the
+ *                      corridor ends, which should be within the first face of
+ *                      the corridor.  Behavior is undefined if any component
+ *                      is NaN, infinity or negative infinity.
+ * @param corridor_length The number of faces in the corridor.  Behavior is
+ *                        undefined if less than 1.
+ * @param corridor_face_indices The index of each face along the corridor, goal
+ *                              first.  Behavior is undefined if any two
+ *                              consecutive faces not linked by
+ *                              corridor_link_indices are not neighbors.
+ * @param corridor_link_indices The index of the link followed to enter each
+ *                              face along the corridor from the face after it,
+ *                              or -1 where the face was entered by crossing an
+ *                              edge.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param link_start_locations A 3D vector describing the location at which
+ *                             each link starts.  May be NULL when no links are
+ *                             followed along the corridor.
+ * @param maximum_corner_count The number of corners which
+ *                             result_corner_locations has space for.
+ * @param result_corner_locations Overwritten with a 3D vector describing the
+ *                                location of each corner, in the order in
+ *                                which they are reached.
+ * @return The number of corners written, which does not exceed
+ *         maximum_corner_count.  The last corner written is goal_location or
+ *         the start of a link when fewer than maximum_corner_count corners
+ *         are found.
+ */
+int navigation_corridor_corners(
+    const float *const location, const float *const goal_location,
+    const int corridor_length, const int *const corridor_face_indices,
+    const int *const corridor_link_indices,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const float *const link_start_locations, const int maximum_corner_count,
+    float *const result_corner_locations);
+
+#endif
@@ -0,0 +1,30 @@
+#include "navigation_link_table.h"
+
+void navigation_link_table(const int link_count,
+                           const int *const link_start_face_indices,
+                           const int face_count, int *const face_link_offsets,
+                           int *const face_link_indices) {
+  for (int face_index = 0; face_index <= face_count; face_index++) {
+    face_link_offsets[face_index] = 0;
+  }
+
+  for (int link_index = 0; link_index < link_count; link_index++) {
+    face_link_offsets[link_start_face_indices[link_index] + 1]++;
+  }
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    face_link_offsets[face_index + 1] += face_link_offsets[face_index];
+  }
+
+  for (int link_index = 0; link_index < link_count; link_index++) {
+    const int face_index = link_start_face_indices[link_index];
+    face_link_indices[face_link_offsets[face_index]] = link_index;
+    face_link_offsets[face_index]++;
+  }
+
+  for (int face_index = face_count; face_index > 0; face_index--) {
+    face_link_offsets[face_index] = face_link_offsets[face_index - 1];
+  }
+
+  face_link_offsets[0] = 0;
+}
@@ -0,0 +1,27 @@
+#ifndef NAVIGATION_LINK_TABLE_H
+
+#define NAVIGATION_LINK_TABLE_H
+
+/**
+ * Groups the off-mesh links of a navigation mesh (such as jumps, ladders and
+ * teleporters) by the face from which they start, so that they can be followed
+ * by find_navigation_path.  Each link is one-way; a link which may be followed
+ * in both directions is described by two links.
+ * @param link_count The number of off-mesh links.
+ * @param link_start_face_indices The index of the face from which each link
+ *                                starts.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_link_offsets Overwritten with the exclusive running totals of the
+ *                          number of links which start from each face,
+ *                          followed by link_count.  Must have space for
+ *                          face_count + 1 values.
+ * @param face_link_indices Overwritten with the indices of the links which
+ *                          start from each face, grouped by face in ascending
+ *                          order.  Must have space for link_count values.
+ */
+void navigation_link_table(const int link_count,
+                           const int *const link_start_face_indices,
+                           const int face_count, int *const face_link_offsets,
+                           int *const face_link_indices);
+
+#endif
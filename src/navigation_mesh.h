@@ -0,0 +1,38 @@
+#ifndef NAVIGATION_MESH_H
+
+#define NAVIGATION_MESH_H
+
+/**
+ * Bundles the arrays describing a navigation mesh (see the parameters of the
+ * same names taken by closest_navigable_face, sliding_navigation_collision and
+ * find_navigation_path) so that they can be passed as one.  Nothing is ever
+ * written through a navigation mesh, so a single instance may be shared by any
+ * number of threads without locking, each with its own
+ * navigation_query_context.  face_flags, face_cost_multipliers,
+ * face_link_offsets and link_flags may be NULL (see find_navigation_path).
+ */
+struct navigation_mesh {
+  int face_count;
+  const int *face_vertex_counts;
+  const int *face_vertex_offsets;
+  const float *face_vertex_locations;
+  const float *face_normals;
+  const float *edge_normals;
+  const float *edge_exit_normals;
+  const float *edge_coefficients;
+  const float *vertex_up_normals;
+  const int *face_edge_neighbor_counts;
+  const int *face_edge_neighbor_offsets;
+  const int *face_edge_neighbor_face_indices;
+  const int *face_flags;
+  const float *face_cost_multipliers;
+  const int *face_link_offsets;
+  const int *face_link_indices;
+  const int *link_end_face_indices;
+  const float *link_start_locations;
+  const float *link_end_locations;
+  const float *link_costs;
+  const int *link_flags;
+};
+
+#endif
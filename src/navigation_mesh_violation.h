@@ -0,0 +1,49 @@
+#ifndef NAVIGATION_MESH_VIOLATION_H
+
+#define NAVIGATION_MESH_VIOLATION_H
+
+/**
+ * A face has fewer than 3 vertices.  No further checks are made against it.
+ */
+#define NAVIGATION_MESH_VIOLATION_TOO_FEW_VERTICES 0
+
+/**
+ * A face's surface normal is not of unit length.
+ */
+#define NAVIGATION_MESH_VIOLATION_NON_UNIT_FACE_NORMAL 1
+
+/**
+ * A vertex of a face does not lie on the plane of the face.
+ */
+#define NAVIGATION_MESH_VIOLATION_NON_PLANAR_FACE 2
+
+/**
+ * An edge normal is not of unit length.
+ */
+#define NAVIGATION_MESH_VIOLATION_NON_UNIT_EDGE_NORMAL 3
+
+/**
+ * An edge normal is not perpendicular to both its edge and its face's surface
+ * normal.
+ */
+#define NAVIGATION_MESH_VIOLATION_NON_PERPENDICULAR_EDGE_NORMAL 4
+
+/**
+ * An edge normal points into its face rather than out of it, meaning that the
+ * face's vertices are wound inconsistently with its surface normal.
+ */
+#define NAVIGATION_MESH_VIOLATION_INCONSISTENT_WINDING 5
+
+/**
+ * An edge coefficient does not point to the next vertex of the face with a
+ * magnitude equal to the reciprocal of the distance to that vertex.
+ */
+#define NAVIGATION_MESH_VIOLATION_INCORRECT_EDGE_COEFFICIENT 6
+
+/**
+ * The vertex after the next vertex of a face lies outside of an edge, meaning
+ * that the face is not convex.
+ */
+#define NAVIGATION_MESH_VIOLATION_NON_CONVEX_FACE 7
+
+#endif
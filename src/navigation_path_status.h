@@ -0,0 +1,22 @@
+#ifndef NAVIGATION_PATH_STATUS_H
+
+#define NAVIGATION_PATH_STATUS_H
+
+/**
+ * The search has not yet finished, and further steps are required.
+ */
+#define NAVIGATION_PATH_STATUS_IN_PROGRESS 0
+
+/**
+ * The search has reached the goal face, and a path can be retrieved using
+ * finish_navigation_path.
+ */
+#define NAVIGATION_PATH_STATUS_FOUND 1
+
+/**
+ * The search has exhausted every reachable face without reaching the goal
+ * face.
+ */
+#define NAVIGATION_PATH_STATUS_NOT_FOUND 2
+
+#endif
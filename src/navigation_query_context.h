@@ -0,0 +1,45 @@
+#ifndef NAVIGATION_QUERY_CONTEXT_H
+
+#define NAVIGATION_QUERY_CONTEXT_H
+
+/**
+ * The number of bytes which a navigation_query_context occupies.  This is a
+ * multiple of the cache line size of common processors, so that neighboring
+ * contexts within an array aligned to it never share a cache line.
+ */
+#define NAVIGATION_QUERY_CONTEXT_SIZE 64
+
+/**
+ * The mutable state used by one thread when querying a shared navigation_mesh.
+ * @param scratch The block of memory from which temporary storage is
+ *                allocated (see allocate_navigation_scratch).
+ * @param scratch_capacity The number of bytes in scratch.
+ * @param scratch_used The number of bytes of scratch currently allocated.
+ * @param face_index_hint The index of the face most recently found by
+ *                        query_closest_navigable_face, or -1 if none has been
+ *                        found.
+ * @param query_count The number of queries made using the context.
+ * @param scratch_exhausted_count The number of queries which failed as scratch
+ *                                was too small.
+ */
+struct navigation_query_state {
+  unsigned char *scratch;
+  int scratch_capacity;
+  int scratch_used;
+  int face_index_hint;
+  int query_count;
+  int scratch_exhausted_count;
+};
+
+/**
+ * A navigation_query_state padded to NAVIGATION_QUERY_CONTEXT_SIZE bytes.
+ * Only the context is written during a query, so threads each given their own
+ * context (with the array of contexts aligned to
+ * NAVIGATION_QUERY_CONTEXT_SIZE bytes) never contend.
+ */
+union navigation_query_context {
+  struct navigation_query_state state;
+  unsigned char padding[NAVIGATION_QUERY_CONTEXT_SIZE];
+};
+
+#endif
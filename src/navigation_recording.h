@@ -0,0 +1,79 @@
+#ifndef NAVIGATION_RECORDING_H
+
+#define NAVIGATION_RECORDING_H
+
+/**
+ * A record of a call to closest_navigable_face.  Each record starts with a
+ * single byte identifying its type, followed by its fields in the native byte
+ * order of the recording machine, without padding:
+ * - The location (3 floats).
+ * - The face count (int).
+ * - Whether face flags were given (1 byte, 0 or 1).
+ * - The include flags (int).
+ * - The exclude flags (int).
+ * - The returned face index (int).
+ */
+#define NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE 0
+
+/**
+ * A record of a call to constrain_to_navigable_surface:
+ * - The unconstrained location (3 floats).
+ * - The face index (int).
+ * - The constrained location (3 floats).
+ */
+#define NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_SURFACE 1
+
+/**
+ * A record of a call to constrain_to_navigable_volume:
+ * - The unconstrained location (3 floats).
+ * - The face index (int).
+ * - The constrained location (3 floats).
+ */
+#define NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME 2
+
+/**
+ * A record of a call to sliding_navigation_collision:
+ * - The location traveled from (3 floats).
+ * - The face index (int).
+ * - The location traveled to (3 floats).
+ * - The returned sliding navigation collision result (int).
+ * - The result from location (3 floats).
+ * - The result to location (3 floats).
+ * - The edge index, or -1 when no edge was collided with (int).
+ */
+#define NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION 3
+
+/**
+ * The number of bytes in a record of a call to closest_navigable_face,
+ * including its type.
+ */
+#define NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE 30
+
+/**
+ * The number of bytes in a record of a call to constrain_to_navigable_surface,
+ * including its type.
+ */
+#define NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_SURFACE_SIZE 29
+
+/**
+ * The number of bytes in a record of a call to constrain_to_navigable_volume,
+ * including its type.
+ */
+#define NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME_SIZE 29
+
+/**
+ * The number of bytes in a record of a call to sliding_navigation_collision,
+ * including its type.
+ */
+#define NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION_SIZE 61
+
+/**
+ * The record sizes above (and the offsets at which replay_navigation_recording
+ * reads fields) assume 4-byte ints and floats; these fail to compile should
+ * either differ, rather than producing recordings which cannot be read back.
+ */
+typedef char navigation_recording_int_size_check[sizeof(int) == 4 ? 1 : -1];
+typedef char
+    navigation_recording_float_size_check[sizeof(float) == 4 ? 1 : -1];
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef NAVIGATION_SCRATCH_H
+
+#define NAVIGATION_SCRATCH_H
+
+/**
+ * Returned in place of a result when the scratch memory given to a function
+ * (see allocate_navigation_scratch) is too small for its temporary storage.
+ * Nothing is written in this case.
+ */
+#define NAVIGATION_SCRATCH_EXHAUSTED -2
+
+#endif
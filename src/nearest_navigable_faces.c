@@ -0,0 +1,73 @@
+#include "nearest_navigable_faces.h"
+#include "constrain_to_navigable_surface.h"
+#include <stddef.h>
+
+int nearest_navigable_faces(
+    const float *const location, const int face_count,
+    const int *const face_indices, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags,
+    const int maximum_results, int *const result_face_indices,
+    float *const result_distances_squared) {
+  int output = 0;
+
+  if (maximum_results <= 0) {
+    return 0;
+  }
+
+  for (int candidate_index = 0; candidate_index < face_count;
+       candidate_index++) {
+    const int face_index =
+        face_indices == NULL ? candidate_index : face_indices[candidate_index];
+
+    if (face_flags != NULL &&
+        ((face_flags[face_index] & include_flags) == 0 ||
+         (face_flags[face_index] & exclude_flags) != 0)) {
+      continue;
+    }
+
+    float constrained_location[3];
+
+    constrain_to_navigable_surface(
+        location, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+        face_index, constrained_location);
+
+    const float delta[] = {
+        constrained_location[0] - location[0],
+        constrained_location[1] - location[1],
+        constrained_location[2] - location[2],
+    };
+
+    const float distance_squared =
+        delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+    int insertion_index;
+
+    if (output < maximum_results) {
+      insertion_index = output;
+      output++;
+    } else if (distance_squared < result_distances_squared[output - 1]) {
+      insertion_index = output - 1;
+    } else {
+      continue;
+    }
+
+    while (insertion_index > 0 &&
+           result_distances_squared[insertion_index - 1] > distance_squared) {
+      result_face_indices[insertion_index] =
+          result_face_indices[insertion_index - 1];
+      result_distances_squared[insertion_index] =
+          result_distances_squared[insertion_index - 1];
+      insertion_index--;
+    }
+
+    result_face_indices[insertion_index] = face_index;
+    result_distances_squared[insertion_index] = distance_squared;
+  }
+
+  return output;
+}
@@ -0,0 +1,64 @@
+#ifndef NEAREST_NAVIGABLE_FACES_H
+
+#define NEAREST_NAVIGABLE_FACES_H
+
+/**
+ * Finds the navigable faces nearest to a given location, in a single scan.
+ * @param location The 3D vector describing the location to search from.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param face_count The number of faces to consider.  When face_indices is
+ *                   NULL, this is the number of faces in the navigation mesh.
+ * @param face_indices The indices of the faces to consider (e.g. candidates
+ *                     returned by a spatial index), or NULL to consider every
+ *                     face of the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to consider every face.
+ * @param include_flags When face_flags is not NULL, only faces with at least
+ *                      one of these flags are considered.
+ * @param exclude_flags When face_flags is not NULL, faces with any of these
+ *                      flags are not considered.
+ * @param maximum_results The maximum number of faces to find (k).
+ * @param result_face_indices Overwritten with the indices of the nearest faces,
+ *                            nearest first.  Must have space for
+ *                            maximum_results indices.
+ * @param result_distances_squared Overwritten with the squared distance from
+ *                                 the location to the surface of each of the
+ *                                 faces written to result_face_indices.  Must
+ *                                 have space for maximum_results values.
+ * @return The number of faces written to result_face_indices, which is the
+ *         number of faces considered (see face_count, face_indices and the
+ *         flags) which passed the flags, capped at maximum_results.
+ */
+int nearest_navigable_faces(
+    const float *const location, const int face_count,
+    const int *const face_indices, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags,
+    const int maximum_results, int *const result_face_indices,
+    float *const result_distances_squared);
+
+#endif
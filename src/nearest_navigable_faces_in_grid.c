@@ -0,0 +1,140 @@
+#include "nearest_navigable_faces_in_grid.h"
+#include "constrain_to_navigable_surface.h"
+#include "navigable_face_grid_bucket.h"
+#include <stddef.h>
+
+static int cell(const float coordinate, const float cell_size) {
+  const float scaled = coordinate / cell_size;
+  const int truncated = (int)scaled;
+  return scaled < truncated ? truncated - 1 : truncated;
+}
+
+static float searched_distance(const float *const location,
+                               const float cell_size, const int cell_x,
+                               const int cell_y, const int ring) {
+  const float distances[] = {
+      location[0] - (float)(cell_x - ring) * cell_size,
+      (float)(cell_x + ring + 1) * cell_size - location[0],
+      location[1] - (float)(cell_y - ring) * cell_size,
+      (float)(cell_y + ring + 1) * cell_size - location[1],
+  };
+
+  float output = distances[0];
+
+  for (int index = 1; index < 4; index++) {
+    output = distances[index] < output ? distances[index] : output;
+  }
+
+  return output;
+}
+
+int nearest_navigable_faces_in_grid(
+    const float *const location, const float cell_size, const int bucket_count,
+    const int *const bucket_face_offsets, const int *const bucket_face_indices,
+    const int maximum_rings, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags,
+    const int maximum_results, int *const result_face_indices,
+    float *const result_distances_squared) {
+  int output = 0;
+
+  if (maximum_results <= 0) {
+    return 0;
+  }
+
+  const int location_cell_x = cell(location[0], cell_size);
+  const int location_cell_y = cell(location[1], cell_size);
+
+  for (int ring = 0; ring <= maximum_rings; ring++) {
+    for (int cell_y = location_cell_y - ring;
+         cell_y <= location_cell_y + ring; cell_y++) {
+      const int step = cell_y == location_cell_y - ring ||
+                               cell_y == location_cell_y + ring
+                           ? 1
+                           : ring * 2;
+
+      for (int cell_x = location_cell_x - ring;
+           cell_x <= location_cell_x + ring; cell_x += step) {
+        const int bucket_index =
+            navigable_face_grid_bucket(cell_x, cell_y, bucket_count);
+        const int end = bucket_face_offsets[bucket_index + 1];
+
+        for (int entry_index = bucket_face_offsets[bucket_index];
+             entry_index < end; entry_index++) {
+          const int face_index = bucket_face_indices[entry_index];
+
+          if (face_flags != NULL &&
+              ((face_flags[face_index] & include_flags) == 0 ||
+               (face_flags[face_index] & exclude_flags) != 0)) {
+            continue;
+          }
+
+          int existing_index = 0;
+
+          while (existing_index < output &&
+                 result_face_indices[existing_index] != face_index) {
+            existing_index++;
+          }
+
+          if (existing_index < output) {
+            continue;
+          }
+
+          float constrained_location[3];
+
+          constrain_to_navigable_surface(
+              location, face_vertex_counts, face_vertex_offsets,
+              face_vertex_locations, face_normals, edge_normals,
+              edge_coefficients, face_index, constrained_location);
+
+          const float delta[] = {
+              constrained_location[0] - location[0],
+              constrained_location[1] - location[1],
+              constrained_location[2] - location[2],
+          };
+
+          const float distance_squared =
+              delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+          int insertion_index;
+
+          if (output < maximum_results) {
+            insertion_index = output;
+            output++;
+          } else if (distance_squared < result_distances_squared[output - 1]) {
+            insertion_index = output - 1;
+          } else {
+            continue;
+          }
+
+          while (insertion_index > 0 &&
+                 result_distances_squared[insertion_index - 1] >
+                     distance_squared) {
+            result_face_indices[insertion_index] =
+                result_face_indices[insertion_index - 1];
+            result_distances_squared[insertion_index] =
+                result_distances_squared[insertion_index - 1];
+            insertion_index--;
+          }
+
+          result_face_indices[insertion_index] = face_index;
+          result_distances_squared[insertion_index] = distance_squared;
+        }
+      }
+    }
+
+    if (output == maximum_results) {
+      const float distance = searched_distance(
+          location, cell_size, location_cell_x, location_cell_y, ring);
+
+      if (result_distances_squared[output - 1] <= distance * distance) {
+        break;
+      }
+    }
+  }
+
+  return output;
+}
@@ -0,0 +1,91 @@
+#include "query_closest_navigable_face.h"
+#include "constrain_to_navigable_surface.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static bool is_considered(const struct navigation_mesh *const mesh,
+                          const int face_index, const int include_flags,
+                          const int exclude_flags) {
+  return mesh->face_flags == NULL ||
+         ((mesh->face_flags[face_index] & include_flags) != 0 &&
+          (mesh->face_flags[face_index] & exclude_flags) == 0);
+}
+
+static float distance_squared(const struct navigation_mesh *const mesh,
+                              const float *const location,
+                              const int face_index) {
+  float constrained_location[3];
+
+  constrain_to_navigable_surface(
+      location, mesh->face_vertex_counts, mesh->face_vertex_offsets,
+      mesh->face_vertex_locations, mesh->face_normals, mesh->edge_normals,
+      mesh->edge_coefficients, face_index, constrained_location);
+
+  const float delta[] = {
+      constrained_location[0] - location[0],
+      constrained_location[1] - location[1],
+      constrained_location[2] - location[2],
+  };
+
+  return delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+}
+
+int query_closest_navigable_face(const struct navigation_mesh *const mesh,
+                                 union navigation_query_context *const context,
+                                 const float *const location,
+                                 const int include_flags,
+                                 const int exclude_flags) {
+  const int hint = context->state.face_index_hint;
+
+  int output = -1;
+  float best_distance_squared = 1.0f / 0.0f;
+
+  if (hint >= 0 && hint < mesh->face_count &&
+      is_considered(mesh, hint, include_flags, exclude_flags)) {
+    output = hint;
+    best_distance_squared = distance_squared(mesh, location, hint);
+  }
+
+  for (int face_index = 0; face_index < mesh->face_count; face_index++) {
+    if (face_index == hint ||
+        !is_considered(mesh, face_index, include_flags, exclude_flags)) {
+      continue;
+    }
+
+    const float *const relevant_face_vertex_location =
+        mesh->face_vertex_locations +
+        mesh->face_vertex_offsets[face_index] * 3;
+    const float *const relevant_face_normal =
+        mesh->face_normals + face_index * 3;
+
+    const float surface_distance =
+        (location[0] - relevant_face_vertex_location[0]) *
+            relevant_face_normal[0] +
+        (location[1] - relevant_face_vertex_location[1]) *
+            relevant_face_normal[1] +
+        (location[2] - relevant_face_vertex_location[2]) *
+            relevant_face_normal[2];
+
+    if (surface_distance * surface_distance > best_distance_squared) {
+      continue;
+    }
+
+    const float face_distance_squared =
+        distance_squared(mesh, location, face_index);
+
+    if (face_distance_squared < best_distance_squared ||
+        (face_distance_squared == best_distance_squared &&
+         face_index > output)) {
+      output = face_index;
+      best_distance_squared = face_distance_squared;
+    }
+  }
+
+  context->state.query_count++;
+
+  if (output != -1) {
+    context->state.face_index_hint = output;
+  }
+
+  return output;
+}
@@ -0,0 +1,37 @@
+#ifndef QUERY_CLOSEST_NAVIGABLE_FACE_H
+
+#define QUERY_CLOSEST_NAVIGABLE_FACE_H
+
+#include "navigation_mesh.h"
+#include "navigation_query_context.h"
+
+/**
+ * Finds the closest navigable face to a given location on a shared navigation
+ * mesh, as closest_navigable_face does, recording the query and its result in
+ * a per-thread context.  The face found by the previous query using the same
+ * context is measured first, and any face whose plane is farther away than it
+ * is skipped without being measured, so that queries from locations which
+ * move only a little at a time are cheap.  Results may differ from those of
+ * closest_navigable_face by floating point rounding where faces are almost
+ * equally close.
+ * @param mesh The navigation mesh to search, which is not modified.
+ * @param context The context of the calling thread.  Its query count is
+ *                incremented and, when a face is found, its face index hint
+ *                is overwritten.
+ * @param location The 3D vector describing the location to search from.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param include_flags When the mesh's face_flags is not NULL, only faces with
+ *                      at least one of these flags are considered.
+ * @param exclude_flags When the mesh's face_flags is not NULL, faces with any
+ *                      of these flags are not considered.
+ * @return The index of the closest face to the given location, or -1 if no
+ *         face was considered.
+ */
+int query_closest_navigable_face(const struct navigation_mesh *const mesh,
+                                 union navigation_query_context *const context,
+                                 const float *const location,
+                                 const int include_flags,
+                                 const int exclude_flags);
+
+#endif
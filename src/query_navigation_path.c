@@ -0,0 +1,32 @@
+#include "query_navigation_path.h"
+#include "find_navigation_path_in_scratch.h"
+#include "navigation_scratch.h"
+
+int query_navigation_path(
+    const struct navigation_mesh *const mesh,
+    union navigation_query_context *const context,
+    const float *const start_location, const int start_face_index,
+    const float *const goal_location, const int goal_face_index,
+    const int include_flags, const int exclude_flags,
+    const int maximum_path_length, int *const result_face_indices,
+    int *const result_link_indices) {
+  const int output = find_navigation_path_in_scratch(
+      start_location, start_face_index, goal_location, goal_face_index,
+      mesh->face_count, mesh->face_vertex_counts, mesh->face_vertex_offsets,
+      mesh->face_vertex_locations, mesh->face_edge_neighbor_counts,
+      mesh->face_edge_neighbor_offsets, mesh->face_edge_neighbor_face_indices,
+      mesh->face_flags, mesh->face_cost_multipliers, mesh->face_link_offsets,
+      mesh->face_link_indices, mesh->link_end_face_indices,
+      mesh->link_start_locations, mesh->link_end_locations, mesh->link_costs,
+      mesh->link_flags, include_flags, exclude_flags, context->state.scratch,
+      context->state.scratch_capacity, &context->state.scratch_used,
+      maximum_path_length, result_face_indices, result_link_indices);
+
+  context->state.query_count++;
+
+  if (output == NAVIGATION_SCRATCH_EXHAUSTED) {
+    context->state.scratch_exhausted_count++;
+  }
+
+  return output;
+}
@@ -0,0 +1,54 @@
+#ifndef QUERY_NAVIGATION_PATH_H
+
+#define QUERY_NAVIGATION_PATH_H
+
+#include "navigation_mesh.h"
+#include "navigation_query_context.h"
+
+/**
+ * Calls find_navigation_path_in_scratch on a shared navigation mesh, including
+ * its face cost multipliers and off-mesh links, and taking temporary storage
+ * from the scratch memory of a per-thread context.
+ * @param mesh The navigation mesh to search, which is not modified.
+ * @param context The context of the calling thread.  Its query count is
+ *                incremented, as is its scratch exhausted count should its
+ *                scratch be too small (see
+ *                find_navigation_path_scratch_size).
+ * @param start_location The 3D vector describing the location to find a path
+ *                       from.  Behavior is undefined if any component is NaN,
+ *                       infinity or negative infinity.
+ * @param start_face_index The index of the face containing start_location.
+ * @param goal_location The 3D vector describing the location to find a path
+ *                      to.  Behavior is undefined if any component is NaN,
+ *                      infinity or negative infinity.
+ * @param goal_face_index The index of the face containing goal_location.
+ * @param include_flags Only faces (other than the start face) and links with
+ *                      at least one of these flags are entered, where the
+ *                      mesh's face_flags or link_flags respectively is not
+ *                      NULL.
+ * @param exclude_flags Faces (other than the start face) and links with any of
+ *                      these flags are not entered, where the mesh's
+ *                      face_flags or link_flags respectively is not NULL.
+ * @param maximum_path_length The number of faces which result_face_indices and
+ *                            result_link_indices have space for.
+ * @param result_face_indices Overwritten with the index of each face along the
+ *                            path (see find_navigation_path).
+ * @param result_link_indices Overwritten with the index of the link followed to
+ *                            reach each face along the path, or -1 where it
+ *                            was entered across an edge (see
+ *                            find_navigation_path).
+ * @return The number of faces along the path, which may exceed
+ *         maximum_path_length, -1 if no path exists, or
+ *         NAVIGATION_SCRATCH_EXHAUSTED should the context's scratch be too
+ *         small.
+ */
+int query_navigation_path(
+    const struct navigation_mesh *const mesh,
+    union navigation_query_context *const context,
+    const float *const start_location, const int start_face_index,
+    const float *const goal_location, const int goal_face_index,
+    const int include_flags, const int exclude_flags,
+    const int maximum_path_length, int *const result_face_indices,
+    int *const result_link_indices);
+
+#endif
@@ -0,0 +1,227 @@
+#include "rebake_navigable_faces.h"
+#include "square_root.h"
+#include <stdbool.h>
+
+static bool normalize(float *const vector) {
+  const float magnitude =
+      square_root(vector[0] * vector[0] + vector[1] * vector[1] +
+                  vector[2] * vector[2]);
+
+  if (magnitude == 0.0f) {
+    return false;
+  }
+
+  vector[0] /= magnitude;
+  vector[1] /= magnitude;
+  vector[2] /= magnitude;
+  return true;
+}
+
+static void bake_face(const int vertex_count,
+                      const float *const vertex_locations,
+                      float *const face_normal, float *const edge_normals,
+                      float *const edge_coefficients) {
+  face_normal[0] = 0.0f;
+  face_normal[1] = 0.0f;
+  face_normal[2] = 0.0f;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float *const next_location = vertex_index == vertex_count - 1
+                                           ? vertex_locations
+                                           : relevant_location + 3;
+
+    face_normal[0] += (relevant_location[1] - next_location[1]) *
+                      (relevant_location[2] + next_location[2]);
+    face_normal[1] += (relevant_location[2] - next_location[2]) *
+                      (relevant_location[0] + next_location[0]);
+    face_normal[2] += (relevant_location[0] - next_location[0]) *
+                      (relevant_location[1] + next_location[1]);
+  }
+
+  normalize(face_normal);
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float *const next_location = vertex_index == vertex_count - 1
+                                           ? vertex_locations
+                                           : relevant_location + 3;
+    float *const relevant_edge_normal = edge_normals + vertex_index * 3;
+    float *const relevant_edge_coefficient =
+        edge_coefficients + vertex_index * 3;
+
+    const float edge[] = {
+        next_location[0] - relevant_location[0],
+        next_location[1] - relevant_location[1],
+        next_location[2] - relevant_location[2],
+    };
+
+    const float edge_length_squared =
+        edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2];
+
+    relevant_edge_normal[0] =
+        edge[1] * face_normal[2] - edge[2] * face_normal[1];
+    relevant_edge_normal[1] =
+        edge[2] * face_normal[0] - edge[0] * face_normal[2];
+    relevant_edge_normal[2] =
+        edge[0] * face_normal[1] - edge[1] * face_normal[0];
+    normalize(relevant_edge_normal);
+
+    if (edge_length_squared == 0.0f) {
+      relevant_edge_coefficient[0] = 0.0f;
+      relevant_edge_coefficient[1] = 0.0f;
+      relevant_edge_coefficient[2] = 0.0f;
+    } else {
+      relevant_edge_coefficient[0] = edge[0] / edge_length_squared;
+      relevant_edge_coefficient[1] = edge[1] / edge_length_squared;
+      relevant_edge_coefficient[2] = edge[2] / edge_length_squared;
+    }
+  }
+}
+
+static void bake_exits(const int face_index,
+                       const int *const face_vertex_counts,
+                       const int *const face_vertex_offsets,
+                       const int *const face_edge_neighbor_counts,
+                       const int *const face_edge_neighbor_offsets,
+                       const int *const face_edge_neighbor_face_indices,
+                       const float *const face_normals,
+                       const float *const edge_normals,
+                       float *const edge_exit_normals,
+                       float *const vertex_up_normals) {
+  const int vertex_count = face_vertex_counts[face_index];
+  const int vertex_offset = face_vertex_offsets[face_index];
+
+  for (int edge_index = vertex_offset;
+       edge_index < vertex_offset + vertex_count; edge_index++) {
+    const float *const relevant_edge_normal = edge_normals + edge_index * 3;
+    float *const relevant_exit_normal = edge_exit_normals + edge_index * 3;
+
+    relevant_exit_normal[0] = relevant_edge_normal[0];
+    relevant_exit_normal[1] = relevant_edge_normal[1];
+    relevant_exit_normal[2] = relevant_edge_normal[2];
+
+    const int neighbor_offset = face_edge_neighbor_offsets[edge_index];
+    const int neighbor_count = face_edge_neighbor_counts[edge_index];
+
+    for (int neighbor_index = neighbor_offset;
+         neighbor_index < neighbor_offset + neighbor_count; neighbor_index++) {
+      const int neighbor_face_index =
+          face_edge_neighbor_face_indices[neighbor_index];
+      const int neighbor_vertex_offset =
+          face_vertex_offsets[neighbor_face_index];
+      const int neighbor_vertex_count = face_vertex_counts[neighbor_face_index];
+
+      for (int neighbor_edge_index = neighbor_vertex_offset;
+           neighbor_edge_index < neighbor_vertex_offset + neighbor_vertex_count;
+           neighbor_edge_index++) {
+        const int other_offset =
+            face_edge_neighbor_offsets[neighbor_edge_index];
+        const int other_count = face_edge_neighbor_counts[neighbor_edge_index];
+        bool matches = false;
+
+        for (int other_index = other_offset;
+             other_index < other_offset + other_count; other_index++) {
+          if (face_edge_neighbor_face_indices[other_index] == face_index) {
+            matches = true;
+            break;
+          }
+        }
+
+        if (matches) {
+          const float *const neighbor_edge_normal =
+              edge_normals + neighbor_edge_index * 3;
+
+          relevant_exit_normal[0] -= neighbor_edge_normal[0];
+          relevant_exit_normal[1] -= neighbor_edge_normal[1];
+          relevant_exit_normal[2] -= neighbor_edge_normal[2];
+          break;
+        }
+      }
+    }
+
+    if (!normalize(relevant_exit_normal)) {
+      relevant_exit_normal[0] = relevant_edge_normal[0];
+      relevant_exit_normal[1] = relevant_edge_normal[1];
+      relevant_exit_normal[2] = relevant_edge_normal[2];
+    }
+  }
+
+  const float *const face_normal = face_normals + face_index * 3;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const previous_exit_normal =
+        edge_exit_normals +
+        (vertex_offset +
+         (vertex_index == 0 ? vertex_count - 1 : vertex_index - 1)) *
+            3;
+    const float *const relevant_exit_normal =
+        edge_exit_normals + (vertex_offset + vertex_index) * 3;
+    float *const relevant_up_normal =
+        vertex_up_normals + (vertex_offset + vertex_index) * 3;
+
+    relevant_up_normal[0] = relevant_exit_normal[1] * previous_exit_normal[2] -
+                            relevant_exit_normal[2] * previous_exit_normal[1];
+    relevant_up_normal[1] = relevant_exit_normal[2] * previous_exit_normal[0] -
+                            relevant_exit_normal[0] * previous_exit_normal[2];
+    relevant_up_normal[2] = relevant_exit_normal[0] * previous_exit_normal[1] -
+                            relevant_exit_normal[1] * previous_exit_normal[0];
+
+    if (!normalize(relevant_up_normal)) {
+      relevant_up_normal[0] = face_normal[0];
+      relevant_up_normal[1] = face_normal[1];
+      relevant_up_normal[2] = face_normal[2];
+    } else if (relevant_up_normal[0] * face_normal[0] +
+                   relevant_up_normal[1] * face_normal[1] +
+                   relevant_up_normal[2] * face_normal[2] <
+               0.0f) {
+      relevant_up_normal[0] = -relevant_up_normal[0];
+      relevant_up_normal[1] = -relevant_up_normal[1];
+      relevant_up_normal[2] = -relevant_up_normal[2];
+    }
+  }
+}
+
+void rebake_navigable_faces(
+    const int dirty_face_count, const int *const dirty_face_indices,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices, float *const face_normals,
+    float *const edge_normals, float *const edge_exit_normals,
+    float *const edge_coefficients, float *const vertex_up_normals) {
+  for (int dirty_index = 0; dirty_index < dirty_face_count; dirty_index++) {
+    const int face_index = dirty_face_indices[dirty_index];
+    const int vertex_offset = face_vertex_offsets[face_index];
+
+    bake_face(face_vertex_counts[face_index],
+              face_vertex_locations + vertex_offset * 3,
+              face_normals + face_index * 3, edge_normals + vertex_offset * 3,
+              edge_coefficients + vertex_offset * 3);
+  }
+
+  for (int dirty_index = 0; dirty_index < dirty_face_count; dirty_index++) {
+    const int face_index = dirty_face_indices[dirty_index];
+    const int vertex_offset = face_vertex_offsets[face_index];
+    const int vertex_count = face_vertex_counts[face_index];
+
+    bake_exits(face_index, face_vertex_counts, face_vertex_offsets,
+               face_edge_neighbor_counts, face_edge_neighbor_offsets,
+               face_edge_neighbor_face_indices, face_normals, edge_normals,
+               edge_exit_normals, vertex_up_normals);
+
+    const int last_edge_index = vertex_offset + vertex_count - 1;
+    const int neighbor_end = face_edge_neighbor_offsets[last_edge_index] +
+                             face_edge_neighbor_counts[last_edge_index];
+
+    for (int neighbor_index = face_edge_neighbor_offsets[vertex_offset];
+         neighbor_index < neighbor_end; neighbor_index++) {
+      bake_exits(face_edge_neighbor_face_indices[neighbor_index],
+                 face_vertex_counts, face_vertex_offsets,
+                 face_edge_neighbor_counts, face_edge_neighbor_offsets,
+                 face_edge_neighbor_face_indices, face_normals, edge_normals,
+                 edge_exit_normals, vertex_up_normals);
+    }
+  }
+}
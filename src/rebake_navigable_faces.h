@@ -0,0 +1,74 @@
+#ifndef REBAKE_NAVIGABLE_FACES_H
+
+#define REBAKE_NAVIGABLE_FACES_H
+
+/**
+ * Recalculates the derived data of the faces of a navigation mesh whose
+ * vertices have been moved, as well as that of their neighboring faces (whose
+ * edge exit normals and vertex up normals depend upon the moved faces).  The
+ * time taken is proportional to the number of moved faces and their
+ * neighbors, not to the size of the navigation mesh, making it suitable for
+ * live editing.  As vertices are not shared between faces, every face
+ * containing a copy of a moved vertex must be listed.  The neighbor lists are
+ * not recalculated, so edits which change connectivity require a full export.
+ * @param dirty_face_count The number of faces whose vertices have been moved.
+ * @param dirty_face_indices The index of each face whose vertices have been
+ *                           moved.  Repeated indices are permitted, but waste
+ *                           time.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is undefined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh,
+ *                              after the edit.  Behavior is undefined if any
+ *                              component is NaN, infinity or negative
+ *                              infinity, or if any face is not planar.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.  Those of the moved
+ *                     faces are overwritten.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.  Those of the moved faces
+ *                     are overwritten.
+ * @param edge_exit_normals A 3D unit vector for each edge of each face of the
+ *                          navigation mesh, pointing out of the face.  Where
+ *                          no neighbors exist, this is equal to the edge
+ *                          normal.  It is otherwise averaged with the edge
+ *                          normals of the neighboring faces' matching edges.
+ *                          Those of the moved faces and their neighbors are
+ *                          overwritten.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.  Those of the moved
+ *                          faces are overwritten.
+ * @param vertex_up_normals A 3D unit vector for each vertex of each face of
+ *                          the navigation mesh, perpendicular to the edge exit
+ *                          normal either side of it and facing up (same
+ *                          general direction as face normal).  Those of the
+ *                          moved faces and their neighbors are overwritten.
+ */
+void rebake_navigable_faces(
+    const int dirty_face_count, const int *const dirty_face_indices,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices, float *const face_normals,
+    float *const edge_normals, float *const edge_exit_normals,
+    float *const edge_coefficients, float *const vertex_up_normals);
+
+#endif
@@ -0,0 +1,38 @@
+#include "record_closest_navigable_face.h"
+#include "closest_navigable_face.h"
+#include "navigation_recording.h"
+#include "write_bytes.h"
+#include <stddef.h>
+
+int record_closest_navigable_face(
+    const float *const location, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, const int recording_capacity,
+    unsigned char *const recording, int *const recording_length) {
+  const int output = closest_navigable_face(
+      location, face_count, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+      face_flags, include_flags, exclude_flags);
+
+  if (*recording_length <=
+      recording_capacity - NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE) {
+    const unsigned char type = NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE;
+    const unsigned char filtered = face_flags == NULL ? 0 : 1;
+
+    unsigned char *destination = recording + *recording_length;
+    destination = write_bytes(destination, &type, sizeof(type));
+    destination = write_bytes(destination, location, sizeof(float) * 3);
+    destination = write_bytes(destination, &face_count, sizeof(int));
+    destination = write_bytes(destination, &filtered, sizeof(filtered));
+    destination = write_bytes(destination, &include_flags, sizeof(int));
+    destination = write_bytes(destination, &exclude_flags, sizeof(int));
+    write_bytes(destination, &output, sizeof(int));
+  }
+
+  *recording_length += NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE;
+
+  return output;
+}
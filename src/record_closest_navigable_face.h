@@ -0,0 +1,28 @@
+#ifndef RECORD_CLOSEST_NAVIGABLE_FACE_H
+
+#define RECORD_CLOSEST_NAVIGABLE_FACE_H
+
+/**
+ * Calls closest_navigable_face, then appends a record of its inputs and output
+ * (see NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE) to a recording.
+ * Parameters and return value are otherwise identical to those of
+ * closest_navigable_face.
+ * @param recording_capacity The number of bytes which recording has space for.
+ * @param recording The bytes to which the record is appended.  The record is
+ *                  not written if it would not fit within
+ *                  recording_capacity.
+ * @param recording_length The number of bytes recorded so far, which is
+ *                         incremented by the size of the record even when it
+ *                         was not written.  A value greater than
+ *                         recording_capacity indicates that records were lost.
+ */
+int record_closest_navigable_face(
+    const float *const location, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, const int recording_capacity,
+    unsigned char *const recording, int *const recording_length);
+
+#endif
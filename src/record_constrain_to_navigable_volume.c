@@ -0,0 +1,41 @@
+#include "record_constrain_to_navigable_volume.h"
+#include "constrain_to_navigable_volume.h"
+#include "navigation_recording.h"
+#include "write_bytes.h"
+
+void record_constrain_to_navigable_volume(
+    const float *const unconstrained_location,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals, const float *const edge_normals,
+    const float *const edge_coefficients, const float *const vertex_up_normals,
+    const int face_index, float *const constrained_location,
+    const int recording_capacity, unsigned char *const recording,
+    int *const recording_length) {
+  const float original_location[] = {
+      unconstrained_location[0],
+      unconstrained_location[1],
+      unconstrained_location[2],
+  };
+
+  constrain_to_navigable_volume(
+      unconstrained_location, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals, edge_normals,
+      edge_coefficients, vertex_up_normals, face_index, constrained_location);
+
+  if (*recording_length <=
+      recording_capacity -
+          NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME_SIZE) {
+    const unsigned char type =
+        NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME;
+
+    unsigned char *destination = recording + *recording_length;
+    destination = write_bytes(destination, &type, sizeof(type));
+    destination =
+        write_bytes(destination, original_location, sizeof(float) * 3);
+    destination = write_bytes(destination, &face_index, sizeof(int));
+    write_bytes(destination, constrained_location, sizeof(float) * 3);
+  }
+
+  *recording_length += NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME_SIZE;
+}
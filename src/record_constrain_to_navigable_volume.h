@@ -0,0 +1,29 @@
+#ifndef RECORD_CONSTRAIN_TO_NAVIGABLE_VOLUME_H
+
+#define RECORD_CONSTRAIN_TO_NAVIGABLE_VOLUME_H
+
+/**
+ * Calls constrain_to_navigable_volume, then appends a record of its inputs
+ * and output (see NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME) to a
+ * recording.  Parameters are otherwise identical to those of
+ * constrain_to_navigable_volume.
+ * @param recording_capacity The number of bytes which recording has space for.
+ * @param recording The bytes to which the record is appended.  The record is
+ *                  not written if it would not fit within
+ *                  recording_capacity.
+ * @param recording_length The number of bytes recorded so far, which is
+ *                         incremented by the size of the record even when it
+ *                         was not written.  A value greater than
+ *                         recording_capacity indicates that records were lost.
+ */
+void record_constrain_to_navigable_volume(
+    const float *const unconstrained_location,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals, const float *const edge_normals,
+    const float *const edge_coefficients, const float *const vertex_up_normals,
+    const int face_index, float *const constrained_location,
+    const int recording_capacity, unsigned char *const recording,
+    int *const recording_length);
+
+#endif
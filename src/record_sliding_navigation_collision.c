@@ -0,0 +1,46 @@
+#include "record_sliding_navigation_collision.h"
+#include "navigation_recording.h"
+#include "sliding_navigation_collision.h"
+#include "sliding_navigation_collision_result.h"
+#include "write_bytes.h"
+
+int record_sliding_navigation_collision(
+    const float *const from, const int face_index, const float *const to,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts, float *const result_from,
+    float *const result_to, int *const edge_index,
+    const int recording_capacity, unsigned char *const recording,
+    int *const recording_length) {
+  const float original_from[] = {from[0], from[1], from[2]};
+  const float original_to[] = {to[0], to[1], to[2]};
+
+  const int output = sliding_navigation_collision(
+      from, face_index, to, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals,
+      face_edge_neighbor_counts, result_from, result_to, edge_index);
+
+  if (*recording_length <=
+      recording_capacity -
+          NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION_SIZE) {
+    const unsigned char type =
+        NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION;
+    const int recorded_edge_index =
+        output == SLIDING_NAVIGATION_COLLISION_RESULT_EDGE ? *edge_index : -1;
+
+    unsigned char *destination = recording + *recording_length;
+    destination = write_bytes(destination, &type, sizeof(type));
+    destination = write_bytes(destination, original_from, sizeof(float) * 3);
+    destination = write_bytes(destination, &face_index, sizeof(int));
+    destination = write_bytes(destination, original_to, sizeof(float) * 3);
+    destination = write_bytes(destination, &output, sizeof(int));
+    destination = write_bytes(destination, result_from, sizeof(float) * 3);
+    destination = write_bytes(destination, result_to, sizeof(float) * 3);
+    write_bytes(destination, &recorded_edge_index, sizeof(int));
+  }
+
+  *recording_length += NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION_SIZE;
+
+  return output;
+}
@@ -0,0 +1,29 @@
+#ifndef RECORD_SLIDING_NAVIGATION_COLLISION_H
+
+#define RECORD_SLIDING_NAVIGATION_COLLISION_H
+
+/**
+ * Calls sliding_navigation_collision, then appends a record of its inputs and
+ * outputs (see NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION) to a
+ * recording.  Parameters and return value are otherwise identical to those of
+ * sliding_navigation_collision.
+ * @param recording_capacity The number of bytes which recording has space for.
+ * @param recording The bytes to which the record is appended.  The record is
+ *                  not written if it would not fit within
+ *                  recording_capacity.
+ * @param recording_length The number of bytes recorded so far, which is
+ *                         incremented by the size of the record even when it
+ *                         was not written.  A value greater than
+ *                         recording_capacity indicates that records were lost.
+ */
+int record_sliding_navigation_collision(
+    const float *const from, const int face_index, const float *const to,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts, float *const result_from,
+    float *const result_to, int *const edge_index,
+    const int recording_capacity, unsigned char *const recording,
+    int *const recording_length);
+
+#endif
@@ -0,0 +1,113 @@
+#include "reorder_navigable_faces.h"
+#include <stddef.h>
+
+static void copy_vertex_vectors(const float *const input, float *const output,
+                                const int input_offset, const int output_offset,
+                                const int count) {
+  if (input == NULL) {
+    return;
+  }
+
+  for (int index = 0; index < count * 3; index++) {
+    output[output_offset * 3 + index] = input[input_offset * 3 + index];
+  }
+}
+
+void reorder_navigable_faces(
+    const int face_count, const int *const face_order,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_exit_normals,
+    const float *const edge_coefficients, const float *const vertex_up_normals,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    int *const result_face_vertex_counts, int *const result_face_vertex_offsets,
+    float *const result_face_vertex_locations, float *const result_face_normals,
+    float *const result_edge_normals, float *const result_edge_exit_normals,
+    float *const result_edge_coefficients,
+    float *const result_vertex_up_normals,
+    int *const result_face_edge_neighbor_counts,
+    int *const result_face_edge_neighbor_offsets,
+    int *const result_face_edge_neighbor_face_indices,
+    int *const result_face_indices) {
+  for (int result_face_index = 0; result_face_index < face_count;
+       result_face_index++) {
+    result_face_indices[face_order[result_face_index]] = result_face_index;
+  }
+
+  int result_face_vertex_offset = 0;
+  int result_face_edge_neighbor_offset = 0;
+
+  for (int result_face_index = 0; result_face_index < face_count;
+       result_face_index++) {
+    const int face_index = face_order[result_face_index];
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+
+    result_face_vertex_counts[result_face_index] = relevant_face_vertex_count;
+    result_face_vertex_offsets[result_face_index] = result_face_vertex_offset;
+
+    if (face_normals != NULL) {
+      result_face_normals[result_face_index * 3] = face_normals[face_index * 3];
+      result_face_normals[result_face_index * 3 + 1] =
+          face_normals[face_index * 3 + 1];
+      result_face_normals[result_face_index * 3 + 2] =
+          face_normals[face_index * 3 + 2];
+    }
+
+    copy_vertex_vectors(face_vertex_locations, result_face_vertex_locations,
+                        relevant_face_vertex_offset, result_face_vertex_offset,
+                        relevant_face_vertex_count);
+    copy_vertex_vectors(edge_normals, result_edge_normals,
+                        relevant_face_vertex_offset, result_face_vertex_offset,
+                        relevant_face_vertex_count);
+    copy_vertex_vectors(edge_exit_normals, result_edge_exit_normals,
+                        relevant_face_vertex_offset, result_face_vertex_offset,
+                        relevant_face_vertex_count);
+    copy_vertex_vectors(edge_coefficients, result_edge_coefficients,
+                        relevant_face_vertex_offset, result_face_vertex_offset,
+                        relevant_face_vertex_count);
+    copy_vertex_vectors(vertex_up_normals, result_vertex_up_normals,
+                        relevant_face_vertex_offset, result_face_vertex_offset,
+                        relevant_face_vertex_count);
+
+    if (face_edge_neighbor_counts != NULL) {
+      for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+           vertex_index++) {
+        const int relevant_edge = relevant_face_vertex_offset + vertex_index;
+        const int result_edge = result_face_vertex_offset + vertex_index;
+        const int relevant_face_edge_neighbor_count =
+            face_edge_neighbor_counts[relevant_edge];
+
+        result_face_edge_neighbor_counts[result_edge] =
+            relevant_face_edge_neighbor_count;
+
+        if (face_edge_neighbor_offsets != NULL) {
+          result_face_edge_neighbor_offsets[result_edge] =
+              result_face_edge_neighbor_offset;
+
+          const int *const relevant_face_edge_neighbor_face_indices =
+              face_edge_neighbor_face_indices +
+              face_edge_neighbor_offsets[relevant_edge];
+          int *const relevant_result_face_edge_neighbor_face_indices =
+              result_face_edge_neighbor_face_indices +
+              result_face_edge_neighbor_offset;
+
+          for (int neighbor_index = 0;
+               neighbor_index < relevant_face_edge_neighbor_count;
+               neighbor_index++) {
+            relevant_result_face_edge_neighbor_face_indices[neighbor_index] =
+                result_face_indices
+                    [relevant_face_edge_neighbor_face_indices[neighbor_index]];
+          }
+
+          result_face_edge_neighbor_offset +=
+              relevant_face_edge_neighbor_count;
+        }
+      }
+    }
+
+    result_face_vertex_offset += relevant_face_vertex_count;
+  }
+}
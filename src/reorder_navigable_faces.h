@@ -0,0 +1,89 @@
+#ifndef REORDER_NAVIGABLE_FACES_H
+
+#define REORDER_NAVIGABLE_FACES_H
+
+/**
+ * Copies a navigation mesh, reordering its faces.  Each per-face and per-vertex
+ * array is optional; pass NULL as both its input and result to skip it.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_order The index of the face which should be placed at each index
+ *                   once reordered (e.g. 2, 0, 1 would move the third face to
+ *                   the start), such as that produced by
+ *                   navigable_face_spatial_order.  Behavior is undefined if
+ *                   this is not a permutation of 0 to face_count - 1.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_normals A 3D unit vector for each edge of each face of the
+ *                     navigation mesh.
+ * @param edge_exit_normals A 3D unit vector for each edge of each face of the
+ *                          navigation mesh.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.
+ * @param vertex_up_normals A 3D unit vector for each vertex of each face of the
+ *                          navigation mesh.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).  Must be given
+ *                                   alongside face_edge_neighbor_counts.
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.  Must be given
+ *                                        alongside face_edge_neighbor_offsets.
+ * @param result_face_vertex_counts Overwritten with the reordered
+ *                                  face_vertex_counts.
+ * @param result_face_vertex_offsets Overwritten with the face_vertex_offsets
+ *                                   of the reordered navigation mesh.
+ * @param result_face_vertex_locations Overwritten with the reordered
+ *                                     face_vertex_locations.
+ * @param result_face_normals Overwritten with the reordered face_normals.
+ * @param result_edge_normals Overwritten with the reordered edge_normals.
+ * @param result_edge_exit_normals Overwritten with the reordered
+ *                                 edge_exit_normals.
+ * @param result_edge_coefficients Overwritten with the reordered
+ *                                 edge_coefficients.
+ * @param result_vertex_up_normals Overwritten with the reordered
+ *                                 vertex_up_normals.
+ * @param result_face_edge_neighbor_counts Overwritten with the reordered
+ *                                         face_edge_neighbor_counts.
+ * @param result_face_edge_neighbor_offsets Overwritten with the
+ *                                          face_edge_neighbor_offsets of the
+ *                                          reordered navigation mesh.
+ * @param result_face_edge_neighbor_face_indices Overwritten with the
+ *                                               reordered neighbor face
+ *                                               indices, remapped to the new
+ *                                               face indices.
+ * @param result_face_indices Overwritten with the new index of each face of
+ *                            the original navigation mesh, for remapping any
+ *                            face indices stored elsewhere.
+ */
+void reorder_navigable_faces(
+    const int face_count, const int *const face_order,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_exit_normals,
+    const float *const edge_coefficients, const float *const vertex_up_normals,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    int *const result_face_vertex_counts, int *const result_face_vertex_offsets,
+    float *const result_face_vertex_locations, float *const result_face_normals,
+    float *const result_edge_normals, float *const result_edge_exit_normals,
+    float *const result_edge_coefficients,
+    float *const result_vertex_up_normals,
+    int *const result_face_edge_neighbor_counts,
+    int *const result_face_edge_neighbor_offsets,
+    int *const result_face_edge_neighbor_face_indices,
+    int *const result_face_indices);
+
+#endif
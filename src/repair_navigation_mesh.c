@@ -0,0 +1,334 @@
+#include "repair_navigation_mesh.h"
+#include "navigable_face_grid_bucket.h"
+#include "square_root.h"
+#include <stdbool.h>
+
+static int cell(const float coordinate, const float cell_size) {
+  const float scaled = coordinate / cell_size;
+  const int truncated = (int)scaled;
+  return scaled < truncated ? truncated - 1 : truncated;
+}
+
+static void weld(const int vertex_count,
+                 const float *const face_vertex_locations,
+                 const float weld_distance, const int bucket_count,
+                 int *const bucket_first_vertices,
+                 int *const vertex_next_indices,
+                 int *const vertex_weld_indices) {
+  for (int bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+    bucket_first_vertices[bucket_index] = -1;
+  }
+
+  const float cell_size = weld_distance > 0.0f ? weld_distance : 1.0f;
+  const float weld_distance_squared = weld_distance * weld_distance;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location =
+        face_vertex_locations + vertex_index * 3;
+    const int cell_x = cell(relevant_location[0], cell_size);
+    const int cell_y = cell(relevant_location[1], cell_size);
+    int weld_index = vertex_index;
+
+    for (int neighbor_y = cell_y - 1; neighbor_y <= cell_y + 1; neighbor_y++) {
+      for (int neighbor_x = cell_x - 1; neighbor_x <= cell_x + 1;
+           neighbor_x++) {
+        const int bucket_index =
+            navigable_face_grid_bucket(neighbor_x, neighbor_y, bucket_count);
+
+        for (int other_vertex_index = bucket_first_vertices[bucket_index];
+             other_vertex_index != -1;
+             other_vertex_index = vertex_next_indices[other_vertex_index]) {
+          const float *const other_location =
+              face_vertex_locations + other_vertex_index * 3;
+
+          const float delta[] = {
+              other_location[0] - relevant_location[0],
+              other_location[1] - relevant_location[1],
+              other_location[2] - relevant_location[2],
+          };
+
+          const float distance_squared =
+              delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+
+          if (other_vertex_index < weld_index &&
+              distance_squared <= weld_distance_squared) {
+            weld_index = other_vertex_index;
+          }
+        }
+      }
+    }
+
+    vertex_weld_indices[vertex_index] = weld_index;
+
+    if (weld_index == vertex_index) {
+      const int bucket_index =
+          navigable_face_grid_bucket(cell_x, cell_y, bucket_count);
+      vertex_next_indices[vertex_index] = bucket_first_vertices[bucket_index];
+      bucket_first_vertices[bucket_index] = vertex_index;
+    }
+  }
+}
+
+static void calculate_normal(const int vertex_count,
+                             const float *const vertex_locations,
+                             float *const normal) {
+  normal[0] = 0.0f;
+  normal[1] = 0.0f;
+  normal[2] = 0.0f;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float *const next_location = vertex_index == vertex_count - 1
+                                           ? vertex_locations
+                                           : relevant_location + 3;
+
+    normal[0] += (relevant_location[1] - next_location[1]) *
+                 (relevant_location[2] + next_location[2]);
+    normal[1] += (relevant_location[2] - next_location[2]) *
+                 (relevant_location[0] + next_location[0]);
+    normal[2] += (relevant_location[0] - next_location[0]) *
+                 (relevant_location[1] + next_location[1]);
+  }
+}
+
+static bool bake_face(const int vertex_count,
+                      const float *const vertex_locations,
+                      const float tolerance, float *const face_normal,
+                      float *const edge_normals,
+                      float *const edge_coefficients) {
+  calculate_normal(vertex_count, vertex_locations, face_normal);
+
+  const float magnitude = square_root(face_normal[0] * face_normal[0] +
+                                      face_normal[1] * face_normal[1] +
+                                      face_normal[2] * face_normal[2]);
+
+  if (magnitude * 0.5f <= tolerance * tolerance) {
+    return false;
+  }
+
+  face_normal[0] /= magnitude;
+  face_normal[1] /= magnitude;
+  face_normal[2] /= magnitude;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float *const next_location = vertex_index == vertex_count - 1
+                                           ? vertex_locations
+                                           : relevant_location + 3;
+    float *const relevant_edge_normal = edge_normals + vertex_index * 3;
+    float *const relevant_edge_coefficient =
+        edge_coefficients + vertex_index * 3;
+
+    const float edge[] = {
+        next_location[0] - relevant_location[0],
+        next_location[1] - relevant_location[1],
+        next_location[2] - relevant_location[2],
+    };
+
+    const float edge_length_squared =
+        edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2];
+
+    const float outward[] = {
+        edge[1] * face_normal[2] - edge[2] * face_normal[1],
+        edge[2] * face_normal[0] - edge[0] * face_normal[2],
+        edge[0] * face_normal[1] - edge[1] * face_normal[0],
+    };
+
+    const float outward_magnitude =
+        square_root(outward[0] * outward[0] + outward[1] * outward[1] +
+                    outward[2] * outward[2]);
+
+    if (outward_magnitude == 0.0f) {
+      return false;
+    }
+
+    relevant_edge_normal[0] = outward[0] / outward_magnitude;
+    relevant_edge_normal[1] = outward[1] / outward_magnitude;
+    relevant_edge_normal[2] = outward[2] / outward_magnitude;
+
+    relevant_edge_coefficient[0] = edge[0] / edge_length_squared;
+    relevant_edge_coefficient[1] = edge[1] / edge_length_squared;
+    relevant_edge_coefficient[2] = edge[2] / edge_length_squared;
+  }
+
+  return true;
+}
+
+static bool is_planar(const int vertex_count,
+                      const float *const vertex_locations,
+                      const float tolerance) {
+  float normal[3];
+  calculate_normal(vertex_count, vertex_locations, normal);
+
+  const float magnitude =
+      square_root(normal[0] * normal[0] + normal[1] * normal[1] +
+                  normal[2] * normal[2]);
+
+  if (magnitude == 0.0f) {
+    return true;
+  }
+
+  float centroid_distance = 0.0f;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    centroid_distance += relevant_location[0] * normal[0] +
+                         relevant_location[1] * normal[1] +
+                         relevant_location[2] * normal[2];
+  }
+
+  centroid_distance /= vertex_count;
+
+  for (int vertex_index = 0; vertex_index < vertex_count; vertex_index++) {
+    const float *const relevant_location = vertex_locations + vertex_index * 3;
+    const float distance = relevant_location[0] * normal[0] +
+                           relevant_location[1] * normal[1] +
+                           relevant_location[2] * normal[2] -
+                           centroid_distance;
+
+    if (distance > tolerance * magnitude ||
+        distance < -tolerance * magnitude) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+int repair_navigation_mesh(
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float weld_distance,
+    const float tolerance, const int bucket_count,
+    int *const bucket_first_vertices, int *const vertex_next_indices,
+    int *const vertex_weld_indices, int *const result_face_indices,
+    int *const result_face_vertex_counts, int *const result_face_vertex_offsets,
+    float *const result_face_vertex_locations, float *const result_face_normals,
+    float *const result_edge_normals, float *const result_edge_coefficients) {
+  if (face_count <= 0) {
+    return 0;
+  }
+
+  weld(face_vertex_offsets[face_count - 1] +
+           face_vertex_counts[face_count - 1],
+       face_vertex_locations, weld_distance, bucket_count,
+       bucket_first_vertices, vertex_next_indices, vertex_weld_indices);
+
+  int output = 0;
+  int result_vertex_offset = 0;
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+    const int *const relevant_vertex_weld_indices =
+        vertex_weld_indices + face_vertex_offsets[face_index];
+    float *const relevant_result_vertex_locations =
+        result_face_vertex_locations + result_vertex_offset * 3;
+
+    int vertex_count = 0;
+
+    for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+         vertex_index++) {
+      const float *const relevant_location =
+          face_vertex_locations +
+          relevant_vertex_weld_indices[vertex_index] * 3;
+      const float *const previous_location =
+          relevant_result_vertex_locations + (vertex_count - 1) * 3;
+
+      if (vertex_count > 0 && relevant_location[0] == previous_location[0] &&
+          relevant_location[1] == previous_location[1] &&
+          relevant_location[2] == previous_location[2]) {
+        continue;
+      }
+
+      relevant_result_vertex_locations[vertex_count * 3] =
+          relevant_location[0];
+      relevant_result_vertex_locations[vertex_count * 3 + 1] =
+          relevant_location[1];
+      relevant_result_vertex_locations[vertex_count * 3 + 2] =
+          relevant_location[2];
+      vertex_count++;
+    }
+
+    const float *const last_location =
+        relevant_result_vertex_locations + (vertex_count - 1) * 3;
+
+    if (vertex_count > 1 &&
+        last_location[0] == relevant_result_vertex_locations[0] &&
+        last_location[1] == relevant_result_vertex_locations[1] &&
+        last_location[2] == relevant_result_vertex_locations[2]) {
+      vertex_count--;
+    }
+
+    if (vertex_count < 3) {
+      continue;
+    }
+
+    if (is_planar(vertex_count, relevant_result_vertex_locations, tolerance)) {
+      if (bake_face(vertex_count, relevant_result_vertex_locations, tolerance,
+                    result_face_normals + output * 3,
+                    result_edge_normals + result_vertex_offset * 3,
+                    result_edge_coefficients + result_vertex_offset * 3)) {
+        result_face_indices[output] = face_index;
+        result_face_vertex_counts[output] = vertex_count;
+        result_face_vertex_offsets[output] = result_vertex_offset;
+        result_vertex_offset += vertex_count;
+        output++;
+      }
+
+      continue;
+    }
+
+    for (int triangle_index = vertex_count - 3; triangle_index >= 0;
+         triangle_index--) {
+      const float second[] = {
+          relevant_result_vertex_locations[(triangle_index + 1) * 3],
+          relevant_result_vertex_locations[(triangle_index + 1) * 3 + 1],
+          relevant_result_vertex_locations[(triangle_index + 1) * 3 + 2],
+      };
+
+      const float third[] = {
+          relevant_result_vertex_locations[(triangle_index + 2) * 3],
+          relevant_result_vertex_locations[(triangle_index + 2) * 3 + 1],
+          relevant_result_vertex_locations[(triangle_index + 2) * 3 + 2],
+      };
+
+      float *const triangle_locations =
+          relevant_result_vertex_locations + triangle_index * 9;
+
+      triangle_locations[0] = relevant_result_vertex_locations[0];
+      triangle_locations[1] = relevant_result_vertex_locations[1];
+      triangle_locations[2] = relevant_result_vertex_locations[2];
+      triangle_locations[3] = second[0];
+      triangle_locations[4] = second[1];
+      triangle_locations[5] = second[2];
+      triangle_locations[6] = third[0];
+      triangle_locations[7] = third[1];
+      triangle_locations[8] = third[2];
+    }
+
+    for (int triangle_index = 0; triangle_index < vertex_count - 2;
+         triangle_index++) {
+      const float *const triangle_locations =
+          relevant_result_vertex_locations + triangle_index * 9;
+      float *const destination_locations =
+          result_face_vertex_locations + result_vertex_offset * 3;
+
+      for (int component = 0; component < 9; component++) {
+        destination_locations[component] = triangle_locations[component];
+      }
+
+      if (bake_face(3, destination_locations, tolerance,
+                    result_face_normals + output * 3,
+                    result_edge_normals + result_vertex_offset * 3,
+                    result_edge_coefficients + result_vertex_offset * 3)) {
+        result_face_indices[output] = face_index;
+        result_face_vertex_counts[output] = 3;
+        result_face_vertex_offsets[output] = result_vertex_offset;
+        result_vertex_offset += 3;
+        output++;
+      }
+    }
+  }
+
+  return output;
+}
@@ -0,0 +1,90 @@
+#ifndef REPAIR_NAVIGATION_MESH_H
+
+#define REPAIR_NAVIGATION_MESH_H
+
+/**
+ * Repairs the most common problems reported by validate_navigation_mesh,
+ * producing a navigation mesh with recalculated surface normals, edge normals
+ * and edge coefficients.  Each vertex is welded to the first earlier vertex
+ * within a given distance which was not itself welded (found using a hashed
+ * grid of cells over the X and Y axes), so no vertex moves further than that
+ * distance.  Repeated consecutive vertices are then removed, faces which are
+ * not planar are split into triangles and faces with no area are discarded.
+ * Faces which are not convex are not repaired and should be split by the
+ * exporting tool.  Edge exit normals, vertex up normals and neighbor lists are
+ * not produced and must be recalculated for the repaired navigation mesh.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3; such faces are discarded.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity, or if any X or Y
+ *                              component divided by weld_distance (or by one,
+ *                              when zero) cannot be represented as an int.
+ * @param weld_distance The maximum distance between two vertices for them to
+ *                      be welded together, which is also the size of each
+ *                      cell.  Behavior is undefined if NaN, infinity, negative
+ *                      infinity or negative.  Zero welds only identical
+ *                      vertices.
+ * @param tolerance The maximum distance of a vertex from the plane of its face
+ *                  before that face is split into triangles.  Faces with an
+ *                  area less than the square of this are discarded.  Behavior
+ *                  is undefined if NaN, infinity, negative infinity or
+ *                  negative.
+ * @param bucket_count The number of buckets to hash cells into (see
+ *                     navigable_face_grid_bucket).  Behavior is undefined if
+ *                     less than 1.
+ * @param bucket_first_vertices Overwritten with temporary data.  Must have
+ *                              space for bucket_count values.
+ * @param vertex_next_indices Overwritten with temporary data.  Must have space
+ *                            for one value per vertex within each face of the
+ *                            navigation mesh.
+ * @param vertex_weld_indices Overwritten with the index of the vertex to which
+ *                            each vertex within each face of the navigation
+ *                            mesh was welded (itself, when not welded).  Must
+ *                            have space for one value per vertex within each
+ *                            face of the navigation mesh.
+ * @param result_face_indices Overwritten with the index of the face of the
+ *                            original navigation mesh from which each face of
+ *                            the repaired navigation mesh was produced.
+ * @param result_face_vertex_counts Overwritten with the number of vertices of
+ *                                  each face in the repaired navigation mesh.
+ * @param result_face_vertex_offsets Overwritten with the exclusive running
+ *                                   totals of result_face_vertex_counts.
+ * @param result_face_vertex_locations Overwritten with a 3D vector describing
+ *                                     the location of each vertex within each
+ *                                     face of the repaired navigation mesh.
+ * @param result_face_normals Overwritten with a 3D unit vector describing the
+ *                            surface normal of each face within the repaired
+ *                            navigation mesh.
+ * @param result_edge_normals Overwritten with a 3D unit vector perpendicular to
+ *                            both each edge of each face of the repaired
+ *                            navigation mesh and its corresponding face surface
+ *                            normal, pointing out of the face.
+ * @param result_edge_coefficients Overwritten with a 3D vector for each vertex
+ *                                 of each face of the repaired navigation mesh,
+ *                                 pointing to the next vertex of the face with
+ *                                 a magnitude equal to the reciprocal of the
+ *                                 distance to that vertex.
+ * @return The number of faces in the repaired navigation mesh.  As every face
+ *         may be split, all result arrays must have space for as many faces
+ *         as there are vertices in the original navigation mesh (less two per
+ *         face), and three vertices per such face.
+ */
+int repair_navigation_mesh(
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float weld_distance,
+    const float tolerance, const int bucket_count,
+    int *const bucket_first_vertices, int *const vertex_next_indices,
+    int *const vertex_weld_indices, int *const result_face_indices,
+    int *const result_face_vertex_counts, int *const result_face_vertex_offsets,
+    float *const result_face_vertex_locations, float *const result_face_normals,
+    float *const result_edge_normals, float *const result_edge_coefficients);
+
+#endif
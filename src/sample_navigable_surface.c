@@ -0,0 +1,83 @@
+#include "sample_navigable_surface.h"
+
+void sample_navigable_surface(
+    const int sample_count, const float *const random_numbers,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const float *const face_fan_areas, const float *const cumulative_face_areas,
+    int *const result_face_indices, float *const result_locations) {
+  const float total_area = cumulative_face_areas[face_count - 1];
+
+  for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+    const float *const relevant_random_numbers =
+        random_numbers + sample_index * 3;
+
+    const float target_area = relevant_random_numbers[0] * total_area;
+
+    int lower = 0;
+    int upper = face_count - 1;
+
+    while (lower < upper) {
+      const int middle = lower + (upper - lower) / 2;
+
+      if (cumulative_face_areas[middle] > target_area) {
+        upper = middle;
+      } else {
+        lower = middle + 1;
+      }
+    }
+
+    const int face_index = lower;
+
+    const float face_target_area =
+        face_index == 0 ? target_area
+                        : target_area - cumulative_face_areas[face_index - 1];
+
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+    const float *const relevant_face_fan_areas =
+        face_fan_areas + relevant_face_vertex_offset;
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+    int vertex_index = 2;
+
+    while (vertex_index < relevant_face_vertex_count - 1 &&
+           relevant_face_fan_areas[vertex_index] <= face_target_area) {
+      vertex_index++;
+    }
+
+    const float *const previous_face_vertex_location =
+        relevant_face_vertex_locations + (vertex_index - 1) * 3;
+    const float *const relevant_face_vertex_location =
+        relevant_face_vertex_locations + vertex_index * 3;
+
+    float previous_weight = relevant_random_numbers[1];
+    float relevant_weight = relevant_random_numbers[2];
+
+    if (previous_weight + relevant_weight > 1.0f) {
+      previous_weight = 1.0f - previous_weight;
+      relevant_weight = 1.0f - relevant_weight;
+    }
+
+    const float first_weight = 1.0f - previous_weight - relevant_weight;
+
+    float *const relevant_result_location = result_locations + sample_index * 3;
+
+    relevant_result_location[0] =
+        relevant_face_vertex_locations[0] * first_weight +
+        previous_face_vertex_location[0] * previous_weight +
+        relevant_face_vertex_location[0] * relevant_weight;
+    relevant_result_location[1] =
+        relevant_face_vertex_locations[1] * first_weight +
+        previous_face_vertex_location[1] * previous_weight +
+        relevant_face_vertex_location[1] * relevant_weight;
+    relevant_result_location[2] =
+        relevant_face_vertex_locations[2] * first_weight +
+        previous_face_vertex_location[2] * previous_weight +
+        relevant_face_vertex_location[2] * relevant_weight;
+
+    result_face_indices[sample_index] = face_index;
+  }
+}
@@ -0,0 +1,43 @@
+#ifndef SAMPLE_NAVIGABLE_SURFACE_H
+
+#define SAMPLE_NAVIGABLE_SURFACE_H
+
+/**
+ * Converts random numbers into uniformly distributed locations on the surface
+ * of a navigation mesh.  Each sample takes O(log F) time.
+ * @param sample_count The number of locations to generate.
+ * @param random_numbers Three random numbers for each location to generate,
+ *                       each uniformly distributed from 0 (inclusive) to 1
+ *                       (exclusive).  The first selects a face and triangle
+ *                       within it, while the second and third select a point
+ *                       within that triangle.
+ * @param face_count The number of faces in the navigation mesh.  Behavior is
+ *                   undefined if the total area of the navigation mesh is not
+ *                   greater than zero.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_fan_areas The face fan areas calculated by navigable_face_areas.
+ * @param cumulative_face_areas The cumulative face areas calculated by
+ *                              navigable_face_areas.
+ * @param result_face_indices Overwritten with the index of the face on which
+ *                            each location was generated.
+ * @param result_locations Overwritten with the 3D vector describing each
+ *                         location generated.
+ */
+void sample_navigable_surface(
+    const int sample_count, const float *const random_numbers,
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const float *const face_fan_areas, const float *const cumulative_face_areas,
+    int *const result_face_indices, float *const result_locations);
+
+#endif
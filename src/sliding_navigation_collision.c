@@ -4,69 +4,15 @@
 
 static const float offset = 0.0001f;
 
-int sliding_navigation_collision(
-    const float *const from, const int face_index, const float *const to,
-    const int *const face_vertex_counts, const int *const face_vertex_offsets,
-    const float *const face_vertex_locations, const float *const face_normals,
-    const float *const edge_exit_normals,
-    const int *const face_edge_neighbor_counts, float *const result_from,
-    float *const result_to, int *const edge_index) {
-  int output = SLIDING_NAVIGATION_COLLISION_RESULT_NONE;
-  float best_along = 1.0f / 0.0f;
-  float best_normal[] = {0.0f, 0.0f, 0.0f};
-  float best_escape = 0.0f;
-  bool collided_with_edge = false;
-
-  const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
-  const float *const relevant_face_vertex_locations =
-      face_vertex_locations + relevant_face_vertex_offset * 3;
-  const float *const relevant_face_normal = face_normals + face_index * 3;
-  const float *const relevant_edge_exit_normals =
-      edge_exit_normals + relevant_face_vertex_offset * 3;
-  const int *const relevant_face_edge_neighbor_counts =
-      face_edge_neighbor_counts + relevant_face_vertex_offset;
-
-  const float to_surface_difference[] = {
-      to[0] - relevant_face_vertex_locations[0],
-      to[1] - relevant_face_vertex_locations[1],
-      to[2] - relevant_face_vertex_locations[2],
-  };
-
-  const float to_surface_distance =
-      to_surface_difference[0] * relevant_face_normal[0] +
-      to_surface_difference[1] * relevant_face_normal[1] +
-      to_surface_difference[2] * relevant_face_normal[2];
-
-  if (to_surface_distance < 0.0f) {
-    const float from_surface_difference[] = {
-        from[0] - relevant_face_vertex_locations[0],
-        from[1] - relevant_face_vertex_locations[1],
-        from[2] - relevant_face_vertex_locations[2],
-    };
-
-    const float from_surface_distance =
-        from_surface_difference[0] * relevant_face_normal[0] +
-        from_surface_difference[1] * relevant_face_normal[1] +
-        from_surface_difference[2] * relevant_face_normal[2];
-
-    const float adjusted_from_surface_distance = from_surface_distance - offset;
-    const float adjusted_to_surface_distance = to_surface_distance - offset;
-
-    output = SLIDING_NAVIGATION_COLLISION_RESULT_SURFACE;
-    best_along =
-        to_surface_distance == from_surface_distance
-            ? 0.0f
-            : adjusted_from_surface_distance / (adjusted_from_surface_distance -
-                                                adjusted_to_surface_distance);
-    best_normal[0] = relevant_face_normal[0];
-    best_normal[1] = relevant_face_normal[1];
-    best_normal[2] = relevant_face_normal[2];
-    best_escape = -adjusted_to_surface_distance;
-    *edge_index = -1;
-  }
-
-  const int relevant_face_vertex_count = face_vertex_counts[face_index];
-
+static inline void collide_with_edges(
+    const float *const from, const float *const to,
+    const float *const relevant_face_vertex_locations,
+    const float *const relevant_edge_exit_normals,
+    const int *const relevant_face_edge_neighbor_counts,
+    const int relevant_face_vertex_count, int *const output,
+    float *const best_along, float *const best_normal,
+    float *const best_escape, bool *const collided_with_edge,
+    int *const edge_index) {
   for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
        vertex_index++) {
     const float *const relevant_face_vertex_location =
@@ -108,15 +54,15 @@ int sliding_navigation_collision(
                 : adjusted_from_edge_distance /
                       (adjusted_from_edge_distance - adjusted_to_edge_distance);
 
-        if (along <= best_along) {
-          output = SLIDING_NAVIGATION_COLLISION_RESULT_EDGE;
-          best_along = along;
+        if (along <= *best_along) {
+          *output = SLIDING_NAVIGATION_COLLISION_RESULT_EDGE;
+          *best_along = along;
           best_normal[0] = relevant_edge_exit_normal[0];
           best_normal[1] = relevant_edge_exit_normal[1];
           best_normal[2] = relevant_edge_exit_normal[2];
-          best_escape = -adjusted_to_edge_distance;
+          *best_escape = -adjusted_to_edge_distance;
           *edge_index = vertex_index;
-          collided_with_edge = false;
+          *collided_with_edge = false;
         }
       } else {
         const float adjusted_from_edge_distance = from_edge_distance + offset;
@@ -128,26 +74,115 @@ int sliding_navigation_collision(
                 : adjusted_from_edge_distance /
                       (adjusted_from_edge_distance - adjusted_to_edge_distance);
 
-        if (along <= best_along) {
+        if (along <= *best_along) {
           const float secondary_adjusted_from_edge_distance =
               from_edge_distance - offset;
           const float secondary_adjusted_to_edge_distance =
               to_edge_distance - offset;
 
-          output = SLIDING_NAVIGATION_COLLISION_RESULT_EDGE;
-          best_along = along;
-          best_escape = secondary_adjusted_from_edge_distance ==
-                                secondary_adjusted_to_edge_distance
-                            ? secondary_adjusted_from_edge_distance
-                            : secondary_adjusted_from_edge_distance /
-                                  (secondary_adjusted_from_edge_distance -
-                                   secondary_adjusted_to_edge_distance);
+          *output = SLIDING_NAVIGATION_COLLISION_RESULT_EDGE;
+          *best_along = along;
+          *best_escape = secondary_adjusted_from_edge_distance ==
+                                 secondary_adjusted_to_edge_distance
+                             ? secondary_adjusted_from_edge_distance
+                             : secondary_adjusted_from_edge_distance /
+                                   (secondary_adjusted_from_edge_distance -
+                                    secondary_adjusted_to_edge_distance);
           *edge_index = vertex_index;
-          collided_with_edge = true;
+          *collided_with_edge = true;
         }
       }
     }
   }
+}
+
+int sliding_navigation_collision(
+    const float *const from, const int face_index, const float *const to,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_exit_normals,
+    const int *const face_edge_neighbor_counts, float *const result_from,
+    float *const result_to, int *const edge_index) {
+  int output = SLIDING_NAVIGATION_COLLISION_RESULT_NONE;
+  float best_along = 1.0f / 0.0f;
+  float best_normal[] = {0.0f, 0.0f, 0.0f};
+  float best_escape = 0.0f;
+  bool collided_with_edge = false;
+
+  const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+  const float *const relevant_face_vertex_locations =
+      face_vertex_locations + relevant_face_vertex_offset * 3;
+  const float *const relevant_face_normal = face_normals + face_index * 3;
+  const float *const relevant_edge_exit_normals =
+      edge_exit_normals + relevant_face_vertex_offset * 3;
+  const int *const relevant_face_edge_neighbor_counts =
+      face_edge_neighbor_counts + relevant_face_vertex_offset;
+
+  const float to_surface_difference[] = {
+      to[0] - relevant_face_vertex_locations[0],
+      to[1] - relevant_face_vertex_locations[1],
+      to[2] - relevant_face_vertex_locations[2],
+  };
+
+  const float to_surface_distance =
+      to_surface_difference[0] * relevant_face_normal[0] +
+      to_surface_difference[1] * relevant_face_normal[1] +
+      to_surface_difference[2] * relevant_face_normal[2];
+
+  if (to_surface_distance < 0.0f) {
+    const float from_surface_difference[] = {
+        from[0] - relevant_face_vertex_locations[0],
+        from[1] - relevant_face_vertex_locations[1],
+        from[2] - relevant_face_vertex_locations[2],
+    };
+
+    const float from_surface_distance =
+        from_surface_difference[0] * relevant_face_normal[0] +
+        from_surface_difference[1] * relevant_face_normal[1] +
+        from_surface_difference[2] * relevant_face_normal[2];
+
+    const float adjusted_from_surface_distance = from_surface_distance - offset;
+    const float adjusted_to_surface_distance = to_surface_distance - offset;
+
+    output = SLIDING_NAVIGATION_COLLISION_RESULT_SURFACE;
+    best_along =
+        to_surface_distance == from_surface_distance
+            ? 0.0f
+            : adjusted_from_surface_distance / (adjusted_from_surface_distance -
+                                                adjusted_to_surface_distance);
+    best_normal[0] = relevant_face_normal[0];
+    best_normal[1] = relevant_face_normal[1];
+    best_normal[2] = relevant_face_normal[2];
+    best_escape = -adjusted_to_surface_distance;
+    *edge_index = -1;
+  }
+
+  const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+  switch (relevant_face_vertex_count) {
+  case 3:
+    collide_with_edges(
+        from, to, relevant_face_vertex_locations, relevant_edge_exit_normals,
+        relevant_face_edge_neighbor_counts, 3, &output, &best_along,
+        best_normal, &best_escape, &collided_with_edge, edge_index);
+    break;
+
+  case 4:
+    collide_with_edges(
+        from, to, relevant_face_vertex_locations, relevant_edge_exit_normals,
+        relevant_face_edge_neighbor_counts, 4, &output, &best_along,
+        best_normal, &best_escape, &collided_with_edge, edge_index);
+    break;
+
+  default:
+    collide_with_edges(from, to, relevant_face_vertex_locations,
+                       relevant_edge_exit_normals,
+                       relevant_face_edge_neighbor_counts,
+                       relevant_face_vertex_count, &output, &best_along,
+                       best_normal, &best_escape, &collided_with_edge,
+                       edge_index);
+    break;
+  }
 
   if (collided_with_edge) {
     const float forward =
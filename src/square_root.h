@@ -0,0 +1,36 @@
+#ifndef SQUARE_ROOT_H
+
+#define SQUARE_ROOT_H
+
+#include <stdint.h>
+
+/**
+ * Calculates the square root of a value without the standard library, which
+ * is unavailable in freestanding builds.  The initial estimate halves the
+ * exponent of the IEEE 754 single-precision representation, and is then
+ * refined by three Newton-Raphson iterations.
+ * @param value The value of which to calculate the square root.  Behavior is
+ *              undefined if NaN or infinity.
+ * @return The square root of value, or 0 when value is not positive.
+ */
+static inline float square_root(const float value) {
+  if (value <= 0.0f) {
+    return 0.0f;
+  }
+
+  union {
+    float value;
+    uint32_t bits;
+  } estimate;
+
+  estimate.value = value;
+  estimate.bits = (estimate.bits >> 1) + UINT32_C(0x1fbd1df5);
+
+  float output = estimate.value;
+  output = 0.5f * (output + value / output);
+  output = 0.5f * (output + value / output);
+  output = 0.5f * (output + value / output);
+  return output;
+}
+
+#endif
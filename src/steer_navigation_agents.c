@@ -0,0 +1,331 @@
+#include "steer_navigation_agents.h"
+#include "constrain_to_navigable_surface.h"
+#include "move_across_navigation_mesh.h"
+#include "square_root.h"
+#include <stddef.h>
+
+static void avoid_agents_on_face(
+    const int agent_index, const int face_index,
+    const float *const relevant_face_normal,
+    const float *const agent_locations, const float *const agent_velocities,
+    const float *const agent_radii, const float time_horizon,
+    const float delta_time, const int *const face_agent_offsets,
+    const int *const face_agent_indices, float *const avoidance) {
+  const float *const relevant_agent_location =
+      agent_locations + agent_index * 3;
+  const float *const relevant_agent_velocity =
+      agent_velocities + agent_index * 3;
+
+  for (int face_agent_index = face_agent_offsets[face_index];
+       face_agent_index < face_agent_offsets[face_index + 1];
+       face_agent_index++) {
+    const int other_agent_index = face_agent_indices[face_agent_index];
+
+    if (other_agent_index == agent_index) {
+      continue;
+    }
+
+    const float *const other_agent_location =
+        agent_locations + other_agent_index * 3;
+    const float *const other_agent_velocity =
+        agent_velocities + other_agent_index * 3;
+
+    const float location_difference[] = {
+        other_agent_location[0] - relevant_agent_location[0],
+        other_agent_location[1] - relevant_agent_location[1],
+        other_agent_location[2] - relevant_agent_location[2],
+    };
+
+    const float velocity_difference[] = {
+        other_agent_velocity[0] - relevant_agent_velocity[0],
+        other_agent_velocity[1] - relevant_agent_velocity[1],
+        other_agent_velocity[2] - relevant_agent_velocity[2],
+    };
+
+    const float velocity_difference_squared =
+        velocity_difference[0] * velocity_difference[0] +
+        velocity_difference[1] * velocity_difference[1] +
+        velocity_difference[2] * velocity_difference[2];
+
+    const float approach = -(location_difference[0] * velocity_difference[0] +
+                             location_difference[1] * velocity_difference[1] +
+                             location_difference[2] * velocity_difference[2]);
+
+    const float unclamped_time = velocity_difference_squared > 0.0f
+                                     ? approach / velocity_difference_squared
+                                     : 0.0f;
+
+    const float time =
+        unclamped_time < 0.0f
+            ? 0.0f
+            : (unclamped_time > time_horizon ? time_horizon : unclamped_time);
+
+    const float closest_difference[] = {
+        location_difference[0] + velocity_difference[0] * time,
+        location_difference[1] + velocity_difference[1] * time,
+        location_difference[2] + velocity_difference[2] * time,
+    };
+
+    const float closest_distance_squared =
+        closest_difference[0] * closest_difference[0] +
+        closest_difference[1] * closest_difference[1] +
+        closest_difference[2] * closest_difference[2];
+
+    const float combined_radius =
+        agent_radii[agent_index] + agent_radii[other_agent_index];
+
+    if (closest_distance_squared >= combined_radius * combined_radius) {
+      continue;
+    }
+
+    float separation[3];
+    float closest_distance = 0.0f;
+
+    if (closest_distance_squared > 0.0f) {
+      closest_distance = square_root(closest_distance_squared);
+      separation[0] = closest_difference[0];
+      separation[1] = closest_difference[1];
+      separation[2] = closest_difference[2];
+    } else {
+      separation[0] = relevant_face_normal[2] * velocity_difference[1] -
+                      relevant_face_normal[1] * velocity_difference[2];
+      separation[1] = relevant_face_normal[0] * velocity_difference[2] -
+                      relevant_face_normal[2] * velocity_difference[0];
+      separation[2] = relevant_face_normal[1] * velocity_difference[0] -
+                      relevant_face_normal[0] * velocity_difference[1];
+
+      if (separation[0] == 0.0f && separation[1] == 0.0f &&
+          separation[2] == 0.0f) {
+        const float sign = agent_index < other_agent_index ? 1.0f : -1.0f;
+
+        if (relevant_face_normal[1] != 0.0f ||
+            relevant_face_normal[2] != 0.0f) {
+          separation[1] = relevant_face_normal[2] * sign;
+          separation[2] = -relevant_face_normal[1] * sign;
+        } else {
+          separation[0] = -relevant_face_normal[2] * sign;
+          separation[2] = relevant_face_normal[0] * sign;
+        }
+      }
+    }
+
+    const float separation_magnitude = square_root(
+        separation[0] * separation[0] + separation[1] * separation[1] +
+        separation[2] * separation[2]);
+
+    if (separation_magnitude == 0.0f) {
+      continue;
+    }
+
+    const float strength = 0.5f * (combined_radius - closest_distance) /
+                           ((time + delta_time) * separation_magnitude);
+
+    avoidance[0] -= separation[0] * strength;
+    avoidance[1] -= separation[1] * strength;
+    avoidance[2] -= separation[2] * strength;
+  }
+}
+
+void steer_navigation_agents(
+    const int agent_count, const float *const agent_locations,
+    const float *const agent_velocities, const float *const agent_radii,
+    const int *const agent_face_indices, const float time_horizon,
+    const float delta_time, const int maximum_iterations, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_exit_normals,
+    const float *const edge_coefficients,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, int *const face_agent_offsets,
+    int *const face_agent_indices, int *const face_search_marks,
+    int *const face_search_queue, float *const result_agent_locations,
+    float *const result_agent_velocities, int *const result_agent_face_indices,
+    const int maximum_events, int *const event_count,
+    int *const event_agent_indices, int *const event_from_face_indices,
+    int *const event_to_face_indices, int *const event_edge_indices,
+    float *const event_locations) {
+  for (int face_index = 0; face_index <= face_count; face_index++) {
+    face_agent_offsets[face_index] = 0;
+  }
+
+  for (int agent_index = 0; agent_index < agent_count; agent_index++) {
+    face_agent_offsets[agent_face_indices[agent_index] + 1]++;
+  }
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    face_agent_offsets[face_index + 1] += face_agent_offsets[face_index];
+  }
+
+  for (int agent_index = 0; agent_index < agent_count; agent_index++) {
+    face_agent_indices[face_agent_offsets[agent_face_indices[agent_index]]++] =
+        agent_index;
+  }
+
+  for (int face_index = face_count; face_index > 0; face_index--) {
+    face_agent_offsets[face_index] = face_agent_offsets[face_index - 1];
+  }
+
+  face_agent_offsets[0] = 0;
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    face_search_marks[face_index] = -1;
+  }
+
+  float maximum_radius = 0.0f;
+  float maximum_speed = 0.0f;
+
+  for (int agent_index = 0; agent_index < agent_count; agent_index++) {
+    const float *const relevant_agent_velocity =
+        agent_velocities + agent_index * 3;
+
+    const float speed =
+        square_root(relevant_agent_velocity[0] * relevant_agent_velocity[0] +
+                    relevant_agent_velocity[1] * relevant_agent_velocity[1] +
+                    relevant_agent_velocity[2] * relevant_agent_velocity[2]);
+
+    if (agent_radii[agent_index] > maximum_radius) {
+      maximum_radius = agent_radii[agent_index];
+    }
+
+    if (speed > maximum_speed) {
+      maximum_speed = speed;
+    }
+  }
+
+  for (int agent_index = 0; agent_index < agent_count; agent_index++) {
+    const float *const relevant_agent_location =
+        agent_locations + agent_index * 3;
+    const float *const relevant_agent_velocity =
+        agent_velocities + agent_index * 3;
+    const int face_index = agent_face_indices[agent_index];
+    float avoidance[] = {0.0f, 0.0f, 0.0f};
+
+    const float speed =
+        square_root(relevant_agent_velocity[0] * relevant_agent_velocity[0] +
+                    relevant_agent_velocity[1] * relevant_agent_velocity[1] +
+                    relevant_agent_velocity[2] * relevant_agent_velocity[2]);
+
+    const float search_radius = agent_radii[agent_index] + maximum_radius +
+                                (speed + maximum_speed) * time_horizon;
+
+    const float search_radius_squared = search_radius * search_radius;
+
+    int queue_start = 0;
+    int queue_end = 1;
+
+    face_search_marks[face_index] = agent_index;
+    face_search_queue[0] = face_index;
+
+    while (queue_start < queue_end) {
+      const int search_face_index = face_search_queue[queue_start];
+      queue_start++;
+
+      avoid_agents_on_face(agent_index, search_face_index,
+                           face_normals + face_index * 3, agent_locations,
+                           agent_velocities, agent_radii, time_horizon,
+                           delta_time, face_agent_offsets, face_agent_indices,
+                           avoidance);
+
+      const int relevant_face_vertex_offset =
+          face_vertex_offsets[search_face_index];
+      const int relevant_face_vertex_count =
+          face_vertex_counts[search_face_index];
+      const int relevant_face_edge_neighbor_offset =
+          face_edge_neighbor_offsets[relevant_face_vertex_offset];
+      const int relevant_face_edge_neighbor_count =
+          face_edge_neighbor_offsets[relevant_face_vertex_offset +
+                                     relevant_face_vertex_count - 1] +
+          face_edge_neighbor_counts[relevant_face_vertex_offset +
+                                    relevant_face_vertex_count - 1] -
+          relevant_face_edge_neighbor_offset;
+
+      for (int neighbor_index = 0;
+           neighbor_index < relevant_face_edge_neighbor_count;
+           neighbor_index++) {
+        const int neighbor_face_index =
+            face_edge_neighbor_face_indices[relevant_face_edge_neighbor_offset +
+                                            neighbor_index];
+
+        if (face_search_marks[neighbor_face_index] == agent_index) {
+          continue;
+        }
+
+        face_search_marks[neighbor_face_index] = agent_index;
+
+        float constrained_location[3];
+
+        constrain_to_navigable_surface(
+            relevant_agent_location, face_vertex_counts, face_vertex_offsets,
+            face_vertex_locations, face_normals, edge_normals,
+            edge_coefficients, neighbor_face_index, constrained_location);
+
+        const float delta[] = {
+            constrained_location[0] - relevant_agent_location[0],
+            constrained_location[1] - relevant_agent_location[1],
+            constrained_location[2] - relevant_agent_location[2],
+        };
+
+        if (delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2] <=
+            search_radius_squared) {
+          face_search_queue[queue_end] = neighbor_face_index;
+          queue_end++;
+        }
+      }
+    }
+
+    float *const relevant_result_agent_velocity =
+        result_agent_velocities + agent_index * 3;
+
+    relevant_result_agent_velocity[0] =
+        relevant_agent_velocity[0] + avoidance[0];
+    relevant_result_agent_velocity[1] =
+        relevant_agent_velocity[1] + avoidance[1];
+    relevant_result_agent_velocity[2] =
+        relevant_agent_velocity[2] + avoidance[2];
+  }
+
+  for (int agent_index = 0; agent_index < agent_count; agent_index++) {
+    const float *const relevant_agent_location =
+        agent_locations + agent_index * 3;
+    float *const relevant_result_agent_location =
+        result_agent_locations + agent_index * 3;
+    float *const relevant_result_agent_velocity =
+        result_agent_velocities + agent_index * 3;
+
+    const float to[] = {
+        relevant_agent_location[0] +
+            relevant_result_agent_velocity[0] * delta_time,
+        relevant_agent_location[1] +
+            relevant_result_agent_velocity[1] * delta_time,
+        relevant_agent_location[2] +
+            relevant_result_agent_velocity[2] * delta_time,
+    };
+
+    move_across_navigation_mesh(
+        relevant_agent_location, agent_face_indices[agent_index], to,
+        maximum_iterations, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_normals, edge_exit_normals,
+        face_edge_neighbor_counts, face_edge_neighbor_offsets,
+        face_edge_neighbor_face_indices, face_flags, NULL, NULL, NULL, NULL,
+        NULL, NULL, 0.0f, include_flags, exclude_flags,
+        relevant_result_agent_location, result_agent_face_indices + agent_index,
+        agent_index, maximum_events, event_count, event_agent_indices,
+        event_from_face_indices, event_to_face_indices, event_edge_indices,
+        event_locations);
+
+    const float inverse_delta_time = 1.0f / delta_time;
+
+    relevant_result_agent_velocity[0] =
+        (relevant_result_agent_location[0] - relevant_agent_location[0]) *
+        inverse_delta_time;
+    relevant_result_agent_velocity[1] =
+        (relevant_result_agent_location[1] - relevant_agent_location[1]) *
+        inverse_delta_time;
+    relevant_result_agent_velocity[2] =
+        (relevant_result_agent_location[2] - relevant_agent_location[2]) *
+        inverse_delta_time;
+  }
+}
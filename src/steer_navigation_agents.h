@@ -0,0 +1,136 @@
+#ifndef STEER_NAVIGATION_AGENTS_H
+
+#define STEER_NAVIGATION_AGENTS_H
+
+/**
+ * Performs a single step of local steering for a batch of agents, adjusting
+ * their velocities to avoid one another and then moving them across the
+ * navigation mesh using move_across_navigation_mesh.  Agents avoid other
+ * agents on any face reachable across edges from their own which is close
+ * enough for the two to meet within time_horizon.  Agents on course to pass
+ * through one another exactly are steered apart perpendicular to their
+ * relative velocity.
+ * @param agent_count The number of agents.
+ * @param agent_locations The 3D vector describing the location of each agent.
+ *                        Behavior is undefined if outside of the volume of the
+ *                        agent's face or if any component is NaN, infinity or
+ *                        negative infinity.
+ * @param agent_velocities The 3D vector describing the velocity each agent
+ *                         wishes to travel at.  Behavior is undefined if any
+ *                         component is NaN, infinity or negative infinity.
+ * @param agent_radii The radius of each agent.  Behavior is undefined if any
+ *                    is NaN, infinity, negative infinity or negative.
+ * @param agent_face_indices The index of the face containing each agent.
+ * @param time_horizon How far ahead in time to look for collisions between
+ *                     agents.  Behavior is undefined if NaN, infinity,
+ *                     negative infinity or negative.
+ * @param delta_time The time elapsed during this step.  Behavior is undefined
+ *                   if NaN, infinity, negative infinity, zero or negative.
+ * @param maximum_iterations The maximum number of iterations of sliding
+ *                           navigation collision to perform per agent.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D unit vector describing the surface normal of each
+ *                     face within the navigation mesh.
+ * @param edge_normals A 3D unit vector perpendicular to both each edge of each
+ *                     face of the navigation mesh and its corresponding face
+ *                     surface normal, pointing out of the face into a
+ *                     hypothetical neighboring face.
+ * @param edge_exit_normals A 3D unit vector perpendicular to each edge of each
+ *                          face of the navigation mesh, pointing out of the
+ *                          face into a hypothetical neighboring face.  Where no
+ *                          neighbors exist, this is perpendicular to the face's
+ *                          surface normal.  It is otherwise averaged with the
+ *                          neighboring edge exit normals to ensure that there
+ *                          is a consistent plane to cross to enter or exit the
+ *                          face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh.  Each points to the next vertex of
+ *                          the face, with a magnitude equal to the reciprocal
+ *                          of the distance to that vertex.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL to allow entry to every
+ *                   face.
+ * @param include_flags When face_flags is not NULL, agents only enter faces
+ *                      with at least one of these flags.
+ * @param exclude_flags When face_flags is not NULL, agents do not enter faces
+ *                      with any of these flags.
+ * @param face_agent_offsets Overwritten with the exclusive running totals of
+ *                           the number of agents on each face, followed by the
+ *                           total.  Must have space for face_count + 1 values.
+ * @param face_agent_indices Overwritten with the indices of the agents on each
+ *                           face, grouped by face.  Must have space for
+ *                           agent_count values.
+ * @param face_search_marks Overwritten with temporary data.  Must have space
+ *                          for face_count values.
+ * @param face_search_queue Overwritten with temporary data.  Must have space
+ *                          for face_count values.
+ * @param result_agent_locations Overwritten with the 3D vector describing the
+ *                               location each agent reached.  Must not overlap
+ *                               with any input.
+ * @param result_agent_velocities Overwritten with the 3D vector describing the
+ *                                velocity each agent actually traveled at,
+ *                                after avoidance and collision.  Must not
+ *                                overlap with any input.
+ * @param result_agent_face_indices Overwritten with the index of the face
+ *                                  containing each agent's resulting location.
+ *                                  Must not overlap with any input.
+ * @param maximum_events The number of events which the event arrays have
+ *                       space for.
+ * @param event_count Incremented by one for each face entered by an agent
+ *                    crossing an edge, grouped by agent in ascending order of
+ *                    agent index.  Events which would exceed maximum_events
+ *                    are counted but not written.  May be NULL, in which case
+ *                    no events are recorded and the event arrays are ignored.
+ * @param event_agent_indices Overwritten with the index of the agent which
+ *                            caused each event.
+ * @param event_from_face_indices Overwritten with the index of the face left
+ *                                by each event.
+ * @param event_to_face_indices Overwritten with the index of the face entered
+ *                              by each event.
+ * @param event_edge_indices Overwritten with the index of the edge crossed by
+ *                           each event, within the face left.
+ * @param event_locations Overwritten with a 3D vector describing the location
+ *                        at which each event crossed its edge.
+ */
+void steer_navigation_agents(
+    const int agent_count, const float *const agent_locations,
+    const float *const agent_velocities, const float *const agent_radii,
+    const int *const agent_face_indices, const float time_horizon,
+    const float delta_time, const int maximum_iterations, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_exit_normals,
+    const float *const edge_coefficients,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const int include_flags,
+    const int exclude_flags, int *const face_agent_offsets,
+    int *const face_agent_indices, int *const face_search_marks,
+    int *const face_search_queue, float *const result_agent_locations,
+    float *const result_agent_velocities, int *const result_agent_face_indices,
+    const int maximum_events, int *const event_count,
+    int *const event_agent_indices, int *const event_from_face_indices,
+    int *const event_to_face_indices, int *const event_edge_indices,
+    float *const event_locations);
+
+#endif
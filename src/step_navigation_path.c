@@ -0,0 +1,239 @@
+#include "step_navigation_path.h"
+#include "navigation_path_status.h"
+#include "square_root.h"
+#include <stddef.h>
+
+static float distance(const float *const a, const float *const b) {
+  const float delta[] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  return square_root(delta[0] * delta[0] + delta[1] * delta[1] +
+                     delta[2] * delta[2]);
+}
+
+static void swap(int *const face_heap_positions, int *const heap,
+                 const int index_a, const int index_b) {
+  const int face_index_a = heap[index_a];
+  const int face_index_b = heap[index_b];
+  heap[index_a] = face_index_b;
+  heap[index_b] = face_index_a;
+  face_heap_positions[face_index_a] = index_b;
+  face_heap_positions[face_index_b] = index_a;
+}
+
+static void sift_up(const float *const face_priorities,
+                    int *const face_heap_positions, int *const heap,
+                    int index) {
+  while (index > 0) {
+    const int parent = (index - 1) / 2;
+
+    if (face_priorities[heap[parent]] <= face_priorities[heap[index]]) {
+      return;
+    }
+
+    swap(face_heap_positions, heap, index, parent);
+    index = parent;
+  }
+}
+
+static void sift_down(const float *const face_priorities,
+                      int *const face_heap_positions, int *const heap,
+                      int index, const int count) {
+  while (index * 2 + 1 < count) {
+    int child = index * 2 + 1;
+
+    if (child + 1 < count &&
+        face_priorities[heap[child + 1]] < face_priorities[heap[child]]) {
+      child++;
+    }
+
+    if (face_priorities[heap[index]] <= face_priorities[heap[child]]) {
+      return;
+    }
+
+    swap(face_heap_positions, heap, index, child);
+    index = child;
+  }
+}
+
+static void visit(const int face_index, const int parent_face_index,
+                  const int parent_link_index, const float cost,
+                  const float *const entry_location,
+                  const float *const goal_location,
+                  const int *const face_flags, const int include_flags,
+                  const int exclude_flags, float *const face_costs,
+                  float *const face_priorities,
+                  float *const face_entry_locations,
+                  int *const face_parent_indices,
+                  int *const face_parent_link_indices,
+                  int *const face_heap_positions, int *const heap,
+                  int *const heap_count) {
+  if (face_flags != NULL && parent_face_index != -1 &&
+      ((face_flags[face_index] & include_flags) == 0 ||
+       (face_flags[face_index] & exclude_flags) != 0)) {
+    return;
+  }
+
+  const int heap_position = face_heap_positions[face_index];
+
+  if (heap_position == -2 ||
+      (heap_position >= 0 && cost >= face_costs[face_index])) {
+    return;
+  }
+
+  float *const relevant_face_entry_location =
+      face_entry_locations + face_index * 3;
+
+  relevant_face_entry_location[0] = entry_location[0];
+  relevant_face_entry_location[1] = entry_location[1];
+  relevant_face_entry_location[2] = entry_location[2];
+  face_costs[face_index] = cost;
+  face_priorities[face_index] =
+      goal_location == NULL ? cost
+                            : cost + distance(entry_location, goal_location);
+  face_parent_indices[face_index] = parent_face_index;
+  face_parent_link_indices[face_index] = parent_link_index;
+
+  if (heap_position == -1) {
+    heap[*heap_count] = face_index;
+    face_heap_positions[face_index] = *heap_count;
+    (*heap_count)++;
+    sift_up(face_priorities, face_heap_positions, heap, *heap_count - 1);
+  } else {
+    sift_up(face_priorities, face_heap_positions, heap, heap_position);
+  }
+}
+
+int step_navigation_path(
+    const float *const goal_location, const int goal_face_index,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, float *const face_costs,
+    float *const face_priorities, float *const face_entry_locations,
+    int *const face_parent_indices, int *const face_parent_link_indices,
+    int *const face_heap_positions, int *const heap, int *const heap_count,
+    const int maximum_iterations, int *const iteration_count) {
+  const float *const estimate_goal_location =
+      face_link_offsets == NULL ? goal_location : NULL;
+
+  for (int iteration = 0; iteration < maximum_iterations; iteration++) {
+    if (face_heap_positions[goal_face_index] == -2) {
+      return NAVIGATION_PATH_STATUS_FOUND;
+    }
+
+    if (*heap_count == 0) {
+      return NAVIGATION_PATH_STATUS_NOT_FOUND;
+    }
+
+    const int face_index = heap[0];
+
+    (*heap_count)--;
+    swap(face_heap_positions, heap, 0, *heap_count);
+    sift_down(face_priorities, face_heap_positions, heap, 0, *heap_count);
+    face_heap_positions[face_index] = -2;
+    (*iteration_count)++;
+
+    if (face_index == goal_face_index) {
+      return NAVIGATION_PATH_STATUS_FOUND;
+    }
+
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+    const float *const relevant_face_entry_location =
+        face_entry_locations + face_index * 3;
+    const float relevant_face_cost = face_costs[face_index];
+    const float relevant_face_cost_multiplier =
+        face_cost_multipliers == NULL ? 1.0f
+                                      : face_cost_multipliers[face_index];
+
+    for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+         vertex_index++) {
+      const int edge_index = relevant_face_vertex_offset + vertex_index;
+      const int relevant_face_edge_neighbor_count =
+          face_edge_neighbor_counts[edge_index];
+
+      if (relevant_face_edge_neighbor_count == 0) {
+        continue;
+      }
+
+      const float *const relevant_face_vertex_location =
+          relevant_face_vertex_locations + vertex_index * 3;
+      const float *const next_face_vertex_location =
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
+
+      const float midpoint[] = {
+          (relevant_face_vertex_location[0] + next_face_vertex_location[0]) *
+              0.5f,
+          (relevant_face_vertex_location[1] + next_face_vertex_location[1]) *
+              0.5f,
+          (relevant_face_vertex_location[2] + next_face_vertex_location[2]) *
+              0.5f,
+      };
+
+      const float cost =
+          relevant_face_cost +
+          distance(relevant_face_entry_location, midpoint) *
+              relevant_face_cost_multiplier;
+
+      const int *const relevant_face_edge_neighbor_face_indices =
+          face_edge_neighbor_face_indices +
+          face_edge_neighbor_offsets[edge_index];
+
+      for (int neighbor_index = 0;
+           neighbor_index < relevant_face_edge_neighbor_count;
+           neighbor_index++) {
+        visit(relevant_face_edge_neighbor_face_indices[neighbor_index],
+              face_index, -1, cost, midpoint, estimate_goal_location,
+              face_flags, include_flags, exclude_flags, face_costs,
+              face_priorities, face_entry_locations, face_parent_indices,
+              face_parent_link_indices, face_heap_positions, heap, heap_count);
+      }
+    }
+
+    if (face_link_offsets == NULL) {
+      continue;
+    }
+
+    const int end = face_link_offsets[face_index + 1];
+
+    for (int entry_index = face_link_offsets[face_index]; entry_index < end;
+         entry_index++) {
+      const int link_index = face_link_indices[entry_index];
+
+      if (link_flags != NULL &&
+          ((link_flags[link_index] & include_flags) == 0 ||
+           (link_flags[link_index] & exclude_flags) != 0)) {
+        continue;
+      }
+
+      visit(link_end_face_indices[link_index], face_index, link_index,
+            relevant_face_cost +
+                distance(relevant_face_entry_location,
+                         link_start_locations + link_index * 3) *
+                    relevant_face_cost_multiplier +
+                link_costs[link_index],
+            link_end_locations + link_index * 3, estimate_goal_location,
+            face_flags, include_flags, exclude_flags, face_costs,
+            face_priorities, face_entry_locations, face_parent_indices,
+            face_parent_link_indices, face_heap_positions, heap, heap_count);
+    }
+  }
+
+  if (face_heap_positions[goal_face_index] == -2) {
+    return NAVIGATION_PATH_STATUS_FOUND;
+  }
+
+  return *heap_count == 0 ? NAVIGATION_PATH_STATUS_NOT_FOUND
+                          : NAVIGATION_PATH_STATUS_IN_PROGRESS;
+}
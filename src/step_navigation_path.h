@@ -0,0 +1,104 @@
+#ifndef STEP_NAVIGATION_PATH_H
+
+#define STEP_NAVIGATION_PATH_H
+
+/**
+ * Advances a search begun using begin_navigation_path by expanding at most a
+ * given number of faces, so that long searches can be spread across several
+ * frames without exceeding a per-frame budget.  Running a search to completion
+ * in any number of steps finds the same path as find_navigation_path.  When
+ * face_link_offsets is not NULL, faces are expanded in order of cost alone, as
+ * a link may be cheaper to follow than the distance it spans.
+ * @param goal_location The 3D vector describing the location to find a path
+ *                      to, as given to begin_navigation_path.
+ * @param goal_face_index The index of the face containing goal_location.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL if faces have no flags.
+ * @param face_cost_multipliers A multiplier for the distance travelled across
+ *                              each face of the navigation mesh (e.g. 3 for
+ *                              mud), or NULL if every face has a multiplier of
+ *                              1.  Paths may not be the cheapest if any is
+ *                              less than 1.  Behavior is undefined if any is
+ *                              NaN, infinity, negative infinity or negative.
+ * @param face_link_offsets The face link offsets produced by
+ *                          navigation_link_table, or NULL to ignore off-mesh
+ *                          links.
+ * @param face_link_indices The face link indices produced by
+ *                          navigation_link_table.  Ignored when
+ *                          face_link_offsets is NULL.
+ * @param link_end_face_indices The index of the face at which each link ends.
+ *                              Ignored when face_link_offsets is NULL.
+ * @param link_start_locations A 3D vector describing the location at which
+ *                             each link starts.  Ignored when
+ *                             face_link_offsets is NULL.
+ * @param link_end_locations A 3D vector describing the location at which each
+ *                           link ends.  Ignored when face_link_offsets is
+ *                           NULL.
+ * @param link_costs The cost of following each link, in addition to the
+ *                   distance travelled to reach its start.  Behavior is
+ *                   undefined if any is NaN, infinity, negative infinity or
+ *                   negative.  Ignored when face_link_offsets is NULL.
+ * @param link_flags Flags describing each link (e.g. 1 for jumps, 2 for
+ *                   ladders), or NULL if links have no flags.  Ignored when
+ *                   face_link_offsets is NULL.
+ * @param include_flags Only faces (other than the start face) and links with
+ *                      at least one of these flags are entered, where
+ *                      face_flags or link_flags respectively is not NULL.
+ * @param exclude_flags Faces (other than the start face) and links with any of
+ *                      these flags are not entered, where face_flags or
+ *                      link_flags respectively is not NULL.
+ * @param face_costs The search state given to begin_navigation_path.
+ * @param face_priorities The search state given to begin_navigation_path.
+ * @param face_entry_locations The search state given to begin_navigation_path.
+ * @param face_parent_indices The search state given to begin_navigation_path.
+ * @param face_parent_link_indices The search state given to
+ *                                 begin_navigation_path.
+ * @param face_heap_positions The search state given to begin_navigation_path.
+ * @param heap The search state given to begin_navigation_path.
+ * @param heap_count The search state given to begin_navigation_path.
+ * @param maximum_iterations The maximum number of faces to expand.
+ * @param iteration_count Incremented by the number of faces expanded.
+ * @return NAVIGATION_PATH_STATUS_IN_PROGRESS if maximum_iterations faces were
+ *         expanded without finishing the search,
+ *         NAVIGATION_PATH_STATUS_FOUND if goal_face_index has been reached or
+ *         NAVIGATION_PATH_STATUS_NOT_FOUND if it cannot be reached.
+ */
+int step_navigation_path(
+    const float *const goal_location, const int goal_face_index,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, float *const face_costs,
+    float *const face_priorities, float *const face_entry_locations,
+    int *const face_parent_indices, int *const face_parent_link_indices,
+    int *const face_heap_positions, int *const heap, int *const heap_count,
+    const int maximum_iterations, int *const iteration_count);
+
+#endif
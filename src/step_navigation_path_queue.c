@@ -0,0 +1,64 @@
+#include "step_navigation_path_queue.h"
+#include "navigation_path_status.h"
+#include "step_navigation_path.h"
+
+int step_navigation_path_queue(
+    const int request_count, const float *const request_priorities,
+    const float *const request_goal_locations,
+    const int *const request_goal_face_indices, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, float *const face_costs,
+    float *const face_priorities, float *const face_entry_locations,
+    int *const face_parent_indices, int *const face_parent_link_indices,
+    int *const face_heap_positions, int *const heaps,
+    int *const request_heap_counts, const int iteration_budget,
+    int *const request_statuses) {
+  int iteration_count = 0;
+
+  while (iteration_count < iteration_budget) {
+    int request_index = -1;
+
+    for (int candidate_request_index = 0;
+         candidate_request_index < request_count; candidate_request_index++) {
+      if (request_statuses[candidate_request_index] ==
+              NAVIGATION_PATH_STATUS_IN_PROGRESS &&
+          (request_index == -1 ||
+           request_priorities[candidate_request_index] >
+               request_priorities[request_index])) {
+        request_index = candidate_request_index;
+      }
+    }
+
+    if (request_index == -1) {
+      break;
+    }
+
+    const int offset = request_index * face_count;
+
+    request_statuses[request_index] = step_navigation_path(
+        request_goal_locations + request_index * 3,
+        request_goal_face_indices[request_index], face_vertex_counts,
+        face_vertex_offsets, face_vertex_locations, face_edge_neighbor_counts,
+        face_edge_neighbor_offsets, face_edge_neighbor_face_indices,
+        face_flags, face_cost_multipliers, face_link_offsets,
+        face_link_indices, link_end_face_indices, link_start_locations,
+        link_end_locations, link_costs, link_flags, include_flags,
+        exclude_flags, face_costs + offset, face_priorities + offset,
+        face_entry_locations + offset * 3, face_parent_indices + offset,
+        face_parent_link_indices + offset, face_heap_positions + offset,
+        heaps + offset, request_heap_counts + request_index,
+        iteration_budget - iteration_count, &iteration_count);
+  }
+
+  return iteration_count;
+}
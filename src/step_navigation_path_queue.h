@@ -0,0 +1,122 @@
+#ifndef STEP_NAVIGATION_PATH_QUEUE_H
+
+#define STEP_NAVIGATION_PATH_QUEUE_H
+
+/**
+ * Advances a queue of path requests, each a search begun using
+ * begin_navigation_path, within a fixed iteration budget (such as one
+ * calibrated to a per-frame time ceiling).  The budget is spent on the
+ * request with the highest priority which is still in progress (the lowest
+ * index among equals) until it finishes, then the next, and so on, so the
+ * total cost of a call is bounded no matter how many requests are queued.
+ * Raising the priority of requests which have waited prevents starvation.
+ * The state of each request is kept in caller-provided pools, in which
+ * request request_index uses the values starting at request_index * face_count
+ * (and the 3D vectors starting at request_index * face_count in
+ * face_entry_locations).
+ * @param request_count The number of requests in the queue.
+ * @param request_priorities The priority of each request, where higher values
+ *                           are advanced first.  Behavior is undefined if any
+ *                           is NaN.
+ * @param request_goal_locations A 3D vector describing the goal location of
+ *                               each request, as given to
+ *                               begin_navigation_path.
+ * @param request_goal_face_indices The index of the face containing the goal
+ *                                  location of each request.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.  Behavior is defined if any is
+ *                           less than 3.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_edge_neighbor_counts The number of neighboring faces for each
+ *                                  edge of each face of the navigation mesh.
+ * @param face_edge_neighbor_offsets The exclusive running totals of the
+ *                                   neighbor count of each edge of each face
+ *                                   (e.g. for neighbor counts 1, 0, 2, 1, this
+ *                                   would contain 0, 1, 1, 3).
+ * @param face_edge_neighbor_face_indices The index of each neighboring face of
+ *                                        each edge of each face of the
+ *                                        navigation mesh.
+ * @param face_flags Flags describing each face of the navigation mesh (e.g. 1
+ *                   for ground, 2 for water), or NULL if faces have no flags.
+ * @param face_cost_multipliers A multiplier for the distance travelled across
+ *                              each face of the navigation mesh (e.g. 3 for
+ *                              mud), or NULL if every face has a multiplier of
+ *                              1.  Paths may not be the cheapest if any is
+ *                              less than 1.  Behavior is undefined if any is
+ *                              NaN, infinity, negative infinity or negative.
+ * @param face_link_offsets The face link offsets produced by
+ *                          navigation_link_table, or NULL to ignore off-mesh
+ *                          links.
+ * @param face_link_indices The face link indices produced by
+ *                          navigation_link_table.  Ignored when
+ *                          face_link_offsets is NULL.
+ * @param link_end_face_indices The index of the face at which each link ends.
+ *                              Ignored when face_link_offsets is NULL.
+ * @param link_start_locations A 3D vector describing the location at which
+ *                             each link starts.  Ignored when
+ *                             face_link_offsets is NULL.
+ * @param link_end_locations A 3D vector describing the location at which each
+ *                           link ends.  Ignored when face_link_offsets is
+ *                           NULL.
+ * @param link_costs The cost of following each link, in addition to the
+ *                   distance travelled to reach its start.  Behavior is
+ *                   undefined if any is NaN, infinity, negative infinity or
+ *                   negative.  Ignored when face_link_offsets is NULL.
+ * @param link_flags Flags describing each link (e.g. 1 for jumps, 2 for
+ *                   ladders), or NULL if links have no flags.  Ignored when
+ *                   face_link_offsets is NULL.
+ * @param include_flags Only faces (other than the start face) and links with
+ *                      at least one of these flags are entered, where
+ *                      face_flags or link_flags respectively is not NULL.
+ * @param exclude_flags Faces (other than the start face) and links with any of
+ *                      these flags are not entered, where face_flags or
+ *                      link_flags respectively is not NULL.
+ * @param face_costs The pooled search state of every request.
+ * @param face_priorities The pooled search state of every request.
+ * @param face_entry_locations The pooled search state of every request.
+ * @param face_parent_indices The pooled search state of every request.
+ * @param face_parent_link_indices The pooled search state of every request.
+ * @param face_heap_positions The pooled search state of every request.
+ * @param heaps The pooled search state of every request.
+ * @param request_heap_counts The heap count search state of each request.
+ * @param iteration_budget The maximum number of faces to expand across all
+ *                         requests.
+ * @param request_statuses The status of each request.  Only requests with a
+ *                         status of NAVIGATION_PATH_STATUS_IN_PROGRESS (which
+ *                         should be set after calling begin_navigation_path)
+ *                         are advanced, and their statuses are updated with
+ *                         the value returned by step_navigation_path.  Any
+ *                         other value may be used to mark an unused request.
+ * @return The number of faces expanded, which does not exceed
+ *         iteration_budget.
+ */
+int step_navigation_path_queue(
+    const int request_count, const float *const request_priorities,
+    const float *const request_goal_locations,
+    const int *const request_goal_face_indices, const int face_count,
+    const int *const face_vertex_counts, const int *const face_vertex_offsets,
+    const float *const face_vertex_locations,
+    const int *const face_edge_neighbor_counts,
+    const int *const face_edge_neighbor_offsets,
+    const int *const face_edge_neighbor_face_indices,
+    const int *const face_flags, const float *const face_cost_multipliers,
+    const int *const face_link_offsets, const int *const face_link_indices,
+    const int *const link_end_face_indices,
+    const float *const link_start_locations,
+    const float *const link_end_locations, const float *const link_costs,
+    const int *const link_flags, const int include_flags,
+    const int exclude_flags, float *const face_costs,
+    float *const face_priorities, float *const face_entry_locations,
+    int *const face_parent_indices, int *const face_parent_link_indices,
+    int *const face_heap_positions, int *const heaps,
+    int *const request_heap_counts, const int iteration_budget,
+    int *const request_statuses);
+
+#endif
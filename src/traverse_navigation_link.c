@@ -0,0 +1,38 @@
+#include "traverse_navigation_link.h"
+
+int traverse_navigation_link(const float *const location, const int face_index,
+                             const int link_index, const float reach,
+                             const int *const link_start_face_indices,
+                             const float *const link_start_locations,
+                             const int *const link_end_face_indices,
+                             const float *const link_end_locations,
+                             float *const result_location,
+                             int *const result_face_index) {
+  const float *const relevant_link_start_location =
+      link_start_locations + link_index * 3;
+
+  const float delta[] = {
+      relevant_link_start_location[0] - location[0],
+      relevant_link_start_location[1] - location[1],
+      relevant_link_start_location[2] - location[2],
+  };
+
+  if (link_start_face_indices[link_index] != face_index ||
+      delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2] >
+          reach * reach) {
+    result_location[0] = location[0];
+    result_location[1] = location[1];
+    result_location[2] = location[2];
+    *result_face_index = face_index;
+    return 0;
+  }
+
+  const float *const relevant_link_end_location =
+      link_end_locations + link_index * 3;
+
+  result_location[0] = relevant_link_end_location[0];
+  result_location[1] = relevant_link_end_location[1];
+  result_location[2] = relevant_link_end_location[2];
+  *result_face_index = link_end_face_indices[link_index];
+  return 1;
+}
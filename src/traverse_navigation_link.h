@@ -0,0 +1,41 @@
+#ifndef TRAVERSE_NAVIGATION_LINK_H
+
+#define TRAVERSE_NAVIGATION_LINK_H
+
+/**
+ * Moves an object across an off-mesh link (such as a jump, ladder or
+ * teleporter) once it has reached the start of the link, for instance using
+ * move_across_navigation_mesh while following a path returned by
+ * find_navigation_path.
+ * @param location The 3D vector describing the location of the object.
+ *                 Behavior is undefined if any component is NaN, infinity or
+ *                 negative infinity.
+ * @param face_index The index of the face containing the object.
+ * @param link_index The index of the link to traverse.
+ * @param reach The maximum distance between the object and the start of the
+ *              link for the link to be traversed.  Behavior is undefined if
+ *              NaN, infinity, negative infinity or negative.
+ * @param link_start_face_indices The index of the face from which each link
+ *                                starts.
+ * @param link_start_locations A 3D vector describing the location at which
+ *                             each link starts.
+ * @param link_end_face_indices The index of the face at which each link ends.
+ * @param link_end_locations A 3D vector describing the location at which each
+ *                           link ends.
+ * @param result_location The 3D vector which is overwritten with the end of
+ *                        the link when traversed, otherwise location.
+ * @param result_face_index Overwritten with the index of the face at which the
+ *                          link ends when traversed, otherwise face_index.
+ * @return 1 when the link was traversed, otherwise 0 (the object is not on
+ *         the face from which the link starts, or is out of reach).
+ */
+int traverse_navigation_link(const float *const location, const int face_index,
+                             const int link_index, const float reach,
+                             const int *const link_start_face_indices,
+                             const float *const link_start_locations,
+                             const int *const link_end_face_indices,
+                             const float *const link_end_locations,
+                             float *const result_location,
+                             int *const result_face_index);
+
+#endif
@@ -0,0 +1,193 @@
+#include "validate_navigation_mesh.h"
+#include "navigation_mesh_violation.h"
+#include <stdbool.h>
+
+static void report(const int type, const int face_index, const int edge_index,
+                   const int maximum_violations, int *const violation_count,
+                   int *const result_violation_types,
+                   int *const result_violation_face_indices,
+                   int *const result_violation_edge_indices) {
+  if (*violation_count < maximum_violations) {
+    result_violation_types[*violation_count] = type;
+    result_violation_face_indices[*violation_count] = face_index;
+    result_violation_edge_indices[*violation_count] = edge_index;
+  }
+
+  (*violation_count)++;
+}
+
+static bool is_non_unit(const float *const vector, const float tolerance) {
+  const float magnitude_squared =
+      vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2];
+  const float minimum = 1.0f - tolerance;
+  const float maximum = 1.0f + tolerance;
+  return magnitude_squared < (minimum > 0.0f ? minimum * minimum : 0.0f) ||
+         magnitude_squared > maximum * maximum;
+}
+
+int validate_navigation_mesh(
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const float tolerance, const int maximum_violations,
+    int *const result_violation_types,
+    int *const result_violation_face_indices,
+    int *const result_violation_edge_indices) {
+  int output = 0;
+  const float tolerance_squared = tolerance * tolerance;
+
+  for (int face_index = 0; face_index < face_count; face_index++) {
+    const int relevant_face_vertex_count = face_vertex_counts[face_index];
+
+    if (relevant_face_vertex_count < 3) {
+      report(NAVIGATION_MESH_VIOLATION_TOO_FEW_VERTICES, face_index, -1,
+             maximum_violations, &output, result_violation_types,
+             result_violation_face_indices, result_violation_edge_indices);
+      continue;
+    }
+
+    const int relevant_face_vertex_offset = face_vertex_offsets[face_index];
+    const float *const relevant_face_vertex_locations =
+        face_vertex_locations + relevant_face_vertex_offset * 3;
+    const float *const relevant_face_normal = face_normals + face_index * 3;
+    const float *const relevant_edge_normals =
+        edge_normals + relevant_face_vertex_offset * 3;
+    const float *const relevant_edge_coefficients =
+        edge_coefficients + relevant_face_vertex_offset * 3;
+
+    if (is_non_unit(relevant_face_normal, tolerance)) {
+      report(NAVIGATION_MESH_VIOLATION_NON_UNIT_FACE_NORMAL, face_index, -1,
+             maximum_violations, &output, result_violation_types,
+             result_violation_face_indices, result_violation_edge_indices);
+    }
+
+    for (int vertex_index = 0; vertex_index < relevant_face_vertex_count;
+         vertex_index++) {
+      const float *const relevant_face_vertex_location =
+          relevant_face_vertex_locations + vertex_index * 3;
+      const float *const next_face_vertex_location =
+          vertex_index == relevant_face_vertex_count - 1
+              ? relevant_face_vertex_locations
+              : relevant_face_vertex_location + 3;
+      const float *const after_next_face_vertex_location =
+          relevant_face_vertex_locations +
+          (vertex_index + 2 < relevant_face_vertex_count
+               ? vertex_index + 2
+               : vertex_index + 2 - relevant_face_vertex_count) *
+              3;
+      const float *const relevant_edge_normal =
+          relevant_edge_normals + vertex_index * 3;
+      const float *const relevant_edge_coefficient =
+          relevant_edge_coefficients + vertex_index * 3;
+
+      const float surface_distance =
+          (relevant_face_vertex_location[0] -
+           relevant_face_vertex_locations[0]) *
+              relevant_face_normal[0] +
+          (relevant_face_vertex_location[1] -
+           relevant_face_vertex_locations[1]) *
+              relevant_face_normal[1] +
+          (relevant_face_vertex_location[2] -
+           relevant_face_vertex_locations[2]) *
+              relevant_face_normal[2];
+
+      if (surface_distance > tolerance || surface_distance < -tolerance) {
+        report(NAVIGATION_MESH_VIOLATION_NON_PLANAR_FACE, face_index,
+               vertex_index, maximum_violations, &output,
+               result_violation_types, result_violation_face_indices,
+               result_violation_edge_indices);
+      }
+
+      if (is_non_unit(relevant_edge_normal, tolerance)) {
+        report(NAVIGATION_MESH_VIOLATION_NON_UNIT_EDGE_NORMAL, face_index,
+               vertex_index, maximum_violations, &output,
+               result_violation_types, result_violation_face_indices,
+               result_violation_edge_indices);
+      }
+
+      const float edge[] = {
+          next_face_vertex_location[0] - relevant_face_vertex_location[0],
+          next_face_vertex_location[1] - relevant_face_vertex_location[1],
+          next_face_vertex_location[2] - relevant_face_vertex_location[2],
+      };
+
+      const float edge_length_squared =
+          edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2];
+
+      const float normal_alignment =
+          relevant_edge_normal[0] * relevant_face_normal[0] +
+          relevant_edge_normal[1] * relevant_face_normal[1] +
+          relevant_edge_normal[2] * relevant_face_normal[2];
+
+      const float edge_alignment = relevant_edge_normal[0] * edge[0] +
+                                   relevant_edge_normal[1] * edge[1] +
+                                   relevant_edge_normal[2] * edge[2];
+
+      if (normal_alignment > tolerance || normal_alignment < -tolerance ||
+          edge_alignment * edge_alignment >
+              tolerance_squared * edge_length_squared) {
+        report(NAVIGATION_MESH_VIOLATION_NON_PERPENDICULAR_EDGE_NORMAL,
+               face_index, vertex_index, maximum_violations, &output,
+               result_violation_types, result_violation_face_indices,
+               result_violation_edge_indices);
+      }
+
+      const float outward[] = {
+          edge[1] * relevant_face_normal[2] - edge[2] * relevant_face_normal[1],
+          edge[2] * relevant_face_normal[0] - edge[0] * relevant_face_normal[2],
+          edge[0] * relevant_face_normal[1] - edge[1] * relevant_face_normal[0],
+      };
+
+      if (relevant_edge_normal[0] * outward[0] +
+              relevant_edge_normal[1] * outward[1] +
+              relevant_edge_normal[2] * outward[2] <=
+          0.0f) {
+        report(NAVIGATION_MESH_VIOLATION_INCONSISTENT_WINDING, face_index,
+               vertex_index, maximum_violations, &output,
+               result_violation_types, result_violation_face_indices,
+               result_violation_edge_indices);
+      }
+
+      const float coefficient_error[] = {
+          relevant_edge_coefficient[0] * edge_length_squared - edge[0],
+          relevant_edge_coefficient[1] * edge_length_squared - edge[1],
+          relevant_edge_coefficient[2] * edge_length_squared - edge[2],
+      };
+
+      if (coefficient_error[0] * coefficient_error[0] +
+              coefficient_error[1] * coefficient_error[1] +
+              coefficient_error[2] * coefficient_error[2] >
+          tolerance_squared * edge_length_squared) {
+        report(NAVIGATION_MESH_VIOLATION_INCORRECT_EDGE_COEFFICIENT,
+               face_index, vertex_index, maximum_violations, &output,
+               result_violation_types, result_violation_face_indices,
+               result_violation_edge_indices);
+      }
+
+      const float convexity =
+          (after_next_face_vertex_location[0] -
+           relevant_face_vertex_location[0]) *
+              outward[0] +
+          (after_next_face_vertex_location[1] -
+           relevant_face_vertex_location[1]) *
+              outward[1] +
+          (after_next_face_vertex_location[2] -
+           relevant_face_vertex_location[2]) *
+              outward[2];
+
+      if (convexity > 0.0f &&
+          convexity * convexity >
+              tolerance_squared * (outward[0] * outward[0] +
+                                   outward[1] * outward[1] +
+                                   outward[2] * outward[2])) {
+        report(NAVIGATION_MESH_VIOLATION_NON_CONVEX_FACE, face_index,
+               vertex_index, maximum_violations, &output,
+               result_violation_types, result_violation_face_indices,
+               result_violation_edge_indices);
+      }
+    }
+  }
+
+  return output;
+}
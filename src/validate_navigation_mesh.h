@@ -0,0 +1,59 @@
+#ifndef VALIDATE_NAVIGATION_MESH_H
+
+#define VALIDATE_NAVIGATION_MESH_H
+
+/**
+ * Checks that a navigation mesh meets the assumptions made by the other
+ * functions, in time linear to its number of vertices.
+ * @param face_count The number of faces in the navigation mesh.
+ * @param face_vertex_counts The number of vertices of each face in the
+ *                           navigation mesh.
+ * @param face_vertex_offsets The exclusive running totals of the vertex count
+ *                            of each face (e.g. for vertex counts 3, 5, 4, this
+ *                            would contain 0, 3, 8).
+ * @param face_vertex_locations A 3D vector describing the location of each
+ *                              vertex within each face of the navigation mesh.
+ *                              Behavior is undefined if any component is NaN,
+ *                              infinity or negative infinity.
+ * @param face_normals A 3D vector for each face within the navigation mesh,
+ *                     expected to be its unit surface normal.
+ * @param edge_normals A 3D vector for each edge of each face of the navigation
+ *                     mesh, expected to be a unit vector perpendicular to both
+ *                     the edge and its corresponding face surface normal,
+ *                     pointing out of the face.
+ * @param edge_coefficients A 3D vector for each vertex of each face of the
+ *                          navigation mesh, expected to point to the next
+ *                          vertex of the face with a magnitude equal to the
+ *                          reciprocal of the distance to that vertex.
+ * @param tolerance The maximum error to accept in any check (e.g. the distance
+ *                  of a vertex from the plane of its face, or the difference
+ *                  between the length of a normal and 1).  Behavior is
+ *                  undefined if NaN, infinity, negative infinity or negative.
+ * @param maximum_violations The number of violations which
+ *                           result_violation_types,
+ *                           result_violation_face_indices and
+ *                           result_violation_edge_indices have space for.
+ * @param result_violation_types Overwritten with the type of each violation
+ *                               found (see navigation_mesh_violation.h), in
+ *                               the order found.  Any beyond
+ *                               maximum_violations are not written.
+ * @param result_violation_face_indices Overwritten with the index of the face
+ *                                      of each violation found.
+ * @param result_violation_edge_indices Overwritten with the index of the edge
+ *                                      or vertex (within its face) of each
+ *                                      violation found, or -1 where the
+ *                                      violation concerns the whole face.
+ * @return The number of violations found, which may exceed maximum_violations.
+ *         Zero indicates a valid navigation mesh.
+ */
+int validate_navigation_mesh(
+    const int face_count, const int *const face_vertex_counts,
+    const int *const face_vertex_offsets,
+    const float *const face_vertex_locations, const float *const face_normals,
+    const float *const edge_normals, const float *const edge_coefficients,
+    const float tolerance, const int maximum_violations,
+    int *const result_violation_types,
+    int *const result_violation_face_indices,
+    int *const result_violation_edge_indices);
+
+#endif
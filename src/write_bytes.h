@@ -0,0 +1,25 @@
+#ifndef WRITE_BYTES_H
+
+#define WRITE_BYTES_H
+
+/**
+ * Copies the bytes of a value into a buffer (such as a navigation recording)
+ * without the standard library, which is unavailable in freestanding builds.
+ * @param destination The location within the buffer at which to write.
+ * @param source The value to copy.
+ * @param size The number of bytes to copy.
+ * @return The location within the buffer following the bytes written.
+ */
+static inline unsigned char *write_bytes(unsigned char *const destination,
+                                         const void *const source,
+                                         const int size) {
+  const unsigned char *const bytes = (const unsigned char *)source;
+
+  for (int index = 0; index < size; index++) {
+    destination[index] = bytes[index];
+  }
+
+  return destination + size;
+}
+
+#endif
@@ -0,0 +1,144 @@
+#include "../../src/advance_navigation_corridor.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int face_flags[] = {1, 1, 2, 1};
+
+static void check_corridor(const char *const description,
+                           const int face_index, const int lookahead,
+                           const int *const face_flags_or_null,
+                           const int corridor_length,
+                           const int *const corridor_face_indices,
+                           const int *const corridor_link_indices,
+                           const int expected_length,
+                           const int *const expected_face_indices,
+                           const int *const expected_link_indices) {
+  int face_indices[] = {-1, -1, -1, -1, -1, -1};
+  int link_indices[] = {-2, -2, -2, -2, -2, -2};
+
+  for (int index = 0; index < corridor_length; index++) {
+    face_indices[index] = corridor_face_indices[index];
+    link_indices[index] = corridor_link_indices[index];
+  }
+
+  const int length = advance_navigation_corridor(
+      face_index, lookahead, face_vertex_counts, face_vertex_offsets,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, face_flags_or_null, 1, 4,
+      corridor_length, 5, face_indices, link_indices);
+
+  check_int(description, "length", expected_length, length);
+
+  for (int index = 0; index < 6; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              face_indices[index]);
+    check_int(description, "link index", expected_link_indices[index],
+              link_indices[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int corridor_face_indices[] = {2, 0, 1};
+  const int corridor_link_indices[] = {7, -1, -1};
+
+  const int unchanged_face_indices[] = {2, 0, 1, -1, -1, -1};
+  const int unchanged_link_indices[] = {7, -1, -1, -2, -2, -2};
+
+  check_corridor("current face", 1, 3, NULL, 3, corridor_face_indices,
+                 corridor_link_indices, 3, unchanged_face_indices,
+                 unchanged_link_indices);
+  check_corridor("next face", 0, 3, NULL, 3, corridor_face_indices,
+                 corridor_link_indices, 2, unchanged_face_indices,
+                 unchanged_link_indices);
+  check_corridor("goal face", 2, 3, NULL, 3, corridor_face_indices,
+                 corridor_link_indices, 1, unchanged_face_indices,
+                 unchanged_link_indices);
+
+  const int expected_beyond_face_indices[] = {2, 0, 2, -1, -1, -1};
+
+  check_corridor("beyond lookahead", 2, 2, NULL, 3, corridor_face_indices,
+                 corridor_link_indices, 3, expected_beyond_face_indices,
+                 unchanged_link_indices);
+
+  check_corridor("disconnected", 3, 3, NULL, 3, corridor_face_indices,
+                 corridor_link_indices, -1, unchanged_face_indices,
+                 unchanged_link_indices);
+
+  const int neighbor_face_indices[] = {1, 0};
+  const int neighbor_link_indices[] = {-1, 7};
+  const int expected_neighbor_face_indices[] = {1, 0, 2, -1, -1, -1};
+  const int expected_neighbor_link_indices[] = {-1, -1, -1, -2, -2, -2};
+
+  check_corridor("neighbor", 2, 2, NULL, 2, neighbor_face_indices,
+                 neighbor_link_indices, 3, expected_neighbor_face_indices,
+                 expected_neighbor_link_indices);
+
+  const int second_neighbor_face_indices[] = {1};
+  const int second_neighbor_link_indices[] = {-1};
+  const int expected_second_neighbor_face_indices[] = {1, 0, 2, -1, -1, -1};
+  const int expected_second_neighbor_link_indices[] = {-1, -1, -1, -2, -2, -2};
+
+  check_corridor("second neighbor", 2, 1, NULL, 1,
+                 second_neighbor_face_indices, second_neighbor_link_indices,
+                 3, expected_second_neighbor_face_indices,
+                 expected_second_neighbor_link_indices);
+  check_corridor("second neighbor included", 2, 1, face_flags, 1,
+                 second_neighbor_face_indices, second_neighbor_link_indices,
+                 3, expected_second_neighbor_face_indices,
+                 expected_second_neighbor_link_indices);
+
+  const int excluded_face_flags[] = {5, 1, 1, 1};
+  const int expected_excluded_face_indices[] = {1, -1, -1, -1, -1, -1};
+  const int expected_excluded_link_indices[] = {-1, -2, -2, -2, -2, -2};
+
+  check_corridor("second neighbor excluded", 2, 1, excluded_face_flags, 1,
+                 second_neighbor_face_indices, second_neighbor_link_indices,
+                 -1, expected_excluded_face_indices,
+                 expected_excluded_link_indices);
+
+  const int not_included_face_flags[] = {2, 1, 1, 1};
+
+  check_corridor("second neighbor not included", 2, 1,
+                 not_included_face_flags, 1, second_neighbor_face_indices,
+                 second_neighbor_link_indices, -1,
+                 expected_excluded_face_indices,
+                 expected_excluded_link_indices);
+
+  const int long_face_indices[] = {3, 3, 3, 3, 1};
+  const int long_link_indices[] = {-1, -1, -1, -1, -1};
+  const int expected_long_face_indices[] = {3, 3, 3, 3, 1, -1};
+  const int expected_long_link_indices[] = {-1, -1, -1, -1, -1, -2};
+
+  check_corridor("exceeds maximum", 2, 1, NULL, 5, long_face_indices,
+                 long_link_indices, 7, expected_long_face_indices,
+                 expected_long_link_indices);
+
+  return exit_code;
+}
@@ -0,0 +1,66 @@
+#include "../../src/allocate_navigation_scratch.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static double storage[4];
+
+static void check(const char *const description, const int offset,
+                  const int scratch_capacity, const int scratch_used,
+                  const int size, const int alignment,
+                  const int expected_result_offset,
+                  const int expected_scratch_used) {
+  unsigned char *const bytes = (unsigned char *)storage;
+  int actual_scratch_used = scratch_used;
+
+  const unsigned char *const result = allocate_navigation_scratch(
+      bytes + offset, scratch_capacity, &actual_scratch_used, size, alignment);
+
+  check_int(description, "result offset", expected_result_offset,
+            result == NULL ? -1 : (int)(result - bytes));
+  check_int(description, "scratch used", expected_scratch_used,
+            actual_scratch_used);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  check("empty", 0, 32, 0, 3, 1, 0, 3);
+  check("aligned", 0, 32, 3, 4, 4, 4, 8);
+  check("exact fit", 0, 32, 8, 24, 8, 8, 32);
+  check("zero size", 0, 32, 32, 0, 1, 32, 32);
+  check("too large", 0, 32, 8, 25, 1, -1, 8);
+  check("padding too large", 0, 32, 9, 21, 4, -1, 9);
+  check("misaligned block", 1, 31, 0, 4, 4, 4, 7);
+  check("misaligned block exact fit", 1, 31, 0, 24, 8, 8, 31);
+  check("misaligned block too large", 1, 31, 0, 25, 8, -1, 0);
+
+  {
+    unsigned char *const bytes = (unsigned char *)storage;
+    int scratch_used = 0;
+    allocate_navigation_scratch(bytes, 32, &scratch_used, 3, 1);
+    const int mark = scratch_used;
+    allocate_navigation_scratch(bytes, 32, &scratch_used, 8, 8);
+    scratch_used = mark;
+
+    check_int("reset to mark", "result offset", 4,
+              (int)((unsigned char *)allocate_navigation_scratch(
+                        bytes, 32, &scratch_used, 4, 4) -
+                    bytes));
+    check_int("reset to mark", "scratch used", 8, scratch_used);
+  }
+
+  return exit_code;
+}
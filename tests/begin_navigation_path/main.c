@@ -0,0 +1,67 @@
+#include "../../src/begin_navigation_path.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float start_location[] = {1.0f, 2.0f, 3.0f};
+
+  float face_costs[] = {-1.0f, -1.0f, -1.0f, -1.0f};
+  float face_priorities[] = {-1.0f, -1.0f, -1.0f, -1.0f};
+  float face_entry_locations[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+                                  -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+  int face_parent_indices[] = {-3, -3, -3, -3};
+  int face_parent_link_indices[] = {-3, -3, -3, -3};
+  int face_heap_positions[] = {-3, -3, -3, -3};
+  int heap[] = {-3, -3, -3, -3};
+  int heap_count = -3;
+
+  begin_navigation_path(start_location, 2, 4, face_costs, face_priorities,
+                        face_entry_locations, face_parent_indices,
+                        face_parent_link_indices, face_heap_positions, heap,
+                        &heap_count);
+
+  check_approximate("start face", "cost", 0.0f, face_costs[2]);
+  check_approximate("start face", "priority", 0.0f, face_priorities[2]);
+  check_approximate("start face", "entry location x", 1.0f,
+                    face_entry_locations[6]);
+  check_approximate("start face", "entry location y", 2.0f,
+                    face_entry_locations[7]);
+  check_approximate("start face", "entry location z", 3.0f,
+                    face_entry_locations[8]);
+  check_int("start face", "parent index", -1, face_parent_indices[2]);
+  check_int("start face", "parent link index", -1,
+            face_parent_link_indices[2]);
+  check_int("start face", "heap position", 0, face_heap_positions[2]);
+  check_int("other face", "heap position", -1, face_heap_positions[0]);
+  check_int("other face", "heap position", -1, face_heap_positions[1]);
+  check_int("other face", "heap position", -1, face_heap_positions[3]);
+  check_int("heap", "face index", 2, heap[0]);
+  check_int("heap", "count", 1, heap_count);
+
+  return exit_code;
+}
@@ -0,0 +1,295 @@
+#include "../../src/build_navigation_tile.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float geometry[] = {
+    0.0f, 0.0f, 0.0f,  2.0f, 0.0f, 0.0f,  2.0f, 2.0f, 0.0f,
+    0.0f, 0.0f, 0.0f,  2.0f, 2.0f, 0.0f,  0.0f, 2.0f, 0.0f,
+    1.0f, 1.0f, 1.0f,  2.0f, 1.0f, 1.0f,  2.0f, 2.0f, 1.0f,
+    1.0f, 1.0f, 1.0f,  2.0f, 2.0f, 1.0f,  1.0f, 2.0f, 1.0f,
+    0.0f, 0.0f, 4.0f,  2.0f, 0.0f, 6.0f,  2.0f, 2.0f, 6.0f,
+    0.0f, 0.0f, 0.0f,  4.0f, 0.0f, 0.0f,  4.0f, 4.0f, 0.0f,
+    0.0f, 0.0f, 0.0f,  4.0f, 4.0f, 0.0f,  0.0f, 4.0f, 0.0f,
+    2.5f, 0.0f, 0.0f,  2.5f, 4.0f, 0.0f,  2.5f, 4.0f, 2.0f,
+    2.5f, 0.0f, 0.0f,  2.5f, 4.0f, 2.0f,  2.5f, 0.0f, 2.0f,
+    0.0f, 0.0f, 0.0f,  1.0f, 0.0f, 0.0f,  1.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f,  1.0f, 1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.5f,  2.0f, 0.0f, 0.5f,  2.0f, 1.0f, 0.5f,
+    1.0f, 0.0f, 0.5f,  2.0f, 1.0f, 0.5f,  1.0f, 1.0f, 0.5f,
+    0.0f, 0.0f, 2.25f, 1.0f, 1.0f, 2.25f, 1.0f, 0.0f, 2.25f,
+    0.0f, 0.0f, 2.25f, 0.0f, 1.0f, 2.25f, 1.0f, 1.0f, 2.25f,
+};
+
+static const float tile_origin[] = {0.0f, 0.0f, 0.0f};
+
+static int column_first_spans[16];
+static int span_next_indices[32];
+static int span_bottoms[32];
+static int span_tops[32];
+static int span_walkable[32];
+static int span_face_indices[32];
+static int cell_face_vertex_counts[16];
+static int cell_face_vertex_offsets[16];
+static float cell_face_vertex_locations[192];
+static float cell_face_normals[48];
+static int cell_face_edge_neighbor_counts[64];
+static int cell_face_edge_neighbor_offsets[64];
+static int cell_face_edge_neighbor_face_indices[64];
+static int face_groups[16];
+static int face_next_members[16];
+static int group_vertex_counts[16];
+static float group_vertex_locations[432];
+static int cell_face_merged_face_indices[16];
+static int face_vertex_counts[16];
+static int face_vertex_offsets[16];
+static float face_vertex_locations[192];
+static float face_normals[48];
+static float edge_normals[192];
+static float edge_exit_normals[192];
+static float edge_coefficients[192];
+static float vertex_up_normals[192];
+static int face_edge_neighbor_counts[64];
+static int face_edge_neighbor_offsets[64];
+static int face_edge_neighbor_face_indices[64];
+
+static int build(const int first_triangle, const int triangle_count,
+                 const int column_count_x, const int column_count_y,
+                 const float walkable_slope_cosine,
+                 const int maximum_span_count,
+                 const int maximum_cell_face_count,
+                 const int maximum_cell_neighbor_count,
+                 int *const cell_face_count, int *const cell_neighbor_count) {
+  return build_navigation_tile(
+      triangle_count, geometry + first_triangle * 9, tile_origin,
+      column_count_x, column_count_y, 1.0f, 0.25f, walkable_slope_cosine,
+      0.5f, 2.0f, 8, column_first_spans, maximum_span_count,
+      span_next_indices, span_bottoms, span_tops, span_walkable,
+      span_face_indices, maximum_cell_face_count, maximum_cell_neighbor_count,
+      cell_face_vertex_counts, cell_face_vertex_offsets,
+      cell_face_vertex_locations, cell_face_normals,
+      cell_face_edge_neighbor_counts, cell_face_edge_neighbor_offsets,
+      cell_face_edge_neighbor_face_indices, face_groups, face_next_members,
+      group_vertex_counts, group_vertex_locations,
+      cell_face_merged_face_indices, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_normals, edge_exit_normals,
+      edge_coefficients, vertex_up_normals, face_edge_neighbor_counts,
+      face_edge_neighbor_offsets, face_edge_neighbor_face_indices,
+      cell_face_count, cell_neighbor_count);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  {
+    const float expected_face_vertex_locations[] = {
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f,
+        1.0f, 1.0f, 1.0f, 2.0f, 1.0f, 1.0f, 2.0f, 2.0f, 1.0f, 1.0f, 2.0f, 1.0f,
+    };
+    const float expected_edge_normals[] = {
+        -1.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f,
+        1.0f,  0.0f, 0.0f, 0.0f, 1.0f,  0.0f,
+        0.0f,  -1.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+        0.0f,  -1.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    };
+    const int expected_cell_face_merged_face_indices[] = {0, 0, 1, 2};
+    const int expected_face_edge_neighbor_counts[] = {
+        0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    };
+    const int expected_face_edge_neighbor_offsets[] = {
+        0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2,
+    };
+    const int expected_face_edge_neighbor_face_indices[] = {1, 0};
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+
+    check_int("clearance and steps", "face count", 3,
+              build(0, 4, 2, 2, 0.707f, 8, 4, 4, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("clearance and steps", "cell face count", 4, cell_face_count);
+    check_int("clearance and steps", "cell neighbor count", 4,
+              cell_neighbor_count);
+
+    for (int cell_face_index = 0; cell_face_index < 4; cell_face_index++) {
+      check_int("clearance and steps", "cell face merged face index",
+                expected_cell_face_merged_face_indices[cell_face_index],
+                cell_face_merged_face_indices[cell_face_index]);
+    }
+
+    for (int face_index = 0; face_index < 3; face_index++) {
+      check_int("clearance and steps", "face vertex count", 4,
+                face_vertex_counts[face_index]);
+      check_int("clearance and steps", "face vertex offset", face_index * 4,
+                face_vertex_offsets[face_index]);
+      check_approximate("clearance and steps", "face normal x", 0.0f,
+                        face_normals[face_index * 3]);
+      check_approximate("clearance and steps", "face normal y", 0.0f,
+                        face_normals[face_index * 3 + 1]);
+      check_approximate("clearance and steps", "face normal z", 1.0f,
+                        face_normals[face_index * 3 + 2]);
+    }
+
+    for (int component = 0; component < 36; component++) {
+      check_approximate("clearance and steps", "face vertex location",
+                        expected_face_vertex_locations[component],
+                        face_vertex_locations[component]);
+      check_approximate("clearance and steps", "edge normal",
+                        expected_edge_normals[component],
+                        edge_normals[component]);
+      check_approximate("clearance and steps", "edge exit normal",
+                        expected_edge_normals[component],
+                        edge_exit_normals[component]);
+      check_approximate("clearance and steps", "vertex up normal",
+                        component % 3 == 2 ? 1.0f : 0.0f,
+                        vertex_up_normals[component]);
+    }
+
+    for (int edge_index = 0; edge_index < 12; edge_index++) {
+      check_int("clearance and steps", "face edge neighbor count",
+                expected_face_edge_neighbor_counts[edge_index],
+                face_edge_neighbor_counts[edge_index]);
+      check_int("clearance and steps", "face edge neighbor offset",
+                expected_face_edge_neighbor_offsets[edge_index],
+                face_edge_neighbor_offsets[edge_index]);
+    }
+
+    for (int neighbor = 0; neighbor < 2; neighbor++) {
+      check_int("clearance and steps", "face edge neighbor face index",
+                expected_face_edge_neighbor_face_indices[neighbor],
+                face_edge_neighbor_face_indices[neighbor]);
+    }
+
+    check_approximate("clearance and steps", "edge coefficient x", 0.0f,
+                      edge_coefficients[0]);
+    check_approximate("clearance and steps", "edge coefficient y", -1.0f,
+                      edge_coefficients[1]);
+    check_approximate("clearance and steps", "edge coefficient z", 0.0f,
+                      edge_coefficients[2]);
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("gentle slope", "face count", 2,
+              build(4, 1, 2, 2, 0.5f, 8, 4, 4, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("gentle slope", "cell face count", 3, cell_face_count);
+    check_int("gentle slope", "cell neighbor count", 2, cell_neighbor_count);
+    check_approximate("gentle slope", "face vertex location z", 5.0f,
+                      face_vertex_locations[2]);
+    check_int("gentle slope", "face vertex count", 4, face_vertex_counts[1]);
+    check_approximate("gentle slope", "face vertex location z", 6.0f,
+                      face_vertex_locations[14]);
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("steep slope", "face count", 0,
+              build(4, 1, 2, 2, 0.8f, 8, 4, 4, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("steep slope", "cell face count", 0, cell_face_count);
+    check_int("steep slope", "cell neighbor count", 0, cell_neighbor_count);
+  }
+
+  {
+    const int expected_face_vertex_counts[] = {4, 4};
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+
+    check_int("wall", "face count", 2,
+              build(5, 4, 4, 4, 0.707f, 32, 16, 64, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("wall", "cell face count", 12, cell_face_count);
+    check_int("wall", "cell neighbor count", 26, cell_neighbor_count);
+
+    for (int face_index = 0; face_index < 2; face_index++) {
+      check_int("wall", "face vertex count",
+                expected_face_vertex_counts[face_index],
+                face_vertex_counts[face_index]);
+    }
+
+    for (int edge_index = 0; edge_index < 8; edge_index++) {
+      check_int("wall", "face edge neighbor count", 0,
+                face_edge_neighbor_counts[edge_index]);
+    }
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("step", "face count", 2,
+              build(9, 4, 2, 1, 0.707f, 8, 4, 4, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("step", "cell neighbor count", 2, cell_neighbor_count);
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("low ceiling across step", "face count", 2,
+              build(9, 6, 2, 1, 0.707f, 8, 4, 4, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("low ceiling across step", "cell face count", 2,
+              cell_face_count);
+    check_int("low ceiling across step", "cell neighbor count", 0,
+              cell_neighbor_count);
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("too many faces", "face count", -1,
+              build(0, 4, 2, 2, 0.707f, 8, 3, 4, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("too many faces", "cell face count", 4, cell_face_count);
+    check_int("too many faces", "cell neighbor count", 4,
+              cell_neighbor_count);
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("too many neighbors", "face count", -1,
+              build(0, 4, 2, 2, 0.707f, 8, 4, 3, &cell_face_count,
+                    &cell_neighbor_count));
+    check_int("too many neighbors", "cell face count", 4, cell_face_count);
+    check_int("too many neighbors", "cell neighbor count", 4,
+              cell_neighbor_count);
+  }
+
+  {
+    int cell_face_count = -1;
+    int cell_neighbor_count = -1;
+    check_int("too many spans", "face count", -1,
+              build(0, 4, 2, 2, 0.707f, 4, 4, 4, &cell_face_count,
+                    &cell_neighbor_count));
+  }
+
+  return exit_code;
+}
@@ -1,4 +1,5 @@
 #include "../../src/closest_navigable_face.h"
+#include <stddef.h>
 #include <stdio.h>
 
 static int exit_code = 0;
@@ -97,14 +98,19 @@ static const float edge_coefficients[] = {
     0.790533185005188f,     -0.2827807664871216f,   -0.17646372318267822f,
 };
 
-static void scenario(const char *const description, const float location_x,
-                     const float location_y, const float location_z,
-                     const int face_index) {
+static const int face_flags[] = {1, 1, 2, 1};
+
+static void filtered_scenario(const char *const description,
+                              const float location_x, const float location_y,
+                              const float location_z, const int *const flags,
+                              const int include_flags, const int exclude_flags,
+                              const int face_index) {
   const float location[] = {location_x, location_y, location_z};
 
   const int actual_face_index = closest_navigable_face(
       location, 4, face_vertex_counts, face_vertex_offsets,
-      face_vertex_locations, face_normals, edge_normals, edge_coefficients);
+      face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+      flags, include_flags, exclude_flags);
 
   check_exact(description, "location x", location_x, location[0]);
   check_exact(description, "location y", location_y, location[1]);
@@ -113,6 +119,13 @@ static void scenario(const char *const description, const float location_x,
   check_int(description, "face index", face_index, actual_face_index);
 }
 
+static void scenario(const char *const description, const float location_x,
+                     const float location_y, const float location_z,
+                     const int face_index) {
+  filtered_scenario(description, location_x, location_y, location_z, NULL, 0,
+                    0, face_index);
+}
+
 int main(const int argc, const char *const *const argv) {
   (void)(argc);
   (void)(argv);
@@ -159,5 +172,18 @@ int main(const int argc, const char *const *const argv) {
   scenario("above d", 1.5372536182403564f, 0.4288828372955322f,
            1.9565962553024292f, 2);
 
+  filtered_scenario("included", 1.5372536182403564f, 0.4288828372955322f,
+                    1.9565962553024292f, face_flags, 3, 0, 2);
+
+  filtered_scenario("not included", 1.5372536182403564f, 0.4288828372955322f,
+                    1.9565962553024292f, face_flags, 1, 0, 3);
+
+  filtered_scenario("excluded", 1.5372536182403564f, 0.4288828372955322f,
+                    1.9565962553024292f, face_flags, 3, 2, 3);
+
+  filtered_scenario("nothing included", 1.5372536182403564f,
+                    0.4288828372955322f, 1.9565962553024292f, face_flags, 4,
+                    0, -1);
+
   return exit_code;
 }
@@ -0,0 +1,134 @@
+#include "../../src/closest_navigable_face.h"
+#include "../../src/closest_navigable_face_in_buckets.h"
+#include "../../src/navigable_face_vertex_count_buckets.h"
+#include "../../src/reorder_navigable_faces.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  int bucket_vertex_counts[2];
+  int bucket_face_offsets[2];
+  int bucket_face_counts[2];
+  int bucket_vertex_offsets[2];
+  int face_order[4];
+
+  const int bucket_count = navigable_face_vertex_count_buckets(
+      4, face_vertex_counts, 2, bucket_vertex_counts, bucket_face_offsets,
+      bucket_face_counts, bucket_vertex_offsets, face_order);
+
+  int bucketed_face_vertex_counts[4];
+  int bucketed_face_vertex_offsets[4];
+  float bucketed_face_vertex_locations[45];
+  float bucketed_face_normals[12];
+  float bucketed_edge_normals[45];
+  float bucketed_edge_coefficients[45];
+  int bucketed_face_indices[4];
+
+  reorder_navigable_faces(
+      4, face_order, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_normals, NULL,
+      edge_coefficients, NULL, NULL, NULL, NULL, bucketed_face_vertex_counts,
+      bucketed_face_vertex_offsets, bucketed_face_vertex_locations,
+      bucketed_face_normals, bucketed_edge_normals, NULL,
+      bucketed_edge_coefficients, NULL, NULL, NULL, NULL,
+      bucketed_face_indices);
+
+  const float locations[] = {
+      0.5f, 0.5f,  0.4f, 0.5f, 0.5f,  1.7f, 1.5f, 0.5f,  0.4f,  0.2f, 1.8f,
+      0.3f, 3.0f,  3.0f, 1.0f, -2.0f, 0.5f, 0.7f, 10.0f, 10.0f, 0.0f, 1.2f,
+      1.3f, -0.5f, 0.5f, 0.5f, 1.0f,  0.7f, 0.7f, -3.0f,
+  };
+
+  const int face_flags[] = {1, 2, 1, 1};
+  const int include_flags[] = {0, 1, 3, 2};
+  const int exclude_flags[] = {0, 0, 1, 0};
+  int bucketed_face_flags[4];
+
+  for (int face_index = 0; face_index < 4; face_index++) {
+    bucketed_face_flags[face_index] = face_flags[face_order[face_index]];
+  }
+
+  for (int filter = 0; filter < 4; filter++) {
+    const int *const flags = filter == 0 ? NULL : bucketed_face_flags;
+
+    for (int index = 0; index < 10; index++) {
+      check_int("location", "face index",
+                closest_navigable_face(
+                    locations + index * 3, 4, bucketed_face_vertex_counts,
+                    bucketed_face_vertex_offsets,
+                    bucketed_face_vertex_locations, bucketed_face_normals,
+                    bucketed_edge_normals, bucketed_edge_coefficients, flags,
+                    include_flags[filter], exclude_flags[filter]),
+                closest_navigable_face_in_buckets(
+                    locations + index * 3, bucket_count, bucket_vertex_counts,
+                    bucket_face_offsets, bucket_face_counts,
+                    bucket_vertex_offsets, bucketed_face_vertex_locations,
+                    bucketed_face_normals, bucketed_edge_normals,
+                    bucketed_edge_coefficients, flags, include_flags[filter],
+                    exclude_flags[filter]));
+    }
+  }
+
+  check_int("original face", "face index", 2,
+            face_order[closest_navigable_face_in_buckets(
+                locations + 9, bucket_count, bucket_vertex_counts,
+                bucket_face_offsets, bucket_face_counts, bucket_vertex_offsets,
+                bucketed_face_vertex_locations, bucketed_face_normals,
+                bucketed_edge_normals, bucketed_edge_coefficients, NULL, 0,
+                0)]);
+
+  check_int("no buckets", "face index", -1,
+            closest_navigable_face_in_buckets(
+                locations, 0, bucket_vertex_counts, bucket_face_offsets,
+                bucket_face_counts, bucket_vertex_offsets,
+                bucketed_face_vertex_locations, bucketed_face_normals,
+                bucketed_edge_normals, bucketed_edge_coefficients, NULL, 0,
+                0));
+
+  return exit_code;
+}
@@ -0,0 +1,97 @@
+#include "../../src/closest_navigable_face.h"
+#include "../../src/closest_navigable_face_in_grid.h"
+#include "../../src/navigable_face_grid.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  int bucket_face_offsets[17];
+  int bucket_face_indices[16];
+
+  navigable_face_grid(4, face_vertex_counts, face_vertex_offsets,
+                      face_vertex_locations, 1.0f, 16, 16, bucket_face_offsets,
+                      bucket_face_indices);
+
+  const float locations[] = {
+      0.5f, 0.5f,  0.4f, 0.5f, 0.5f,  1.7f, 1.5f, 0.5f,  0.4f,  0.2f, 1.8f,
+      0.3f, 3.0f,  3.0f, 1.0f, -2.0f, 0.5f, 0.7f, 10.0f, 10.0f, 0.0f, 1.2f,
+      1.3f, -0.5f,
+  };
+
+  const int face_flags[] = {1, 2, 1, 1};
+  const int include_flags[] = {0, 1, 3, 2};
+  const int exclude_flags[] = {0, 0, 1, 0};
+
+  for (int filter = 0; filter < 4; filter++) {
+    const int *const flags = filter == 0 ? NULL : face_flags;
+
+    for (int index = 0; index < 8; index++) {
+      check_int("unbounded", "face index",
+                closest_navigable_face(
+                    locations + index * 3, 4, face_vertex_counts,
+                    face_vertex_offsets, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, flags,
+                    include_flags[filter], exclude_flags[filter]),
+                closest_navigable_face_in_grid(
+                    locations + index * 3, 1.0f, 16, bucket_face_offsets,
+                    bucket_face_indices, 16, face_vertex_counts,
+                    face_vertex_offsets, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, flags,
+                    include_flags[filter], exclude_flags[filter]));
+    }
+  }
+
+  check_int("bounded", "face index", -1,
+            closest_navigable_face_in_grid(
+                locations + 18, 1.0f, 16, bucket_face_offsets,
+                bucket_face_indices, 0, face_vertex_counts,
+                face_vertex_offsets, face_vertex_locations, face_normals,
+                edge_normals, edge_coefficients, NULL, 0, 0));
+
+  return exit_code;
+}
@@ -0,0 +1,267 @@
+#include "../../src/closest_navigable_face.h"
+#include "../../src/closest_navigable_point_in_volume.h"
+#include "../../src/constrain_to_navigable_volume.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {3, 5, 4, 6};
+
+static const int face_vertex_offsets[] = {0, 3, 8, 12};
+
+static const float face_normals[] = {
+    0.07895775884389877f,  0.49244746565818787f, 0.8667532205581665f,
+    -0.7232892513275146f,  0.2542363703250885f,  0.642041027545929f,
+    0.09298569709062576f,  0.7767484784126282f,  0.6229087114334106f,
+    -0.12398175895214081f, -0.7511836290359497f, 0.6483453512191772f,
+};
+
+static const float face_vertex_locations[] = {
+    -3.4020490646362305f, 2.8101935386657715f,  -0.29557961225509644f,
+    -4.021132946014404f,  0.4352002739906311f,  1.110173225402832f,
+    -5.086987018585205f,  1.94649076461792f,    0.3486257791519165f,
+    -1.8411436080932617f, -2.8504514694213867f, 0.7629717588424683f,
+    -1.3159351348876953f, -1.4987578392028809f, 0.8193982839584351f,
+    -0.7699069976806641f, -1.1729934215545654f, 1.3055280447006226f,
+    -0.3965773284435272f, -3.695011615753174f,  2.724773406982422f,
+    -1.7895712852478027f, -3.858870029449463f,  1.2203859090805054f,
+    -0.4381864070892334f, 0.2253333330154419f,  2.216573715209961f,
+    -1.7317837476730347f, 0.9585509300231934f,  1.4953770637512207f,
+    -0.9570263028144836f, 1.5087556838989258f,  0.6936352252960205f,
+    1.082206130027771f,   0.8231964111328125f,  1.2440972328186035f,
+    3.376988410949707f,   3.536540985107422f,   1.8753199577331543f,
+    4.3473639488220215f,  2.9355649948120117f,  1.3645833730697632f,
+    2.634784698486328f,   2.1809427738189697f,  0.16277146339416504f,
+    1.4529716968536377f,  2.790022134780884f,   0.6424660086631775f,
+    1.3432226181030273f,  3.4920597076416016f,  1.4348706007003784f,
+    2.3029632568359375f,  3.920729398727417f,   2.115065097808838f,
+};
+
+static const float edge_exit_normals[] = {
+    0.8445626497268677f,  -0.41813111305236816f, -0.33448511362075806f,
+    -0.7482595443725586f, -0.6309695839881897f,  -0.20490238070487976f,
+    -0.5380623936653137f, 0.6443790197372437f,   -0.5433824062347412f,
+    -0.3881560266017914f, 0.18847911059856415f,  -0.9021145105361938f,
+    0.2913234829902649f,  0.6106106042861938f,   -0.7364001274108887f,
+    0.8732513189315796f,  0.33066919445991516f,  0.35789668560028076f,
+    0.28668972849845886f, -0.9441192150115967f,  -0.16262786090373993f,
+    -0.3236362040042877f, -0.4045316278934479f,  -0.855344295501709f,
+    -0.5978249311447144f, -0.3412596583366394f,  0.7253599762916565f,
+    -0.7264787554740906f, 0.6329079270362854f,   -0.2676868736743927f,
+    0.2879942059516907f,  0.09123139083385468f,  -0.9532766342163086f,
+    0.4545976519584656f,  -0.8736056685447693f,  0.17364968359470367f,
+    0.6291472911834717f,  0.6354882121086121f,   0.44758081436157227f,
+    0.5895053148269653f,  -0.7023043036460876f,  -0.39906418323516846f,
+    -0.5148865580558777f, -0.4032585620880127f,  -0.7564880847930908f,
+    -0.9757379293441772f, -0.21241706609725952f, 0.053051725029945374f,
+    -0.5568119883537292f, 0.7758399844169617f,   0.29670313000679016f,
+    0.36428022384643555f, 0.5488821864128113f,   0.7523483633995056f,
+};
+
+static const float face_vertex_up_normals[] = {
+    0.5268785953521729f,   0.7603095173835754f,   0.3799056112766266f,
+    0.13140948116779327f,  -0.4437146782875061f,  0.8864811658859253f,
+    -0.47765371203422546f, 0.29806387424468994f,  0.8264409899711609f,
+    -0.9215527176856995f,  -0.07014822959899902f, 0.3818637728691101f,
+    -0.552590012550354f,   0.7357838749885559f,   0.3914923071861267f,
+    -0.4708705246448517f,  0.7616084218025208f,   0.4452343285083771f,
+    -0.28619083762168884f, -0.24640211462974548f, 0.9259486198425293f,
+    -0.8208364248275757f,  -0.32960376143455505f, 0.46646422147750854f,
+    0.5812001824378967f,   0.43867745995521545f,  0.6853964924812317f,
+    0.3678427040576935f,   0.6871890425682068f,   0.6264686584472656f,
+    0.5820526480674744f,   0.7737993001937866f,   0.24989865720272064f,
+    0.8223363161087036f,   0.4865569770336151f,   0.2950006127357483f,
+    0.5752538442611694f,   -0.7679309248924255f,  0.2817181348800659f,
+    -0.06279759854078293f, -0.5323859453201294f,  0.8441692590713501f,
+    -0.3859748840332031f,  -0.6788939833641052f,  0.624600887298584f,
+    0.21766631305217743f,  -0.9150291681289673f,  0.339621901512146f,
+    0.11336634308099747f,  -0.2828759253025055f,  0.9524334073066711f,
+    -0.4702640473842621f,  -0.5888811945915222f,  0.6573207974433899f,
+};
+
+static const float edge_normals[] = {
+    0.9725521206855774f,   -0.22895699739456177f, 0.04148668050765991f,
+    -0.8424692153930664f,  -0.43185123801231384f, 0.32210269570350647f,
+    -0.5329273343086243f,  0.7556453347206116f,   -0.38077372312545776f,
+    -0.5881147980690002f,  0.2604789733886719f,   -0.7656837701797485f,
+    -0.10690337419509888f, 0.8773258328437805f,   -0.46783649921417236f,
+    0.6785890460014343f,   0.43394654989242554f,  0.5926274657249451f,
+    -0.13480409979820251f, -0.9638553857803345f,  0.22980590164661407f,
+    -0.6889761686325073f,  -0.3283272981643677f,  -0.6461523771286011f,
+    -0.6153386831283569f,  -0.44700878858566284f, 0.6492623090744019f,
+    -0.7765533328056335f,  0.44812941551208496f,  -0.4428826570510864f,
+    0.3848402798175812f,   0.5489599704742432f,   -0.7419843673706055f,
+    0.593180775642395f,    -0.5456900596618652f,  0.5919111967086792f,
+    0.6184095144271851f,   0.4524862766265869f,   0.642515242099762f,
+    0.6258806586265564f,   -0.5662204027175903f,  -0.5363466739654541f,
+    -0.5343284010887146f,  -0.5000267624855042f,  -0.6815176010131836f,
+    -0.986912190914154f,   0.02545109950006008f,  -0.15923726558685303f,
+    -0.6300894021987915f,  0.5643534660339355f,   0.5333784818649292f,
+    0.3682067394256592f,   0.5719105005264282f,   0.7330362200737f,
+};
+
+static const float edge_coefficients[] = {
+    -0.07738548517227173f,  -0.29687416553497314f,  0.17571909725666046f,
+    -0.26646363735198975f,  0.3778228163719177f,    -0.19038695096969604f,
+    0.4212346076965332f,    0.21592575311660767f,   -0.16105137765407562f,
+    0.24937447905540466f,   0.6417982578277588f,    0.026791905984282494f,
+    0.8523813486099243f,    0.5085370540618896f,    0.7588765621185303f,
+    0.04384785145521164f,   -0.29621291160583496f,  0.16669143736362457f,
+    -0.3292769193649292f,   -0.038732971996068954f, -0.3556082248687744f,
+    -0.041969820857048035f, 0.8206561803817749f,    -0.3722459673881531f,
+    -0.47364968061447144f,  0.2684670388698578f,    -0.26406559348106384f,
+    0.5012131929397583f,    0.355943500995636f,     -0.5186702013015747f,
+    0.4135141670703888f,    -0.1390172392129898f,   0.11162230372428894f,
+    -0.42060860991477966f,  -0.16539567708969116f,  0.26903051137924194f,
+    0.6205825805664062f,    -0.3843410909175873f,   -0.32663047313690186f,
+    -0.34620407223701477f,  -0.1525495946407318f,   -0.24295058846473694f,
+    -0.5915671586990356f,   0.30488017201423645f,   0.24011541903018951f,
+    -0.09688244014978409f,  0.6197329163551331f,    0.6995055675506592f,
+    0.6122652888298035f,    0.2734692692756653f,    0.4339292049407959f,
+    0.790533185005188f,     -0.2827807664871216f,   -0.17646372318267822f,
+};
+
+static void bounded_scenario(const char *const description,
+                             const float location_x, const float location_y,
+                             const float location_z,
+                             const float maximum_distance,
+                             const int face_index) {
+  const float location[] = {location_x, location_y, location_z};
+  float result_location[] = {-7.0f, -8.0f, -9.0f};
+
+  const int actual_face_index = closest_navigable_point_in_volume(
+      location, maximum_distance, 4, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals, edge_normals,
+      edge_coefficients, face_vertex_up_normals, NULL, 0, 0, result_location);
+
+  check_exact(description, "location x", location_x, location[0]);
+  check_exact(description, "location y", location_y, location[1]);
+  check_exact(description, "location z", location_z, location[2]);
+  check_int(description, "face index", face_index, actual_face_index);
+
+  if (face_index == -1) {
+    check_exact(description, "result location x", -7.0f, result_location[0]);
+    check_exact(description, "result location y", -8.0f, result_location[1]);
+    check_exact(description, "result location z", -9.0f, result_location[2]);
+    return;
+  }
+
+  float expected_location[3];
+
+  constrain_to_navigable_volume(
+      location, face_vertex_counts, face_vertex_offsets, face_vertex_locations,
+      face_normals, edge_exit_normals, edge_normals, edge_coefficients,
+      face_vertex_up_normals, face_index, expected_location);
+
+  check_exact(description, "result location x", expected_location[0],
+              result_location[0]);
+  check_exact(description, "result location y", expected_location[1],
+              result_location[1]);
+  check_exact(description, "result location z", expected_location[2],
+              result_location[2]);
+
+  float same[] = {location_x, location_y, location_z};
+
+  check_int(description, "same face index", face_index,
+            closest_navigable_point_in_volume(
+                same, maximum_distance, 4, face_vertex_counts,
+                face_vertex_offsets, face_vertex_locations, face_normals,
+                edge_exit_normals, edge_normals, edge_coefficients,
+                face_vertex_up_normals, NULL, 0, 0, same));
+
+  check_exact(description, "same x", expected_location[0], same[0]);
+  check_exact(description, "same y", expected_location[1], same[1]);
+  check_exact(description, "same z", expected_location[2], same[2]);
+}
+
+static void scenario(const char *const description, const float location_x,
+                     const float location_y, const float location_z) {
+  const float location[] = {location_x, location_y, location_z};
+
+  bounded_scenario(description, location_x, location_y, location_z,
+                   1.0f / 0.0f,
+                   closest_navigable_face(location, 4, face_vertex_counts,
+                                          face_vertex_offsets,
+                                          face_vertex_locations, face_normals,
+                                          edge_normals, edge_coefficients,
+                                          NULL, 0, 0));
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  scenario("under ad", -0.44776129722595215f, -0.4037471413612366f,
+           2.3634936809539795f);
+
+  scenario("above ad", -0.32799556851387024f, 0.11648856848478317f,
+           2.879356622695923f);
+
+  scenario("under bc", -2.1550962924957275f, 0.7870222926139832f,
+           1.5255401134490967f);
+
+  scenario("above bc", -2.1393260955810547f, 1.4126778841018677f,
+           2.172755002975464f);
+
+  scenario("under cd", 1.5398374795913696f, 0.3737923502922058f,
+           1.0536272525787354f);
+
+  scenario("above cd", 2.1589162349700928f, 1.1578724384307861f,
+           1.2380948066711426f);
+
+  scenario("under surface", -0.48655855655670166f, 0.0667107105255127f,
+           1.4121458530426025f);
+
+  scenario("above surface", -0.3538905084133148f, 1.1749427318572998f,
+           2.3008854389190674f);
+
+  scenario("under a", -1.4930438995361328f, -0.12190787494182587f,
+           1.7247934341430664f);
+
+  scenario("above a", -1.2354415655136108f, 1.1127464771270752f,
+           2.517969846725464f);
+
+  scenario("under b", -1.6809687614440918f, 1.383725881576538f,
+           0.20064657926559448f);
+
+  scenario("above b", -1.3303054571151733f, 2.152769088745117f,
+           1.0672723054885864f);
+
+  scenario("under d", 1.015620231628418f, -0.06502214074134827f,
+           0.8374176621437073f);
+
+  scenario("above d", 1.5372536182403564f, 0.4288828372955322f,
+           1.9565962553024292f);
+
+  scenario("extra scenario a", -1.82926344871521f, 1.0062448978424072f,
+           1.489659309387207f);
+
+  scenario("extra scenario b", -0.7469232082366943f, 0.08018803596496582f,
+           2.47623872756958f);
+
+  bounded_scenario("outside bound", -0.3538905084133148f, 1.1749427318572998f,
+                   2.3008854389190674f, 0.001f, -1);
+
+  return exit_code;
+}
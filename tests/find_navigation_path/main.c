@@ -0,0 +1,181 @@
+#include "../../src/find_navigation_path.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int link_end_face_indices[] = {3, 3, 3, 2};
+
+static const float link_start_locations[] = {
+    0.2f, 1.5f, 0.0f, 1.5f, 0.5f, 0.0f, 1.5f, 0.5f, 0.0f, 0.5f, 0.5f, 2.0f,
+};
+
+static const float link_end_locations[] = {
+    0.2f, 0.8f, 2.0f, 0.9f, 0.5f, 2.0f, 0.5f, 0.5f, 2.0f, 0.2f, 1.2f, 0.0f,
+};
+
+static const float link_costs[] = {1.0f, 5.0f, 0.0f, 0.0f};
+
+static const int link_flags[] = {1, 2, 1, 1};
+
+static const int face_link_offsets[] = {0, 0, 1, 2, 2};
+
+static const int shortcut_face_link_offsets[] = {2, 2, 3, 3, 4};
+
+static const int face_link_indices[] = {1, 0, 2, 3};
+
+static const int face_flags[] = {1, 1, 4, 1};
+
+static const float face_cost_multipliers[] = {10.0f, 1.0f, 1.0f, 1.0f};
+
+static void check(const char *const description,
+                  const float *const start_location, const int start_face_index,
+                  const float *const goal_location, const int goal_face_index,
+                  const int *const flags, const float *const cost_multipliers,
+                  const int *const offsets, const int include_flags,
+                  const int exclude_flags, const int maximum_path_length,
+                  const int expected_result,
+                  const int *const expected_face_indices,
+                  const int *const expected_link_indices) {
+  float face_costs[4];
+  float face_priorities[4];
+  float face_entry_locations[12];
+  int face_parent_indices[4];
+  int face_parent_link_indices[4];
+  int face_heap_positions[4];
+  int heap[4];
+  int result_face_indices[] = {-1, -1, -1, -1, -1};
+  int result_link_indices[] = {-1, -1, -1, -1, -1};
+
+  check_int(description, "result", expected_result,
+            find_navigation_path(
+                start_location, start_face_index, goal_location,
+                goal_face_index, 4, face_vertex_counts, face_vertex_offsets,
+                face_vertex_locations, face_edge_neighbor_counts,
+                face_edge_neighbor_offsets, face_edge_neighbor_face_indices,
+                flags, cost_multipliers, offsets, face_link_indices,
+                link_end_face_indices, link_start_locations,
+                link_end_locations, link_costs, link_flags, include_flags,
+                exclude_flags, face_costs, face_priorities,
+                face_entry_locations, face_parent_indices,
+                face_parent_link_indices, face_heap_positions, heap,
+                maximum_path_length, result_face_indices,
+                result_link_indices));
+
+  for (int index = 0; index < 5; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int(description, "link index", expected_link_indices[index],
+              result_link_indices[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float ground_start[] = {1.5f, 0.5f, 0.0f};
+  const float ground_goal[] = {0.5f, 0.5f, 0.0f};
+  const float upper_goal[] = {0.5f, 0.5f, 2.0f};
+  const float triangle_goal[] = {0.2f, 1.2f, 0.0f};
+  const int none[] = {-1, -1, -1, -1, -1};
+
+  {
+    const int expected_face_indices[] = {1, 0, 2, 3, -1};
+    const int expected_link_indices[] = {-1, -1, -1, 0, -1};
+    check("cheapest link", ground_start, 1, upper_goal, 3, NULL, NULL,
+          face_link_offsets, 3, 0, 5, 4, expected_face_indices,
+          expected_link_indices);
+  }
+
+  {
+    const int expected_face_indices[] = {1, 3, -1, -1, -1};
+    const int expected_link_indices[] = {-1, 1, -1, -1, -1};
+    check("excluded link", ground_start, 1, upper_goal, 3, NULL, NULL,
+          face_link_offsets, 3, 1, 5, 2, expected_face_indices,
+          expected_link_indices);
+
+    check("excluded face", ground_start, 1, upper_goal, 3, face_flags, NULL,
+          face_link_offsets, 3, 4, 5, 2, expected_face_indices,
+          expected_link_indices);
+
+    check("expensive face", ground_start, 1, upper_goal, 3, NULL,
+          face_cost_multipliers, face_link_offsets, 3, 0, 5, 2,
+          expected_face_indices, expected_link_indices);
+  }
+
+  {
+    const int expected_face_indices[] = {1, 3, 2, -1, -1};
+    const int expected_link_indices[] = {-1, 2, 3, -1, -1};
+    check("shortcut away from goal", ground_start, 1, triangle_goal, 2, NULL,
+          NULL, shortcut_face_link_offsets, 1, 0, 5, 3, expected_face_indices,
+          expected_link_indices);
+  }
+
+  check("no included links", ground_start, 1, upper_goal, 3, NULL, NULL,
+        face_link_offsets, 0, 0, 5, -1, none, none);
+
+  check("links ignored", ground_start, 1, upper_goal, 3, NULL, NULL, NULL, 3,
+        0, 5, -1, none, none);
+
+  check("too long", ground_start, 1, upper_goal, 3, NULL, NULL,
+        face_link_offsets, 3, 0, 3, 4, none, none);
+
+  {
+    const int expected_face_indices[] = {1, 0, -1, -1, -1};
+    check("neighbor", ground_start, 1, ground_goal, 0, NULL, NULL, NULL, 0, 0,
+          5, 2, expected_face_indices, none);
+  }
+
+  {
+    const int expected_face_indices[] = {2, 0, -1, -1, -1};
+    check("start face excluded", triangle_goal, 2, ground_goal, 0, face_flags,
+          NULL, NULL, 1, 4, 5, 2, expected_face_indices, none);
+  }
+
+  check("goal face excluded", ground_start, 1, triangle_goal, 2, face_flags,
+        NULL, NULL, 1, 4, 5, -1, none, none);
+
+  {
+    const int expected_face_indices[] = {1, 0, 2, -1, -1};
+    check("two edges", ground_start, 1, triangle_goal, 2, NULL, NULL, NULL, 0,
+          0, 5, 3, expected_face_indices, none);
+  }
+
+  {
+    const int expected_face_indices[] = {2, -1, -1, -1, -1};
+    check("same face", triangle_goal, 2, triangle_goal, 2, NULL, NULL, NULL,
+          0, 0, 5, 1, expected_face_indices, none);
+  }
+
+  return exit_code;
+}
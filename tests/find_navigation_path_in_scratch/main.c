@@ -0,0 +1,86 @@
+#include "../../src/find_navigation_path_in_scratch.h"
+#include "../../src/find_navigation_path_scratch_size.h"
+#include "../../src/navigation_scratch.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static double storage[32];
+
+static void check(const char *const description, const int offset,
+                  const int scratch_capacity, const int expected_result,
+                  const int *const expected_face_indices) {
+  const float start_location[] = {1.5f, 0.5f, 0.0f};
+  const float goal_location[] = {0.2f, 1.2f, 0.0f};
+  int scratch_used = 2;
+  int result_face_indices[] = {-1, -1, -1, -1};
+  int result_link_indices[] = {-2, -2, -2, -2};
+
+  check_int(description, "result", expected_result,
+            find_navigation_path_in_scratch(
+                start_location, 1, goal_location, 2, 4, face_vertex_counts,
+                face_vertex_offsets, face_vertex_locations,
+                face_edge_neighbor_counts, face_edge_neighbor_offsets,
+                face_edge_neighbor_face_indices, NULL, NULL, NULL, NULL, NULL,
+                NULL, NULL, NULL, NULL, 1, 0,
+                (unsigned char *)storage + offset, scratch_capacity,
+                &scratch_used, 4, result_face_indices, result_link_indices));
+
+  check_int(description, "scratch used", 2, scratch_used);
+
+  for (int index = 0; index < 4; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int(description, "link index",
+              expected_face_indices[index] == -1 ? -2 : -1,
+              result_link_indices[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int expected_face_indices[] = {1, 0, 2, -1};
+  const int none[] = {-1, -1, -1, -1};
+
+  for (int offset = 0; offset < 4; offset++) {
+    check("required size", offset,
+          find_navigation_path_scratch_size(4) + 2, 3,
+          expected_face_indices);
+  }
+
+  check("exhausted", 0, 100, NAVIGATION_SCRATCH_EXHAUSTED, none);
+
+  return exit_code;
+}
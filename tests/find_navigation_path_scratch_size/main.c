@@ -0,0 +1,24 @@
+#include "../../src/find_navigation_path_scratch_size.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  check_int("no faces", "size", 21, find_navigation_path_scratch_size(0));
+  check_int("four faces", "size", 165, find_navigation_path_scratch_size(4));
+
+  return exit_code;
+}
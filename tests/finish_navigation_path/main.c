@@ -0,0 +1,70 @@
+#include "../../src/finish_navigation_path.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_parent_indices[] = {3, -1, 4, 1, 3};
+
+static const int face_parent_link_indices[] = {-1, -1, 7, 5, -1};
+
+static void check(const char *const description, const int goal_face_index,
+                  const int *const face_heap_positions,
+                  const int maximum_path_length, const int expected_result,
+                  const int *const expected_face_indices,
+                  const int *const expected_link_indices) {
+  int result_face_indices[] = {-3, -3, -3, -3, -3};
+  int result_link_indices[] = {-3, -3, -3, -3, -3};
+
+  check_int(description, "result", expected_result,
+            finish_navigation_path(goal_face_index, face_parent_indices,
+                                   face_parent_link_indices,
+                                   face_heap_positions, maximum_path_length,
+                                   result_face_indices, result_link_indices));
+
+  for (int index = 0; index < 5; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int(description, "link index", expected_link_indices[index],
+              result_link_indices[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int closed[] = {-2, -2, -2, -2, -2};
+  const int open[] = {-2, -2, 0, -2, -2};
+  const int none[] = {-3, -3, -3, -3, -3};
+
+  {
+    const int expected_face_indices[] = {1, 3, 4, 2, -3};
+    const int expected_link_indices[] = {-1, 5, -1, 7, -3};
+    check("found", 2, closed, 5, 4, expected_face_indices,
+          expected_link_indices);
+    check("exact fit", 2, closed, 4, 4, expected_face_indices,
+          expected_link_indices);
+  }
+
+  {
+    const int expected_face_indices[] = {1, -3, -3, -3, -3};
+    const int expected_link_indices[] = {-1, -3, -3, -3, -3};
+    check("start face", 1, closed, 5, 1, expected_face_indices,
+          expected_link_indices);
+  }
+
+  check("too long", 2, closed, 3, 4, none, none);
+  check("not reached", 2, open, 5, -1, none, none);
+
+  return exit_code;
+}
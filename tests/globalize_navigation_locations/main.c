@@ -0,0 +1,44 @@
+#include "../../src/globalize_navigation_locations.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const double expected, const double actual) {
+  if (actual != actual || expected < actual - 0.0025 ||
+      expected > actual + 0.0025) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float tile_locations[] = {
+    0.25f, -0.5f, 0.125f, -0.25f, 1.0f, -1.0f,
+};
+
+static const double tile_origin[] = {20000000.0, -30000000.0, 1000.0};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  double world_locations[] = {-1.0, -1.0, -1.0, -1.0, -1.0,
+                              -1.0, -1.0, -1.0, -1.0};
+
+  globalize_navigation_locations(2, tile_locations, tile_origin,
+                                 world_locations);
+
+  check_approximate("first", "x", 20000000.25, world_locations[0]);
+  check_approximate("first", "y", -30000000.5, world_locations[1]);
+  check_approximate("first", "z", 1000.125, world_locations[2]);
+  check_approximate("second", "x", 19999999.75, world_locations[3]);
+  check_approximate("second", "y", -29999999.0, world_locations[4]);
+  check_approximate("second", "z", 999.0, world_locations[5]);
+  check_approximate("beyond", "x", -1.0, world_locations[6]);
+  check_approximate("beyond", "y", -1.0, world_locations[7]);
+  check_approximate("beyond", "z", -1.0, world_locations[8]);
+
+  return exit_code;
+}
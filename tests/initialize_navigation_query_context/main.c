@@ -0,0 +1,46 @@
+#include "../../src/initialize_navigation_query_context.h"
+#include "../../src/navigation_query_context.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  unsigned char scratch[16];
+  union navigation_query_context contexts[2];
+  contexts[0].state.scratch_used = 7;
+  contexts[0].state.face_index_hint = 3;
+  contexts[0].state.query_count = 9;
+  contexts[0].state.scratch_exhausted_count = 2;
+
+  initialize_navigation_query_context(scratch, 16, &contexts[0]);
+
+  check_int("initialized", "scratch", 1, contexts[0].state.scratch == scratch);
+  check_int("initialized", "scratch capacity", 16,
+            contexts[0].state.scratch_capacity);
+  check_int("initialized", "scratch used", 0, contexts[0].state.scratch_used);
+  check_int("initialized", "face index hint", -1,
+            contexts[0].state.face_index_hint);
+  check_int("initialized", "query count", 0, contexts[0].state.query_count);
+  check_int("initialized", "scratch exhausted count", 0,
+            contexts[0].state.scratch_exhausted_count);
+  check_int("size", "context", NAVIGATION_QUERY_CONTEXT_SIZE,
+            (int)sizeof(union navigation_query_context));
+  check_int("size", "stride", NAVIGATION_QUERY_CONTEXT_SIZE,
+            (int)((unsigned char *)&contexts[1] -
+                  (unsigned char *)&contexts[0]));
+
+  return exit_code;
+}
@@ -0,0 +1,94 @@
+#include "../../src/closest_navigable_face.h"
+#include "../../src/instanced_closest_navigable_face.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float instance_transform[] = {
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 10.0f, 20.0f, 30.0f,
+};
+
+static void to_world(const float *const local, float *const world) {
+  world[0] = 10.0f - local[1];
+  world[1] = 20.0f + local[0];
+  world[2] = 30.0f + local[2];
+}
+
+static const float locations[] = {
+    0.5f, 0.5f,  0.4f, 0.5f, 0.5f,  1.7f, 1.5f, 0.5f,  0.4f,  0.2f, 1.8f,
+    0.3f, 3.0f,  3.0f, 1.0f, -2.0f, 0.5f, 0.7f, 10.0f, 10.0f, 0.0f, 1.2f,
+    1.3f, -0.5f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int face_flags[] = {1, 2, 1, 1};
+  const int include_flags[] = {0, 1, 3, 2};
+  const int exclude_flags[] = {0, 0, 1, 0};
+
+  for (int filter = 0; filter < 4; filter++) {
+    const int *const flags = filter == 0 ? NULL : face_flags;
+
+    for (int index = 0; index < 8; index++) {
+      float world_location[3];
+      to_world(locations + index * 3, world_location);
+
+      check_int("location", "face index",
+                closest_navigable_face(
+                    locations + index * 3, 4, face_vertex_counts,
+                    face_vertex_offsets, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, flags,
+                    include_flags[filter], exclude_flags[filter]),
+                instanced_closest_navigable_face(
+                    world_location, 4, face_vertex_counts,
+                    face_vertex_offsets, face_vertex_locations, face_normals,
+                    edge_normals, edge_coefficients, instance_transform,
+                    flags, include_flags[filter], exclude_flags[filter]));
+    }
+  }
+
+  return exit_code;
+}
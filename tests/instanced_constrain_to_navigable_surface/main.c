@@ -0,0 +1,95 @@
+#include "../../src/constrain_to_navigable_surface.h"
+#include "../../src/instanced_constrain_to_navigable_surface.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float instance_transform[] = {
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 10.0f, 20.0f, 30.0f,
+};
+
+static void to_world(const float *const local, float *const world) {
+  world[0] = 10.0f - local[1];
+  world[1] = 20.0f + local[0];
+  world[2] = 30.0f + local[2];
+}
+
+static const float locations[] = {
+    0.5f, 0.5f,  0.4f, 0.5f, 0.5f,  1.7f, 1.5f, 0.5f,  0.4f,  0.2f, 1.8f,
+    0.3f, 3.0f,  3.0f, 1.0f, -2.0f, 0.5f, 0.7f, 10.0f, 10.0f, 0.0f, 1.2f,
+    1.3f, -0.5f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  for (int face_index = 0; face_index < 4; face_index++) {
+    for (int index = 0; index < 8; index++) {
+      float expected_local_location[3];
+
+      constrain_to_navigable_surface(
+          locations + index * 3, face_vertex_counts, face_vertex_offsets,
+          face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+          face_index, expected_local_location);
+
+      float expected_location[3];
+      to_world(expected_local_location, expected_location);
+
+      float location[3];
+      to_world(locations + index * 3, location);
+
+      instanced_constrain_to_navigable_surface(
+          location, face_vertex_counts, face_vertex_offsets,
+          face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+          instance_transform, face_index, location);
+
+      check_approximate("location", "x", expected_location[0], location[0]);
+      check_approximate("location", "y", expected_location[1], location[1]);
+      check_approximate("location", "z", expected_location[2], location[2]);
+    }
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,119 @@
+#include "../../src/instanced_sliding_navigation_collision.h"
+#include "../../src/sliding_navigation_collision.h"
+#include "../../src/sliding_navigation_collision_result.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_exit_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const float instance_transform[] = {
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 10.0f, 20.0f, 30.0f,
+};
+
+static void to_world(const float *const local, float *const world) {
+  world[0] = 10.0f - local[1];
+  world[1] = 20.0f + local[0];
+  world[2] = 30.0f + local[2];
+}
+
+static const float from[] = {0.5f, 0.5f, 0.1f};
+
+static const float tos[] = {
+    1.5f, 0.5f, 0.1f, 0.5f, 0.5f, -1.0f, 0.5f, -0.5f, 0.1f, 0.6f, 0.6f, 0.2f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  for (int index = 0; index < 4; index++) {
+    float expected_local_from[3];
+    float expected_local_to[3];
+    int expected_edge_index = -1;
+
+    const int expected_result = sliding_navigation_collision(
+        from, 0, tos + index * 3, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_normals, edge_exit_normals,
+        face_edge_neighbor_counts, expected_local_from, expected_local_to,
+        &expected_edge_index);
+
+    float expected_from[3];
+    float expected_to[3];
+    to_world(expected_local_from, expected_from);
+    to_world(expected_local_to, expected_to);
+
+    float world_from[3];
+    float world_to[3];
+    to_world(from, world_from);
+    to_world(tos + index * 3, world_to);
+
+    int edge_index = -1;
+
+    const int result = instanced_sliding_navigation_collision(
+        world_from, 0, world_to, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_normals, edge_exit_normals,
+        face_edge_neighbor_counts, instance_transform, world_from, world_to,
+        &edge_index);
+
+    check_int("result", "value", expected_result, result);
+
+    if (expected_result == SLIDING_NAVIGATION_COLLISION_RESULT_EDGE) {
+      check_int("edge index", "value", expected_edge_index, edge_index);
+    }
+
+    check_approximate("from", "x", expected_from[0], world_from[0]);
+    check_approximate("from", "y", expected_from[1], world_from[1]);
+    check_approximate("from", "z", expected_from[2], world_from[2]);
+    check_approximate("to", "x", expected_to[0], world_to[0]);
+    check_approximate("to", "y", expected_to[1], world_to[1]);
+    check_approximate("to", "z", expected_to[2], world_to[2]);
+  }
+
+  return exit_code;
+}
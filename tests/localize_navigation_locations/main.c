@@ -0,0 +1,44 @@
+#include "../../src/localize_navigation_locations.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const double world_locations[] = {
+    20000000.25, -30000000.5, 1000.125, 19999999.75, -29999999.0, 999.0,
+};
+
+static const double tile_origin[] = {20000000.0, -30000000.0, 1000.0};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  float tile_locations[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+                            -1.0f, -1.0f, -1.0f, -1.0f};
+
+  localize_navigation_locations(2, world_locations, tile_origin,
+                                tile_locations);
+
+  check_approximate("first", "x", 0.25f, tile_locations[0]);
+  check_approximate("first", "y", -0.5f, tile_locations[1]);
+  check_approximate("first", "z", 0.125f, tile_locations[2]);
+  check_approximate("second", "x", -0.25f, tile_locations[3]);
+  check_approximate("second", "y", 1.0f, tile_locations[4]);
+  check_approximate("second", "z", -1.0f, tile_locations[5]);
+  check_approximate("beyond", "x", -1.0f, tile_locations[6]);
+  check_approximate("beyond", "y", -1.0f, tile_locations[7]);
+  check_approximate("beyond", "z", -1.0f, tile_locations[8]);
+
+  return exit_code;
+}
@@ -0,0 +1,247 @@
+#include "../../src/merge_navigable_faces.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 4, 4, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 12, 16};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f,
+    1.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.1f, 2.0f, 2.0f, 0.1f, 1.0f, 2.0f, 0.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    -0.0995037f, 0.0f, 0.9950372f,
+};
+
+static const int face_edge_neighbor_counts[] = {
+    0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+};
+
+static const int face_edge_neighbor_offsets[] = {
+    0, 0, 1, 2, 2, 2, 3, 4, 5, 5, 5, 5, 6, 7, 8, 8, 8, 9, 9, 9,
+};
+
+static const int face_edge_neighbor_face_indices[] = {1, 3, 2, 4, 0, 1,
+                                                      0, 4, 1, 3};
+
+static const int face_flags[] = {1, 1, 2, 1, 1};
+
+static int face_groups[5];
+static int face_next_members[5];
+static int group_vertex_counts[5];
+static float group_vertex_locations[168];
+static int result_face_indices[5];
+static int result_face_vertex_counts[5];
+static int result_face_vertex_offsets[5];
+static float result_face_vertex_locations[60];
+static float result_face_normals[15];
+static float result_edge_normals[60];
+static float result_edge_exit_normals[60];
+static float result_edge_coefficients[60];
+static float result_vertex_up_normals[60];
+static int result_face_edge_neighbor_counts[20];
+static int result_face_edge_neighbor_offsets[20];
+static int result_face_edge_neighbor_face_indices[10];
+static int result_face_flags[5];
+
+static void check(const char *const description, const int *const flags,
+                  const float minimum_normal_dot,
+                  const float maximum_plane_distance,
+                  const int expected_result_face_count,
+                  const int *const expected_result_face_indices,
+                  const int *const expected_result_face_vertex_counts,
+                  const int *const expected_result_face_vertex_offsets,
+                  const int expected_result_vertex_count,
+                  const float *const expected_result_face_vertex_locations,
+                  const int *const expected_result_face_edge_neighbor_counts,
+                  const int *const expected_result_face_edge_neighbor_offsets,
+                  const int *const expected_result_face_edge_neighbor_indices,
+                  const int expected_result_neighbor_count) {
+  check_int(
+      description, "result face count", expected_result_face_count,
+      merge_navigable_faces(
+          5, face_vertex_counts, face_vertex_offsets, face_vertex_locations,
+          face_normals, face_edge_neighbor_counts, face_edge_neighbor_offsets,
+          face_edge_neighbor_face_indices, flags, 8, minimum_normal_dot,
+          maximum_plane_distance, face_groups, face_next_members,
+          group_vertex_counts, group_vertex_locations, result_face_indices,
+          result_face_vertex_counts, result_face_vertex_offsets,
+          result_face_vertex_locations, result_face_normals,
+          result_edge_normals, result_edge_exit_normals,
+          result_edge_coefficients, result_vertex_up_normals,
+          result_face_edge_neighbor_counts, result_face_edge_neighbor_offsets,
+          result_face_edge_neighbor_face_indices, result_face_flags));
+
+  for (int face_index = 0; face_index < 5; face_index++) {
+    check_int(description, "result face index",
+              expected_result_face_indices[face_index],
+              result_face_indices[face_index]);
+  }
+
+  for (int face_index = 0; face_index < expected_result_face_count;
+       face_index++) {
+    check_int(description, "result face vertex count",
+              expected_result_face_vertex_counts[face_index],
+              result_face_vertex_counts[face_index]);
+    check_int(description, "result face vertex offset",
+              expected_result_face_vertex_offsets[face_index],
+              result_face_vertex_offsets[face_index]);
+  }
+
+  for (int component = 0; component < expected_result_vertex_count * 3;
+       component++) {
+    check_approximate(description, "result face vertex location",
+                      expected_result_face_vertex_locations[component],
+                      result_face_vertex_locations[component]);
+  }
+
+  for (int edge_index = 0; edge_index < expected_result_vertex_count;
+       edge_index++) {
+    check_int(description, "result face edge neighbor count",
+              expected_result_face_edge_neighbor_counts[edge_index],
+              result_face_edge_neighbor_counts[edge_index]);
+    check_int(description, "result face edge neighbor offset",
+              expected_result_face_edge_neighbor_offsets[edge_index],
+              result_face_edge_neighbor_offsets[edge_index]);
+  }
+
+  for (int neighbor = 0; neighbor < expected_result_neighbor_count;
+       neighbor++) {
+    check_int(description, "result face edge neighbor face index",
+              expected_result_face_edge_neighbor_indices[neighbor],
+              result_face_edge_neighbor_face_indices[neighbor]);
+  }
+
+  check_approximate(description, "result face normal x", 0.0f,
+                    result_face_normals[0]);
+  check_approximate(description, "result face normal y", 0.0f,
+                    result_face_normals[1]);
+  check_approximate(description, "result face normal z", 1.0f,
+                    result_face_normals[2]);
+  check_approximate(description, "result edge normal x", -1.0f,
+                    result_edge_normals[0]);
+  check_approximate(description, "result edge normal y", 0.0f,
+                    result_edge_normals[1]);
+  check_approximate(description, "result edge normal z", 0.0f,
+                    result_edge_normals[2]);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  {
+    const int expected_result_face_indices[] = {0, 0, 1, 2, 3};
+    const int expected_result_face_vertex_counts[] = {4, 4, 4, 4};
+    const int expected_result_face_vertex_offsets[] = {0, 4, 8, 12};
+    const float expected_result_face_vertex_locations[] = {
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f,
+        2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f,
+        1.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.1f, 2.0f, 2.0f, 0.1f, 1.0f, 2.0f, 0.0f,
+    };
+    const int expected_result_face_edge_neighbor_counts[] = {
+        0, 0, 1, 2, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1,
+    };
+    const int expected_result_face_edge_neighbor_offsets[] = {
+        0, 0, 0, 1, 3, 3, 3, 3, 4, 5, 6, 6, 6, 7, 7, 7,
+    };
+    const int expected_result_face_edge_neighbor_indices[] = {1, 2, 3, 0,
+                                                              0, 3, 0, 2};
+
+    check("flags and normals", face_flags, 0.999f, 0.01f, 4,
+          expected_result_face_indices, expected_result_face_vertex_counts,
+          expected_result_face_vertex_offsets, 16,
+          expected_result_face_vertex_locations,
+          expected_result_face_edge_neighbor_counts,
+          expected_result_face_edge_neighbor_offsets,
+          expected_result_face_edge_neighbor_indices, 8);
+
+    check_int("flags and normals", "result face flag", 1, result_face_flags[0]);
+    check_int("flags and normals", "result face flag", 2, result_face_flags[1]);
+  }
+
+  {
+    const int expected_result_face_indices[] = {0, 0, 0, 1, 1};
+    const int expected_result_face_vertex_counts[] = {4, 6};
+    const int expected_result_face_vertex_offsets[] = {0, 4};
+    const float expected_result_face_vertex_locations[] = {
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f,
+        1.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+        2.0f, 1.0f, 0.1f, 2.0f, 2.0f, 0.1f,
+    };
+    const int expected_result_face_edge_neighbor_counts[] = {
+        0, 0, 0, 1, 0, 0, 1, 1, 0, 0,
+    };
+    const int expected_result_face_edge_neighbor_offsets[] = {
+        0, 0, 0, 0, 1, 1, 1, 2, 3, 3,
+    };
+    const int expected_result_face_edge_neighbor_indices[] = {1, 0, 0};
+
+    check("unflagged and tolerant", NULL, 0.99f, 0.1f, 2,
+          expected_result_face_indices, expected_result_face_vertex_counts,
+          expected_result_face_vertex_offsets, 10,
+          expected_result_face_vertex_locations,
+          expected_result_face_edge_neighbor_counts,
+          expected_result_face_edge_neighbor_offsets,
+          expected_result_face_edge_neighbor_indices, 3);
+  }
+
+  {
+    const int expected_result_face_indices[] = {0, 0, 0, 1, 2};
+    const int expected_result_face_vertex_counts[] = {4, 4, 4};
+    const int expected_result_face_vertex_offsets[] = {0, 4, 8};
+    const float expected_result_face_vertex_locations[] = {
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 2.0f, 0.0f,
+        1.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.1f, 2.0f, 2.0f, 0.1f, 1.0f, 2.0f, 0.0f,
+    };
+    const int expected_result_face_edge_neighbor_counts[] = {
+        0, 0, 0, 2, 1, 1, 0, 0, 1, 0, 0, 1,
+    };
+    const int expected_result_face_edge_neighbor_offsets[] = {
+        0, 0, 0, 0, 2, 3, 4, 4, 4, 5, 5, 5,
+    };
+    const int expected_result_face_edge_neighbor_indices[] = {1, 2, 0,
+                                                              2, 0, 1};
+
+    check("unflagged and near plane", NULL, 0.99f, 0.01f, 3,
+          expected_result_face_indices, expected_result_face_vertex_counts,
+          expected_result_face_vertex_offsets, 12,
+          expected_result_face_vertex_locations,
+          expected_result_face_edge_neighbor_counts,
+          expected_result_face_edge_neighbor_offsets,
+          expected_result_face_edge_neighbor_indices, 6);
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,308 @@
+#include "../../src/move_across_navigation_mesh.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_exit_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int face_flags[] = {1, 2, 1, 1};
+
+static const int face_link_offsets[] = {0, 1, 2, 3, 3};
+
+static const int face_link_indices[] = {0, 1, 2};
+
+static const int link_end_face_indices[] = {3, 2, 1};
+
+static const float link_start_locations[] = {
+    0.5f, 0.9f, 0.0f, 1.5f, 0.5f, 0.0f, 0.2f, 1.2f, 0.0f,
+};
+
+static const float link_end_locations[] = {
+    0.5f, 0.5f, 2.0f, 0.2f, 1.2f, 0.0f, 1.5f, 0.5f, 0.0f,
+};
+
+static const int link_flags[] = {1, 2, 2};
+
+static void filtered_scenario(
+    const char *const description, const float from_x, const float from_y,
+    const float from_z, const int face_index, const float to_x,
+    const float to_y, const float to_z, const int maximum_iterations,
+    const int *const flags, const int include_flags, const int exclude_flags,
+    const float result_x, const float result_y, const float result_z,
+    const int result_face_index, const int iterations) {
+  const float from[] = {from_x, from_y, from_z};
+  const float to[] = {to_x, to_y, to_z};
+  float result_location[] = {-1.0f, -1.0f, -1.0f};
+  int actual_result_face_index = -1;
+
+  const int actual_iterations = move_across_navigation_mesh(
+      from, face_index, to, maximum_iterations, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals,
+      edge_exit_normals, face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, flags, NULL, NULL, NULL, NULL, NULL,
+      NULL, 0.0f, include_flags, exclude_flags, result_location,
+      &actual_result_face_index, 0, 0, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  check_exact(description, "from x", from_x, from[0]);
+  check_exact(description, "from y", from_y, from[1]);
+  check_exact(description, "from z", from_z, from[2]);
+  check_exact(description, "to x", to_x, to[0]);
+  check_exact(description, "to y", to_y, to[1]);
+  check_exact(description, "to z", to_z, to[2]);
+  check_approximate(description, "result x", result_x, result_location[0]);
+  check_approximate(description, "result y", result_y, result_location[1]);
+  check_approximate(description, "result z", result_z, result_location[2]);
+  check_int(description, "result face index", result_face_index,
+            actual_result_face_index);
+  check_int(description, "iterations", iterations, actual_iterations);
+}
+
+static void scenario(const char *const description, const float from_x,
+                     const float from_y, const float from_z,
+                     const int face_index, const float to_x, const float to_y,
+                     const float to_z, const int maximum_iterations,
+                     const float result_x, const float result_y,
+                     const float result_z, const int result_face_index,
+                     const int iterations) {
+  filtered_scenario(description, from_x, from_y, from_z, face_index, to_x,
+                    to_y, to_z, maximum_iterations, NULL, 0, 0, result_x,
+                    result_y, result_z, result_face_index, iterations);
+}
+
+static void event_scenario(const char *const description, const float to_x,
+                           const float to_y, const int maximum_events,
+                           const int expected_event_count,
+                           const int *const expected_from_face_indices,
+                           const int *const expected_to_face_indices,
+                           const int *const expected_edge_indices,
+                           const float *const expected_locations) {
+  const float from[] = {0.5f, 0.5f, 0.0f};
+  const float to[] = {to_x, to_y, 0.0f};
+  float result_location[3];
+  int result_face_index;
+  int event_count = 1;
+  int event_agent_indices[] = {-1, -1, -1};
+  int event_from_face_indices[] = {-1, -1, -1};
+  int event_to_face_indices[] = {-1, -1, -1};
+  int event_edge_indices[] = {-1, -1, -1};
+  float event_locations[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+                             -1.0f, -1.0f, -1.0f, -1.0f};
+
+  move_across_navigation_mesh(
+      from, 0, to, 4, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, NULL, NULL, NULL, NULL, NULL, NULL,
+      NULL, 0.0f, 0, 0, result_location, &result_face_index, 7,
+      maximum_events, &event_count,
+      event_agent_indices, event_from_face_indices, event_to_face_indices,
+      event_edge_indices, event_locations);
+
+  check_int(description, "event count", expected_event_count, event_count);
+  check_int(description, "skipped agent index", -1, event_agent_indices[0]);
+
+  for (int index = 1; index < 3; index++) {
+    const int expected_agent_index =
+        expected_from_face_indices[index] == -1 ? -1 : 7;
+
+    check_int(description, "agent index", expected_agent_index,
+              event_agent_indices[index]);
+    check_int(description, "from face index",
+              expected_from_face_indices[index],
+              event_from_face_indices[index]);
+    check_int(description, "to face index", expected_to_face_indices[index],
+              event_to_face_indices[index]);
+    check_int(description, "edge index", expected_edge_indices[index],
+              event_edge_indices[index]);
+    check_approximate(description, "location x",
+                      expected_locations[index * 3],
+                      event_locations[index * 3]);
+    check_approximate(description, "location y",
+                      expected_locations[index * 3 + 1],
+                      event_locations[index * 3 + 1]);
+    check_approximate(description, "location z",
+                      expected_locations[index * 3 + 2],
+                      event_locations[index * 3 + 2]);
+  }
+}
+
+static void link_scenario(const char *const description, const float from_x,
+                          const float from_y, const int face_index,
+                          const float to_x, const float to_y,
+                          const int include_flags,
+                          const float result_x, const float result_y,
+                          const float result_z, const int result_face_index,
+                          const int iterations, const int expected_event_count,
+                          const int expected_to_face_index,
+                          const int expected_edge_index) {
+  const float from[] = {from_x, from_y, 0.0f};
+  const float to[] = {to_x, to_y, 0.0f};
+  float result_location[] = {-1.0f, -1.0f, -1.0f};
+  int actual_result_face_index = -1;
+  int event_count = 0;
+  int event_agent_indices[2];
+  int event_from_face_indices[2];
+  int event_to_face_indices[] = {-1, -1};
+  int event_edge_indices[] = {-1, -1};
+  float event_locations[6];
+
+  const int actual_iterations = move_across_navigation_mesh(
+      from, face_index, to, 4, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, NULL, face_link_offsets,
+      face_link_indices, link_end_face_indices, link_start_locations,
+      link_end_locations, link_flags, 0.05f, include_flags, 0,
+      result_location, &actual_result_face_index, 0, 2, &event_count,
+      event_agent_indices, event_from_face_indices, event_to_face_indices,
+      event_edge_indices, event_locations);
+
+  check_approximate(description, "result x", result_x, result_location[0]);
+  check_approximate(description, "result y", result_y, result_location[1]);
+  check_approximate(description, "result z", result_z, result_location[2]);
+  check_int(description, "result face index", result_face_index,
+            actual_result_face_index);
+  check_int(description, "iterations", iterations, actual_iterations);
+  check_int(description, "event count", expected_event_count, event_count);
+  const int last_event_index =
+      expected_event_count > 0 ? expected_event_count - 1 : 0;
+
+  check_int(description, "to face index", expected_to_face_index,
+            event_to_face_indices[last_event_index]);
+  check_int(description, "edge index", expected_edge_index,
+            event_edge_indices[last_event_index]);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  scenario("within face", 0.5f, 0.5f, 0.0f, 0, 0.75f, 0.25f, 0.0f, 4, 0.75f,
+           0.25f, 0.0f, 0, 1);
+
+  scenario("into neighbor", 0.5f, 0.5f, 0.0f, 0, 1.5f, 0.8f, 0.0f, 4, 1.5f,
+           0.8f, 0.0f, 1, 2);
+
+  scenario("against boundary", 0.5f, 0.5f, 0.0f, 0, 0.5f, -0.5f, 0.0f, 4,
+           0.5f, 0.0f, 0.0f, 0, 2);
+
+  scenario("into surface", 0.5f, 0.5f, 0.5f, 0, 0.75f, 0.5f, -1.0f, 4, 0.75f,
+           0.5f, 0.0f, 0, 2);
+
+  scenario("into neighbor then against boundary", 0.5f, 0.5f, 0.0f, 0, 0.8f,
+           1.5f, 0.0f, 4, 0.65f, 1.35f, 0.0f, 2, 3);
+
+  scenario("cut short", 0.5f, 0.5f, 0.0f, 0, 0.8f, 1.5f, 0.0f, 1, 0.65f, 1.0f,
+           0.0f, 2, 1);
+
+  scenario("no iterations", 0.5f, 0.5f, 0.0f, 0, 0.8f, 1.5f, 0.0f, 0, 0.5f,
+           0.5f, 0.0f, 0, 0);
+
+  filtered_scenario("into included neighbor", 0.5f, 0.5f, 0.0f, 0, 1.5f, 0.8f,
+                    0.0f, 4, face_flags, 3, 0, 1.5f, 0.8f, 0.0f, 1, 2);
+
+  filtered_scenario("against excluded neighbor", 0.5f, 0.5f, 0.0f, 0, 1.5f,
+                    0.8f, 0.0f, 4, face_flags, 1, 0, 1.0f, 0.8f, 0.0f, 0, 2);
+
+  filtered_scenario("against neighbor with excluded flag", 0.5f, 0.5f, 0.0f, 0,
+                    1.5f, 0.8f, 0.0f, 4, face_flags, 3, 2, 1.0f, 0.8f, 0.0f, 0,
+                    2);
+
+  link_scenario("through link start", 0.5f, 0.5f, 0, 0.5f, 0.95f, 3, 0.5f,
+                0.5f, 2.0f, 3, 1, 1, 3, -1);
+
+  link_scenario("past link start", 0.1f, 0.5f, 0, 0.9f, 0.85f, 3, 0.9f, 0.85f,
+                0.0f, 0, 1, 0, -1, -1);
+
+  link_scenario("link in neighbor", 0.5f, 0.5f, 0, 1.8f, 0.5f, 3, 0.2f, 1.2f,
+                0.0f, 2, 2, 2, 2, -1);
+
+  link_scenario("excluded link in neighbor", 0.5f, 0.5f, 0, 1.8f, 0.5f, 1,
+                1.8f, 0.5f, 0.0f, 1, 2, 1, 1, 1);
+
+  link_scenario("leaving end of two-way link", 0.2f, 1.2f, 2, 0.3f, 1.3f, 3,
+                0.3f, 1.3f, 0.0f, 2, 1, 0, -1, -1);
+
+  const int no_face_indices[] = {-1, -1, -1};
+  const float no_locations[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+                                -1.0f, -1.0f, -1.0f, -1.0f};
+
+  event_scenario("no events", 0.75f, 0.25f, 3, 1, no_face_indices,
+                 no_face_indices, no_face_indices, no_locations);
+
+  const int crossing_from_face_indices[] = {-1, 0, -1};
+  const int crossing_to_face_indices[] = {-1, 2, -1};
+  const int crossing_edge_indices[] = {-1, 2, -1};
+  const float crossing_locations[] = {-1.0f, -1.0f, -1.0f, 0.65f, 1.0f,
+                                      0.0f,  -1.0f, -1.0f, -1.0f};
+
+  event_scenario("crossing", 0.8f, 1.5f, 3, 2, crossing_from_face_indices,
+                 crossing_to_face_indices, crossing_edge_indices,
+                 crossing_locations);
+
+  event_scenario("crossing without space", 0.8f, 1.5f, 1, 2, no_face_indices,
+                 no_face_indices, no_face_indices, no_locations);
+
+  return exit_code;
+}
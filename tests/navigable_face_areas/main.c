@@ -0,0 +1,62 @@
+#include "../../src/navigable_face_areas.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  float face_fan_areas[15];
+  float cumulative_face_areas[4];
+
+  navigable_face_areas(4, face_vertex_counts, face_vertex_offsets,
+                       face_vertex_locations, face_normals, face_fan_areas,
+                       cumulative_face_areas);
+
+  const float expected_face_fan_areas[] = {
+      0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.5f, 0.0f,
+      0.0f, 0.5f, 1.0f,
+  };
+
+  for (int index = 0; index < 15; index++) {
+    check_approximate("face fan areas", "value", expected_face_fan_areas[index],
+                      face_fan_areas[index]);
+  }
+
+  const float expected_cumulative_face_areas[] = {1.0f, 2.0f, 2.5f, 3.5f};
+
+  for (int index = 0; index < 4; index++) {
+    check_approximate("cumulative face areas", "value",
+                      expected_cumulative_face_areas[index],
+                      cumulative_face_areas[index]);
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,127 @@
+#include "../../src/navigable_face_bounds.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static void check_face(const char *const description,
+                       const float *const face_plane_constants,
+                       const float *const face_bounds,
+                       const float *const face_bounding_spheres,
+                       const int face_index, const float plane_constant,
+                       const float *const expected_bounds,
+                       const float *const expected_bounding_sphere) {
+  check_approximate(description, "plane constant", plane_constant,
+                    face_plane_constants[face_index]);
+
+  for (int component = 0; component < 6; component++) {
+    check_approximate(description, "bounds", expected_bounds[component],
+                      face_bounds[face_index * 6 + component]);
+  }
+
+  for (int component = 0; component < 4; component++) {
+    check_approximate(description, "bounding sphere",
+                      expected_bounding_sphere[component],
+                      face_bounding_spheres[face_index * 4 + component]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  float face_plane_constants[4];
+  float face_bounds[24];
+  float face_bounding_spheres[16];
+
+  navigable_face_bounds(4, NULL, face_vertex_counts, face_vertex_offsets,
+                        face_vertex_locations, face_normals,
+                        face_plane_constants, face_bounds,
+                        face_bounding_spheres);
+
+  const float first_bounds[] = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f};
+  const float first_bounding_sphere[] = {0.5f, 0.5f, 0.0f, 0.5f};
+  check_face("first", face_plane_constants, face_bounds,
+             face_bounding_spheres, 0, 0.0f, first_bounds,
+             first_bounding_sphere);
+
+  const float second_bounds[] = {1.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f};
+  const float second_bounding_sphere[] = {1.5f, 0.5f, 0.0f, 0.5f};
+  check_face("second", face_plane_constants, face_bounds,
+             face_bounding_spheres, 1, 0.0f, second_bounds,
+             second_bounding_sphere);
+
+  const float third_bounds[] = {0.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f};
+  const float third_bounding_sphere[] = {0.5f, 1.5f, 0.0f, 0.5f};
+  check_face("third", face_plane_constants, face_bounds,
+             face_bounding_spheres, 2, 0.0f, third_bounds,
+             third_bounding_sphere);
+
+  const float fourth_bounds[] = {0.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f};
+  const float fourth_bounding_sphere[] = {0.5f, 0.5f, 2.0f, 0.5f};
+  check_face("fourth", face_plane_constants, face_bounds,
+             face_bounding_spheres, 3, 2.0f, fourth_bounds,
+             fourth_bounding_sphere);
+
+  float subset_face_plane_constants[] = {-1.0f, -1.0f, -1.0f, -1.0f};
+  float subset_face_bounds[24];
+  float subset_face_bounding_spheres[16];
+
+  for (int index = 0; index < 24; index++) {
+    subset_face_bounds[index] = -1.0f;
+  }
+
+  for (int index = 0; index < 16; index++) {
+    subset_face_bounding_spheres[index] = -1.0f;
+  }
+
+  const int face_indices[] = {3, 1};
+
+  navigable_face_bounds(2, face_indices, face_vertex_counts,
+                        face_vertex_offsets, face_vertex_locations,
+                        face_normals, subset_face_plane_constants,
+                        subset_face_bounds, subset_face_bounding_spheres);
+
+  const float untouched_bounds[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+  const float untouched_bounding_sphere[] = {-1.0f, -1.0f, -1.0f, -1.0f};
+  check_face("subset first", subset_face_plane_constants, subset_face_bounds,
+             subset_face_bounding_spheres, 0, -1.0f, untouched_bounds,
+             untouched_bounding_sphere);
+  check_face("subset second", subset_face_plane_constants, subset_face_bounds,
+             subset_face_bounding_spheres, 1, 0.0f, second_bounds,
+             second_bounding_sphere);
+  check_face("subset third", subset_face_plane_constants, subset_face_bounds,
+             subset_face_bounding_spheres, 2, -1.0f, untouched_bounds,
+             untouched_bounding_sphere);
+  check_face("subset fourth", subset_face_plane_constants, subset_face_bounds,
+             subset_face_bounding_spheres, 3, 2.0f, fourth_bounds,
+             fourth_bounding_sphere);
+
+  return exit_code;
+}
@@ -0,0 +1,85 @@
+#include "../../src/navigable_face_grid.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int expected_bucket_face_offsets[] = {0, 2, 2, 6, 7, 7, 8, 8, 8, 8, 8,
+                                              9, 9, 9, 12, 13, 16};
+  const int expected_bucket_face_indices[] = {0, 3, 0, 1, 2, 3, 2, 1, 1, 0, 1,
+                                              3, 2, 0, 2, 3};
+
+  {
+    int bucket_face_offsets[17];
+    int bucket_face_indices[17];
+
+    for (int index = 0; index < 17; index++) {
+      bucket_face_indices[index] = -1;
+    }
+
+    check_int("sufficient", "entries", 16,
+              navigable_face_grid(4, face_vertex_counts, face_vertex_offsets,
+                                  face_vertex_locations, 1.0f, 16, 17,
+                                  bucket_face_offsets, bucket_face_indices));
+
+    for (int index = 0; index < 17; index++) {
+      check_int("sufficient", "bucket face offset",
+                expected_bucket_face_offsets[index],
+                bucket_face_offsets[index]);
+      check_int("sufficient", "bucket face index",
+                index < 16 ? expected_bucket_face_indices[index] : -1,
+                bucket_face_indices[index]);
+    }
+  }
+
+  {
+    int bucket_face_offsets[17];
+    int bucket_face_indices[15];
+
+    for (int index = 0; index < 15; index++) {
+      bucket_face_indices[index] = -1;
+    }
+
+    check_int("insufficient", "entries", 16,
+              navigable_face_grid(4, face_vertex_counts, face_vertex_offsets,
+                                  face_vertex_locations, 1.0f, 16, 15,
+                                  bucket_face_offsets, bucket_face_indices));
+
+    for (int index = 0; index < 17; index++) {
+      check_int("insufficient", "bucket face offset",
+                expected_bucket_face_offsets[index],
+                bucket_face_offsets[index]);
+    }
+
+    for (int index = 0; index < 15; index++) {
+      check_int("insufficient", "bucket face index", -1,
+                bucket_face_indices[index]);
+    }
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,37 @@
+#include "../../src/navigable_face_grid_bucket.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  check_int("origin", "bucket", 0, navigable_face_grid_bucket(0, 0, 16));
+  check_int("positive", "bucket", 4, navigable_face_grid_bucket(10, 10, 16));
+  check_int("negative", "bucket", 2, navigable_face_grid_bucket(-1, -1, 16));
+  check_int("y zero", "bucket", 7, navigable_face_grid_bucket(3, 0, 16));
+  check_int("mixed", "bucket", 50, navigable_face_grid_bucket(-3, 5, 64));
+
+  for (int cell_y = -8; cell_y < 8; cell_y++) {
+    for (int cell_x = -8; cell_x < 8; cell_x++) {
+      const int bucket_index = navigable_face_grid_bucket(cell_x, cell_y, 7);
+
+      if (bucket_index < 0 || bucket_index >= 7) {
+        check_int("range", "bucket", 0, bucket_index);
+      }
+    }
+  }
+
+  return exit_code;
+}
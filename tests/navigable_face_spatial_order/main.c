@@ -0,0 +1,64 @@
+#include "../../src/navigable_face_spatial_order.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {3, 3, 3, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 3, 6, 9, 12};
+
+static const float face_vertex_locations[] = {
+    3.0f, 0.0f, 0.0f, 4.0f, 0.0f, 0.0f, 3.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f,
+    2.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 5.0f, 1.0f, 0.0f, 5.0f, 1.0f, 1.0f, 5.0f, 0.0f, 1.0f, 5.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  int face_keys[] = {-1, -1, -1, -1, -1};
+  int face_order[] = {-1, -1, -1, -1, -1};
+
+  navigable_face_spatial_order(4, face_vertex_counts, face_vertex_offsets,
+                               face_vertex_locations, face_keys, face_order);
+
+  const int expected_face_order[] = {1, 3, 2, 0, -1};
+
+  for (int index = 0; index < 5; index++) {
+    check_int("row", "face order", expected_face_order[index],
+              face_order[index]);
+  }
+
+  check_int("row", "unused face key", -1, face_keys[4]);
+
+  for (int index = 1; index < 4; index++) {
+    if (face_keys[face_order[index - 1]] > face_keys[face_order[index]]) {
+      printf("FAIL row face keys not ascending at %d\n", index);
+      exit_code = 1;
+    }
+  }
+
+  navigable_face_spatial_order(5, face_vertex_counts, face_vertex_offsets,
+                               face_vertex_locations, face_keys, face_order);
+
+  const int expected_stacked_face_order[] = {1, 3, 2, 0, 4};
+
+  for (int index = 0; index < 5; index++) {
+    check_int("stacked", "face order", expected_stacked_face_order[index],
+              face_order[index]);
+  }
+
+  return exit_code;
+}
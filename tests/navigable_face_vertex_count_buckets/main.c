@@ -0,0 +1,110 @@
+#include "../../src/navigable_face_vertex_count_buckets.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check(const char *const description, const int face_count,
+                  const int *const face_vertex_counts,
+                  const int maximum_bucket_count,
+                  const int expected_bucket_count,
+                  const int *const expected_bucket_vertex_counts,
+                  const int *const expected_bucket_face_offsets,
+                  const int *const expected_bucket_face_counts,
+                  const int *const expected_bucket_vertex_offsets,
+                  const int *const expected_face_order) {
+  int bucket_vertex_counts[] = {-1, -1, -1, -1};
+  int bucket_face_offsets[] = {-1, -1, -1, -1};
+  int bucket_face_counts[] = {-1, -1, -1, -1};
+  int bucket_vertex_offsets[] = {-1, -1, -1, -1};
+  int face_order[] = {-1, -1, -1, -1, -1};
+
+  check_int(description, "bucket count", expected_bucket_count,
+            navigable_face_vertex_count_buckets(
+                face_count, face_vertex_counts, maximum_bucket_count,
+                bucket_vertex_counts, bucket_face_offsets, bucket_face_counts,
+                bucket_vertex_offsets, face_order));
+
+  for (int bucket_index = 0; bucket_index < 4; bucket_index++) {
+    check_int(description, "bucket vertex count",
+              expected_bucket_vertex_counts[bucket_index],
+              bucket_vertex_counts[bucket_index]);
+    check_int(description, "bucket face offset",
+              expected_bucket_face_offsets[bucket_index],
+              bucket_face_offsets[bucket_index]);
+    check_int(description, "bucket face count",
+              expected_bucket_face_counts[bucket_index],
+              bucket_face_counts[bucket_index]);
+    check_int(description, "bucket vertex offset",
+              expected_bucket_vertex_offsets[bucket_index],
+              bucket_vertex_offsets[bucket_index]);
+  }
+
+  for (int face_index = 0; face_index < 5; face_index++) {
+    check_int(description, "face order", expected_face_order[face_index],
+              face_order[face_index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int none[] = {-1, -1, -1, -1, -1};
+
+  {
+    const int face_vertex_counts[] = {4, 4, 3, 4};
+    const int expected_bucket_vertex_counts[] = {3, 4, -1, -1};
+    const int expected_bucket_face_offsets[] = {0, 1, -1, -1};
+    const int expected_bucket_face_counts[] = {1, 3, -1, -1};
+    const int expected_bucket_vertex_offsets[] = {0, 3, -1, -1};
+    const int expected_face_order[] = {2, 0, 1, 3, -1};
+
+    check("two buckets", 4, face_vertex_counts, 4, 2,
+          expected_bucket_vertex_counts, expected_bucket_face_offsets,
+          expected_bucket_face_counts, expected_bucket_vertex_offsets,
+          expected_face_order);
+  }
+
+  {
+    const int face_vertex_counts[] = {5, 3, 4, 3, 5};
+    const int expected_face_order[] = {1, 3, 2, 0, 4};
+
+    {
+      const int expected_bucket_vertex_counts[] = {3, 4, 5, -1};
+      const int expected_bucket_face_offsets[] = {0, 2, 3, -1};
+      const int expected_bucket_face_counts[] = {2, 1, 2, -1};
+      const int expected_bucket_vertex_offsets[] = {0, 6, 10, -1};
+
+      check("three buckets", 5, face_vertex_counts, 4, 3,
+            expected_bucket_vertex_counts, expected_bucket_face_offsets,
+            expected_bucket_face_counts, expected_bucket_vertex_offsets,
+            expected_face_order);
+    }
+
+    {
+      const int expected_bucket_vertex_counts[] = {3, -1, -1, -1};
+      const int expected_bucket_face_offsets[] = {0, -1, -1, -1};
+      const int expected_bucket_face_counts[] = {2, -1, -1, -1};
+      const int expected_bucket_vertex_offsets[] = {0, -1, -1, -1};
+
+      check("too many buckets", 5, face_vertex_counts, 1, 3,
+            expected_bucket_vertex_counts, expected_bucket_face_offsets,
+            expected_bucket_face_counts, expected_bucket_vertex_offsets,
+            expected_face_order);
+    }
+  }
+
+  check("no faces", 0, none, 4, 0, none, none, none, none, none);
+
+  return exit_code;
+}
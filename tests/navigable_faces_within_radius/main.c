@@ -0,0 +1,141 @@
+#include "../../src/navigable_faces_within_radius.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const int face_flags[] = {1, 2, 1, 1};
+
+static void filtered_scenario(const char *const description,
+                              const float radius, const int face_count,
+                              const int *const face_indices,
+                              const int *const flags, const int include_flags,
+                              const int exclude_flags,
+                              const int maximum_results,
+                              const int expected_count,
+                              const int *const expected_face_indices,
+                              const float *const expected_distances_squared) {
+  const float location[] = {0.5f, 0.6f, 0.5f};
+  int result_face_indices[] = {-1, -1, -1, -1, -1};
+  float result_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+
+  const int actual_count = navigable_faces_within_radius(
+      location, radius, face_count, face_indices, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals, edge_normals,
+      edge_coefficients, flags, include_flags, exclude_flags, maximum_results,
+      result_face_indices, result_distances_squared);
+
+  check_int(description, "count", expected_count, actual_count);
+
+  const int written =
+      expected_count < maximum_results ? expected_count : maximum_results;
+
+  for (int index = 0; index < written; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_approximate(description, "distance squared",
+                      expected_distances_squared[index],
+                      result_distances_squared[index]);
+  }
+
+  for (int index = written; index < 5; index++) {
+    check_int(description, "unused face index", -1,
+              result_face_indices[index]);
+    check_approximate(description, "unused distance squared", -1.0f,
+                      result_distances_squared[index]);
+  }
+}
+
+static void scenario(const char *const description, const float radius,
+                     const int face_count, const int *const face_indices,
+                     const int maximum_results, const int expected_count,
+                     const int *const expected_face_indices,
+                     const float *const expected_distances_squared) {
+  filtered_scenario(description, radius, face_count, face_indices, NULL, 0, 0,
+                    maximum_results, expected_count, expected_face_indices,
+                    expected_distances_squared);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int all_face_indices[] = {0, 1, 2, 3};
+  const float all_distances_squared[] = {0.25f, 0.5f, 0.41f, 2.25f};
+  scenario("everything", 2.0f, 4, NULL, 5, 4, all_face_indices,
+           all_distances_squared);
+
+  const int near_face_indices[] = {0, 2};
+  const float near_distances_squared[] = {0.25f, 0.41f};
+  scenario("near", 0.7f, 4, NULL, 5, 2, near_face_indices,
+           near_distances_squared);
+
+  scenario("truncated", 0.7f, 4, NULL, 1, 2, near_face_indices,
+           near_distances_squared);
+
+  scenario("nothing", 0.4f, 4, NULL, 5, 0, NULL, NULL);
+
+  const int candidate_face_indices[] = {3, 2};
+  const int candidate_expected_face_indices[] = {2};
+  const float candidate_distances_squared[] = {0.41f};
+  scenario("candidates", 1.0f, 2, candidate_face_indices, 5, 1,
+           candidate_expected_face_indices, candidate_distances_squared);
+
+  const int filtered_face_indices[] = {0, 2, 3};
+  const float filtered_distances_squared[] = {0.25f, 0.41f, 2.25f};
+  filtered_scenario("filtered", 2.0f, 4, NULL, face_flags, 1, 0, 5, 3,
+                    filtered_face_indices, filtered_distances_squared);
+
+  return exit_code;
+}
@@ -0,0 +1,127 @@
+#include "../../src/navigable_face_bounds.h"
+#include "../../src/navigable_faces_within_radius.h"
+#include "../../src/navigable_faces_within_radius_with_bounds.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static void check(const char *const description, const float *const location,
+                  const float radius, const int face_count,
+                  const int *const face_indices, const int *const face_flags,
+                  const int include_flags, const int exclude_flags,
+                  const int maximum_results) {
+  float face_plane_constants[4];
+  float face_bounds[24];
+  float face_bounding_spheres[16];
+
+  navigable_face_bounds(4, NULL, face_vertex_counts, face_vertex_offsets,
+                        face_vertex_locations, face_normals,
+                        face_plane_constants, face_bounds,
+                        face_bounding_spheres);
+
+  int expected_face_indices[] = {-1, -1, -1, -1, -1};
+  float expected_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+
+  const int expected_count = navigable_faces_within_radius(
+      location, radius, face_count, face_indices, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals, edge_normals,
+      edge_coefficients, face_flags, include_flags, exclude_flags,
+      maximum_results, expected_face_indices, expected_distances_squared);
+
+  int actual_face_indices[] = {-1, -1, -1, -1, -1};
+  float actual_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+
+  const int actual_count = navigable_faces_within_radius_with_bounds(
+      location, radius, face_count, face_indices, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals,
+      face_plane_constants, face_bounding_spheres, edge_normals,
+      edge_coefficients, face_flags, include_flags, exclude_flags,
+      maximum_results, actual_face_indices, actual_distances_squared);
+
+  check_int(description, "count", expected_count, actual_count);
+
+  for (int index = 0; index < 5; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              actual_face_indices[index]);
+    check_approximate(description, "distance squared",
+                      expected_distances_squared[index],
+                      actual_distances_squared[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float location[] = {0.5f, 0.6f, 0.5f};
+  const float far_location[] = {5.0f, 5.0f, 0.0f};
+  const float corner_location[] = {2.5f, -0.5f, 0.0f};
+  const int candidate_face_indices[] = {3, 2};
+  const int face_flags[] = {1, 2, 1, 1};
+
+  check("everything", location, 2.0f, 4, NULL, NULL, 0, 0, 5);
+  check("near", location, 0.7f, 4, NULL, NULL, 0, 0, 5);
+  check("truncated", location, 0.7f, 4, NULL, NULL, 0, 0, 1);
+  check("nothing", location, 0.4f, 4, NULL, NULL, 0, 0, 5);
+  check("candidates", location, 1.0f, 2, candidate_face_indices, NULL, 0, 0,
+        5);
+  check("filtered", location, 2.0f, 4, NULL, face_flags, 1, 0, 5);
+  check("far", far_location, 4.0f, 4, NULL, NULL, 0, 0, 5);
+  check("far reached", far_location, 6.0f, 4, NULL, NULL, 0, 0, 5);
+  check("corner beyond", corner_location, 0.70f, 4, NULL, NULL, 0, 0, 5);
+  check("corner within", corner_location, 0.71f, 4, NULL, NULL, 0, 0, 5);
+
+  return exit_code;
+}
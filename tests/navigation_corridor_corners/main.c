@@ -0,0 +1,149 @@
+#include "../../src/navigation_corridor_corners.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const float link_start_locations[] = {9.0f, 9.0f, 9.0f,
+                                             0.5f, 0.75f, 0.0f};
+
+static void check_corners(const char *const description,
+                          const float *const location,
+                          const float *const goal_location,
+                          const int corridor_length,
+                          const int *const corridor_face_indices,
+                          const int *const corridor_link_indices,
+                          const int maximum_corner_count,
+                          const int expected_corner_count,
+                          const float *const expected_corner_locations) {
+  float corner_locations[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+                              -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+
+  const int corner_count = navigation_corridor_corners(
+      location, goal_location, corridor_length, corridor_face_indices,
+      corridor_link_indices, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_edge_neighbor_counts,
+      face_edge_neighbor_offsets, face_edge_neighbor_face_indices,
+      link_start_locations, maximum_corner_count, corner_locations);
+
+  check_int(description, "corner count", expected_corner_count, corner_count);
+
+  for (int index = 0; index < 12; index++) {
+    check_approximate(description, "corner location",
+                      expected_corner_locations[index],
+                      corner_locations[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int corridor_face_indices[] = {2, 0, 1};
+  const int corridor_link_indices[] = {-1, -1, -1};
+
+  const float around_location[] = {1.5f, 0.9f, 0.0f};
+  const float around_goal_location[] = {0.1f, 1.8f, 0.0f};
+  const float expected_around_corner_locations[] = {
+      1.0f, 1.0f, 0.0f, 0.1f, 1.8f, 0.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f,
+  };
+
+  check_corners("around", around_location, around_goal_location, 3,
+                corridor_face_indices, corridor_link_indices, 4, 2,
+                expected_around_corner_locations);
+
+  const float expected_limited_corner_locations[] = {
+      1.0f, 1.0f, 0.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f,
+  };
+
+  check_corners("limited", around_location, around_goal_location, 3,
+                corridor_face_indices, corridor_link_indices, 1, 1,
+                expected_limited_corner_locations);
+
+  const float straight_location[] = {1.5f, 0.5f, 0.0f};
+  const float straight_goal_location[] = {0.2f, 1.5f, 0.0f};
+  const float expected_straight_corner_locations[] = {
+      0.2f, 1.5f, 0.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f,
+  };
+
+  check_corners("straight", straight_location, straight_goal_location, 3,
+                corridor_face_indices, corridor_link_indices, 4, 1,
+                expected_straight_corner_locations);
+
+  const float other_way_location[] = {0.1f, 1.8f, 0.0f};
+  const float other_way_goal_location[] = {1.5f, 0.9f, 0.0f};
+  const int other_way_corridor_face_indices[] = {1, 0, 2};
+  const float expected_other_way_corner_locations[] = {
+      1.0f, 1.0f, 0.0f, 1.5f, 0.9f, 0.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f,
+  };
+
+  check_corners("other way", other_way_location, other_way_goal_location, 3,
+                other_way_corridor_face_indices, corridor_link_indices, 4, 2,
+                expected_other_way_corner_locations);
+
+  const int single_corridor_face_indices[] = {1};
+  const float single_goal_location[] = {1.8f, 0.2f, 0.0f};
+  const float expected_single_corner_locations[] = {
+      1.8f, 0.2f, 0.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f,
+  };
+
+  check_corners("single", around_location, single_goal_location, 1,
+                single_corridor_face_indices, corridor_link_indices, 4, 1,
+                expected_single_corner_locations);
+
+  const int link_corridor_link_indices[] = {-1, 1, -1};
+  const float expected_link_corner_locations[] = {
+      0.5f, 0.75f, 0.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f,
+  };
+
+  check_corners("link", around_location, around_goal_location, 3,
+                corridor_face_indices, link_corridor_link_indices, 4, 1,
+                expected_link_corner_locations);
+
+  return exit_code;
+}
@@ -0,0 +1,41 @@
+#include "../../src/navigation_link_table.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int link_start_face_indices[] = {2, 1, 2, 0};
+  int face_link_offsets[] = {-1, -1, -1, -1, -1};
+  int face_link_indices[] = {-1, -1, -1, -1};
+
+  navigation_link_table(4, link_start_face_indices, 4, face_link_offsets,
+                        face_link_indices);
+
+  const int expected_face_link_offsets[] = {0, 1, 2, 4, 4};
+  const int expected_face_link_indices[] = {3, 1, 0, 2};
+
+  for (int index = 0; index < 5; index++) {
+    check_int("face link offset", "", expected_face_link_offsets[index],
+              face_link_offsets[index]);
+  }
+
+  for (int index = 0; index < 4; index++) {
+    check_int("face link index", "", expected_face_link_indices[index],
+              face_link_indices[index]);
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,152 @@
+#include "../../src/nearest_navigable_faces.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const int face_flags[] = {1, 2, 1, 1};
+
+static void filtered_scenario(const char *const description,
+                              const int face_count,
+                              const int *const face_indices,
+                              const int *const flags, const int include_flags,
+                              const int exclude_flags,
+                              const int maximum_results,
+                              const int expected_count,
+                              const int *const expected_face_indices,
+                              const float *const expected_distances_squared) {
+  const float location[] = {0.5f, 0.6f, 0.5f};
+  int result_face_indices[] = {-1, -1, -1, -1, -1};
+  float result_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+
+  const int actual_count = nearest_navigable_faces(
+      location, face_count, face_indices, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals, edge_normals,
+      edge_coefficients, flags, include_flags, exclude_flags, maximum_results,
+      result_face_indices, result_distances_squared);
+
+  check_int(description, "count", expected_count, actual_count);
+
+  for (int index = 0; index < expected_count; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_approximate(description, "distance squared",
+                      expected_distances_squared[index],
+                      result_distances_squared[index]);
+  }
+
+  for (int index = expected_count; index < 5; index++) {
+    check_int(description, "unused face index", -1,
+              result_face_indices[index]);
+    check_approximate(description, "unused distance squared", -1.0f,
+                      result_distances_squared[index]);
+  }
+}
+
+static void scenario(const char *const description, const int face_count,
+                     const int *const face_indices, const int maximum_results,
+                     const int expected_count,
+                     const int *const expected_face_indices,
+                     const float *const expected_distances_squared) {
+  filtered_scenario(description, face_count, face_indices, NULL, 0, 0,
+                    maximum_results, expected_count, expected_face_indices,
+                    expected_distances_squared);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int all_face_indices[] = {0, 2, 1, 3};
+  const float all_distances_squared[] = {0.25f, 0.41f, 0.5f, 2.25f};
+  scenario("all faces", 4, NULL, 5, 4, all_face_indices,
+           all_distances_squared);
+
+  scenario("exactly all faces", 4, NULL, 4, 4, all_face_indices,
+           all_distances_squared);
+
+  scenario("nearest two", 4, NULL, 2, 2, all_face_indices,
+           all_distances_squared);
+
+  scenario("nearest one", 4, NULL, 1, 1, all_face_indices,
+           all_distances_squared);
+
+  scenario("none requested", 4, NULL, 0, 0, NULL, NULL);
+
+  const int candidate_face_indices[] = {3, 1};
+  const float candidate_distances_squared[] = {0.5f, 2.25f};
+  const int candidate_expected_face_indices[] = {1, 3};
+  scenario("candidates", 2, candidate_face_indices, 5, 2,
+           candidate_expected_face_indices, candidate_distances_squared);
+
+  scenario("nearest candidate", 2, candidate_face_indices, 1, 1,
+           candidate_expected_face_indices, candidate_distances_squared);
+
+  scenario("no candidates", 0, candidate_face_indices, 5, 0, NULL, NULL);
+
+  const int excluded_face_indices[] = {0, 2, 3};
+  const float excluded_distances_squared[] = {0.25f, 0.41f, 2.25f};
+  filtered_scenario("excluded", 4, NULL, face_flags, 3, 2, 5, 3,
+                    excluded_face_indices, excluded_distances_squared);
+
+  const int included_face_indices[] = {1};
+  const float included_distances_squared[] = {0.5f};
+  filtered_scenario("included", 4, NULL, face_flags, 2, 0, 5, 1,
+                    included_face_indices, included_distances_squared);
+
+  filtered_scenario("nothing included", 4, NULL, face_flags, 4, 0, 5, 0, NULL,
+                    NULL);
+
+  return exit_code;
+}
@@ -0,0 +1,143 @@
+#include "../../src/nearest_navigable_faces.h"
+#include "../../src/nearest_navigable_faces_in_grid.h"
+#include "../../src/navigable_face_grid.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  int bucket_face_offsets[17];
+  int bucket_face_indices[16];
+
+  navigable_face_grid(4, face_vertex_counts, face_vertex_offsets,
+                      face_vertex_locations, 1.0f, 16, 16, bucket_face_offsets,
+                      bucket_face_indices);
+
+  const float locations[] = {
+      0.5f, 0.5f,  0.4f, 0.5f, 0.5f,  1.7f, 1.5f, 0.5f,  0.4f,  0.2f, 1.8f,
+      0.3f, 3.0f,  3.0f, 1.0f, -2.0f, 0.5f, 0.7f, 10.0f, 10.0f, 0.0f, 1.2f,
+      1.3f, -0.5f,
+  };
+
+  const int face_flags[] = {1, 2, 1, 1};
+  const int include_flags[] = {0, 1, 3, 2};
+  const int exclude_flags[] = {0, 0, 1, 0};
+
+  for (int filter = 0; filter < 4; filter++) {
+    const int *const flags = filter == 0 ? NULL : face_flags;
+
+    for (int index = 0; index < 8; index++) {
+      for (int maximum_results = 1; maximum_results <= 4; maximum_results++) {
+        int expected_face_indices[] = {-1, -1, -1, -1, -1};
+        float expected_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f,
+                                              -1.0f};
+        int result_face_indices[] = {-1, -1, -1, -1, -1};
+        float result_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f,
+                                            -1.0f};
+
+        check_int("unbounded", "count",
+                  nearest_navigable_faces(
+                      locations + index * 3, 4, NULL, face_vertex_counts,
+                      face_vertex_offsets, face_vertex_locations,
+                      face_normals, edge_normals, edge_coefficients, flags,
+                      include_flags[filter], exclude_flags[filter],
+                      maximum_results, expected_face_indices,
+                      expected_distances_squared),
+                  nearest_navigable_faces_in_grid(
+                      locations + index * 3, 1.0f, 16, bucket_face_offsets,
+                      bucket_face_indices, 16, face_vertex_counts,
+                      face_vertex_offsets, face_vertex_locations,
+                      face_normals, edge_normals, edge_coefficients, flags,
+                      include_flags[filter], exclude_flags[filter],
+                      maximum_results, result_face_indices,
+                      result_distances_squared));
+
+        for (int result_index = 0; result_index < 5; result_index++) {
+          check_int("unbounded", "face index",
+                    expected_face_indices[result_index],
+                    result_face_indices[result_index]);
+          check_approximate("unbounded", "distance squared",
+                            expected_distances_squared[result_index],
+                            result_distances_squared[result_index]);
+        }
+      }
+    }
+  }
+
+  {
+    int result_face_indices[] = {-1, -1, -1, -1, -1};
+    float result_distances_squared[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+
+    check_int("bounded", "count", 3,
+              nearest_navigable_faces_in_grid(
+                  locations + 6, 1.0f, 16, bucket_face_offsets,
+                  bucket_face_indices, 0, face_vertex_counts,
+                  face_vertex_offsets, face_vertex_locations, face_normals,
+                  edge_normals, edge_coefficients, NULL, 0, 0, 4,
+                  result_face_indices, result_distances_squared));
+
+    const int expected_face_indices[] = {1, 0, 3, -1, -1};
+
+    for (int result_index = 0; result_index < 5; result_index++) {
+      check_int("bounded", "face index", expected_face_indices[result_index],
+                result_face_indices[result_index]);
+    }
+  }
+
+  return exit_code;
+}
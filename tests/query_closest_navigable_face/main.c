@@ -0,0 +1,135 @@
+#include "../../src/closest_navigable_face.h"
+#include "../../src/initialize_navigation_query_context.h"
+#include "../../src/navigation_mesh.h"
+#include "../../src/navigation_query_context.h"
+#include "../../src/query_closest_navigable_face.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int face_flags[] = {1, 2, 1, 1};
+  const struct navigation_mesh mesh = {
+      4,
+      face_vertex_counts,
+      face_vertex_offsets,
+      face_vertex_locations,
+      face_normals,
+      edge_normals,
+      NULL,
+      edge_coefficients,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      face_flags,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+  };
+
+  unsigned char scratch[1];
+  union navigation_query_context context;
+  initialize_navigation_query_context(scratch, 1, &context);
+
+  const float locations[] = {
+      0.5f, 0.5f, 0.4f, 0.5f, 0.5f, 1.7f, 1.5f, 0.5f, 0.4f, 0.2f, 1.8f, 0.3f,
+  };
+
+  for (int index = 0; index < 4; index++) {
+    const int expected = closest_navigable_face(
+        locations + index * 3, 4, face_vertex_counts, face_vertex_offsets,
+        face_vertex_locations, face_normals, edge_normals, edge_coefficients,
+        face_flags, 3, 0);
+
+    check_int("location", "face index", expected,
+              query_closest_navigable_face(&mesh, &context,
+                                           locations + index * 3, 3, 0));
+    check_int("location", "face index hint", expected,
+              context.state.face_index_hint);
+    check_int("location", "query count", index + 1, context.state.query_count);
+  }
+
+  check_int("no faces considered", "face index", -1,
+            query_closest_navigable_face(&mesh, &context, locations, 0, 0));
+  check_int("no faces considered", "face index hint", 2,
+            context.state.face_index_hint);
+  check_int("no faces considered", "query count", 5,
+            context.state.query_count);
+  check_int("no faces considered", "scratch used", 0,
+            context.state.scratch_used);
+
+  const float ground_location[] = {0.5f, 0.5f, 0.4f};
+
+  context.state.face_index_hint = 3;
+  check_int("farther hint", "face index", 0,
+            query_closest_navigable_face(&mesh, &context, ground_location, 3,
+                                         0));
+  check_int("farther hint", "face index hint", 0,
+            context.state.face_index_hint);
+
+  context.state.face_index_hint = 0;
+  check_int("excluded hint", "face index", 1,
+            query_closest_navigable_face(&mesh, &context, ground_location, 3,
+                                         1));
+  check_int("excluded hint", "face index hint", 1,
+            context.state.face_index_hint);
+
+  context.state.face_index_hint = 9;
+  check_int("hint out of range", "face index", 0,
+            query_closest_navigable_face(&mesh, &context, ground_location, 3,
+                                         0));
+  check_int("hint out of range", "face index hint", 0,
+            context.state.face_index_hint);
+
+  return exit_code;
+}
@@ -0,0 +1,152 @@
+#include "../../src/find_navigation_path_scratch_size.h"
+#include "../../src/initialize_navigation_query_context.h"
+#include "../../src/navigation_mesh.h"
+#include "../../src/navigation_query_context.h"
+#include "../../src/navigation_scratch.h"
+#include "../../src/query_navigation_path.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int link_end_face_indices[] = {3, 3};
+
+static const float link_start_locations[] = {0.2f, 1.5f, 0.0f,
+                                             1.5f, 0.5f, 0.0f};
+
+static const float link_end_locations[] = {0.2f, 0.8f, 2.0f,
+                                           0.9f, 0.5f, 2.0f};
+
+static const float link_costs[] = {1.0f, 5.0f};
+
+static const int link_flags[] = {1, 2};
+
+static const int face_link_offsets[] = {0, 0, 1, 2, 2};
+
+static const int face_link_indices[] = {1, 0};
+
+static double storage[32];
+
+static void check(const char *const description, const int scratch_capacity,
+                  const int *const links, const float *const goal_location,
+                  const int goal_face_index, const int exclude_flags,
+                  const int expected_result,
+                  const int *const expected_face_indices,
+                  const int *const expected_link_indices,
+                  const int expected_scratch_exhausted_count) {
+  const int face_flags[] = {1, 1, 4, 1};
+  const struct navigation_mesh mesh = {
+      4,
+      face_vertex_counts,
+      face_vertex_offsets,
+      face_vertex_locations,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      NULL,
+      face_edge_neighbor_counts,
+      face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices,
+      face_flags,
+      NULL,
+      links,
+      face_link_indices,
+      link_end_face_indices,
+      link_start_locations,
+      link_end_locations,
+      link_costs,
+      link_flags,
+  };
+  const float start_location[] = {1.5f, 0.5f, 0.0f};
+  int result_face_indices[] = {-1, -1, -1, -1};
+  int result_link_indices[] = {-2, -2, -2, -2};
+
+  union navigation_query_context context;
+  initialize_navigation_query_context((unsigned char *)storage,
+                                      scratch_capacity, &context);
+
+  check_int(description, "result", expected_result,
+            query_navigation_path(&mesh, &context, start_location, 1,
+                                  goal_location, goal_face_index, 7,
+                                  exclude_flags, 4, result_face_indices,
+                                  result_link_indices));
+
+  for (int index = 0; index < 4; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int(description, "link index", expected_link_indices[index],
+              result_link_indices[index]);
+  }
+
+  check_int(description, "query count", 1, context.state.query_count);
+  check_int(description, "scratch exhausted count",
+            expected_scratch_exhausted_count,
+            context.state.scratch_exhausted_count);
+  check_int(description, "scratch used", 0, context.state.scratch_used);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float triangle_goal[] = {0.2f, 1.2f, 0.0f};
+  const float upper_goal[] = {0.5f, 0.5f, 2.0f};
+  const int none[] = {-1, -1, -1, -1};
+  const int untouched[] = {-2, -2, -2, -2};
+
+  {
+    const int expected_face_indices[] = {1, 0, 2, -1};
+    const int expected_link_indices[] = {-1, -1, -1, -2};
+    check("found", find_navigation_path_scratch_size(4), NULL, triangle_goal,
+          2, 0, 3, expected_face_indices, expected_link_indices, 0);
+  }
+
+  {
+    const int expected_face_indices[] = {1, 0, 2, 3};
+    const int expected_link_indices[] = {-1, -1, -1, 0};
+    check("link", find_navigation_path_scratch_size(4), face_link_offsets,
+          upper_goal, 3, 0, 4, expected_face_indices, expected_link_indices,
+          0);
+  }
+
+  check("links ignored", find_navigation_path_scratch_size(4), NULL,
+        upper_goal, 3, 0, -1, none, untouched, 0);
+
+  check("not found", find_navigation_path_scratch_size(4), NULL,
+        triangle_goal, 2, 4, -1, none, untouched, 0);
+
+  check("scratch exhausted", 100, NULL, triangle_goal, 2, 0,
+        NAVIGATION_SCRATCH_EXHAUSTED, none, untouched, 1);
+
+  return exit_code;
+}
@@ -0,0 +1,191 @@
+#include "../../src/rebake_navigable_faces.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float edge_exit_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float vertex_up_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float tilted_face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float tilted_face_normals[] = {
+    0.0f, 0.0f, 1.0f, -0.7071068f, 0.0f, 0.7071068f, 0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 1.0f,
+};
+
+static const float tilted_edge_normals[] = {
+    0.0f,        -1.0f,      0.0f,        1.0f,       0.0f,  0.0f, 0.0f,
+    1.0f,        0.0f,       -1.0f,       0.0f,       0.0f,  0.0f, -1.0f,
+    0.0f,        0.7071068f, 0.0f,        0.7071068f, 0.0f,  1.0f, 0.0f,
+    -0.7071068f, 0.0f,       -0.7071068f, 0.0f,       -1.0f, 0.0f, 0.7071068f,
+    0.7071068f,  0.0f,       -1.0f,       0.0f,       0.0f,  0.0f, -1.0f,
+    0.0f,        1.0f,       0.0f,        0.0f,       0.0f,  1.0f, 0.0f,
+    -1.0f,       0.0f,       0.0f,
+};
+
+static const float tilted_edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f,  0.0f, -1.0f, 0.0f,
+    0.5f, 0.0f, 0.5f, 0.0f,  1.0f, 0.0f, -0.5f, 0.0f,  -0.5f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f,  1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float tilted_edge_exit_normals[] = {
+    0.0f,  -1.0f, 0.0f, 0.9238795f,  0.0f,       0.3826834f,
+    0.0f,  1.0f,  0.0f, -1.0f,       0.0f,       0.0f,
+    0.0f,  -1.0f, 0.0f, 0.7071068f,  0.0f,       0.7071068f,
+    0.0f,  1.0f,  0.0f, -0.9238795f, 0.0f,       -0.3826834f,
+    0.0f,  -1.0f, 0.0f, 0.7071068f,  0.7071068f, 0.0f,
+    -1.0f, 0.0f,  0.0f, 0.0f,        -1.0f,      0.0f,
+    1.0f,  0.0f,  0.0f, 0.0f,        1.0f,       0.0f,
+    -1.0f, 0.0f,  0.0f,
+};
+
+static const float tilted_vertex_up_normals[] = {
+    0.0f,        0.0f, 1.0f,       -0.3826834f, 0.0f, 0.9238795f,
+    -0.3826834f, 0.0f, 0.9238795f, 0.0f,        0.0f, 1.0f,
+    -0.3826834f, 0.0f, 0.9238795f, -0.7071068f, 0.0f, 0.7071068f,
+    -0.7071068f, 0.0f, 0.7071068f, -0.3826834f, 0.0f, 0.9238795f,
+    0.0f,        0.0f, 1.0f,       0.0f,        0.0f, 1.0f,
+    0.0f,        0.0f, 1.0f,       0.0f,        0.0f, 1.0f,
+    0.0f,        0.0f, 1.0f,       0.0f,        0.0f, 1.0f,
+    0.0f,        0.0f, 1.0f,
+};
+
+static void check_all(const char *const description,
+                      const float *const expected_face_normals,
+                      const float *const expected_edge_normals,
+                      const float *const expected_edge_exit_normals,
+                      const float *const expected_edge_coefficients,
+                      const float *const expected_vertex_up_normals,
+                      const float *const actual_face_normals,
+                      const float *const actual_edge_normals,
+                      const float *const actual_edge_exit_normals,
+                      const float *const actual_edge_coefficients,
+                      const float *const actual_vertex_up_normals) {
+  for (int index = 0; index < 12; index++) {
+    check_approximate(description, "face normal", expected_face_normals[index],
+                      actual_face_normals[index]);
+  }
+
+  for (int index = 0; index < 45; index++) {
+    check_approximate(description, "edge normal", expected_edge_normals[index],
+                      actual_edge_normals[index]);
+    check_approximate(description, "edge exit normal",
+                      expected_edge_exit_normals[index],
+                      actual_edge_exit_normals[index]);
+    check_approximate(description, "edge coefficient",
+                      expected_edge_coefficients[index],
+                      actual_edge_coefficients[index]);
+    check_approximate(description, "vertex up normal",
+                      expected_vertex_up_normals[index],
+                      actual_vertex_up_normals[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  float result_face_normals[12] = {0};
+  float result_edge_normals[45] = {0};
+  float result_edge_exit_normals[45] = {0};
+  float result_edge_coefficients[45] = {0};
+  float result_vertex_up_normals[45] = {0};
+  const int all_face_indices[] = {0, 1, 2, 3};
+
+  rebake_navigable_faces(4, all_face_indices, face_vertex_counts,
+                         face_vertex_offsets, face_vertex_locations,
+                         face_edge_neighbor_counts, face_edge_neighbor_offsets,
+                         face_edge_neighbor_face_indices, result_face_normals,
+                         result_edge_normals, result_edge_exit_normals,
+                         result_edge_coefficients, result_vertex_up_normals);
+
+  check_all("all faces", face_normals, edge_normals, edge_exit_normals,
+            edge_coefficients, vertex_up_normals, result_face_normals,
+            result_edge_normals, result_edge_exit_normals,
+            result_edge_coefficients, result_vertex_up_normals);
+
+  const int dirty_face_indices[] = {1};
+
+  rebake_navigable_faces(1, dirty_face_indices, face_vertex_counts,
+                         face_vertex_offsets, tilted_face_vertex_locations,
+                         face_edge_neighbor_counts, face_edge_neighbor_offsets,
+                         face_edge_neighbor_face_indices, result_face_normals,
+                         result_edge_normals, result_edge_exit_normals,
+                         result_edge_coefficients, result_vertex_up_normals);
+
+  check_all("tilted face", tilted_face_normals, tilted_edge_normals,
+            tilted_edge_exit_normals, tilted_edge_coefficients,
+            tilted_vertex_up_normals, result_face_normals, result_edge_normals,
+            result_edge_exit_normals, result_edge_coefficients,
+            result_vertex_up_normals);
+
+  return exit_code;
+}
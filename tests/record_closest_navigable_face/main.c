@@ -0,0 +1,155 @@
+#include "../../src/navigation_recording.h"
+#include "../../src/record_closest_navigable_face.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static float read_float(const unsigned char *const bytes) {
+  float value;
+  unsigned char *const destination = (unsigned char *)&value;
+
+  for (int index = 0; index < (int)sizeof(value); index++) {
+    destination[index] = bytes[index];
+  }
+
+  return value;
+}
+
+static int read_int(const unsigned char *const bytes) {
+  int value;
+  unsigned char *const destination = (unsigned char *)&value;
+
+  for (int index = 0; index < (int)sizeof(value); index++) {
+    destination[index] = bytes[index];
+  }
+
+  return value;
+}
+
+static void check_untouched(const char *const description,
+                            const unsigned char *const recording,
+                            const int from, const int to) {
+  for (int index = from; index < to; index++) {
+    check_int(description, "untouched byte", 170, recording[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  unsigned char recording[128];
+
+  for (int index = 0; index < 128; index++) {
+    recording[index] = 170;
+  }
+
+  int recording_length = 3;
+  const float location[] = {1.6f, 0.4f, 0.3f};
+  const int face_flags[] = {1, 2, 1, 1};
+
+  check_int("fits", "face index", 1,
+            record_closest_navigable_face(
+                location, 4, face_vertex_counts, face_vertex_offsets,
+                face_vertex_locations, face_normals, edge_normals,
+                edge_coefficients, face_flags, 3, 4,
+                3 + NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE,
+                recording, &recording_length));
+
+  check_int("fits", "recording length",
+            3 + NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE,
+            recording_length);
+  check_untouched("fits", recording, 0, 3);
+  check_int("fits", "type", NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE,
+            recording[3]);
+  check_exact("fits", "location x", 1.6f, read_float(recording + 4));
+  check_exact("fits", "location y", 0.4f, read_float(recording + 8));
+  check_exact("fits", "location z", 0.3f, read_float(recording + 12));
+  check_int("fits", "face count", 4, read_int(recording + 16));
+  check_int("fits", "filtered", 1, recording[20]);
+  check_int("fits", "include flags", 3, read_int(recording + 21));
+  check_int("fits", "exclude flags", 4, read_int(recording + 25));
+  check_int("fits", "result", 1, read_int(recording + 29));
+  check_untouched("fits", recording, 33, 128);
+
+  check_int("overflows", "face index", 0,
+            record_closest_navigable_face(
+                location, 4, face_vertex_counts, face_vertex_offsets,
+                face_vertex_locations, face_normals, edge_normals,
+                edge_coefficients, face_flags, 1, 0,
+                3 + NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE * 2 - 1,
+                recording, &recording_length));
+
+  check_int("overflows", "recording length",
+            3 + NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE * 2,
+            recording_length);
+  check_untouched("overflows", recording, 33, 128);
+
+  recording_length = 0;
+
+  check_int("unfiltered", "face index", 1,
+            record_closest_navigable_face(
+                location, 4, face_vertex_counts, face_vertex_offsets,
+                face_vertex_locations, face_normals, edge_normals,
+                edge_coefficients, NULL, 0, 0, 128, recording,
+                &recording_length));
+
+  check_int("unfiltered", "recording length",
+            NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE,
+            recording_length);
+  check_int("unfiltered", "filtered", 0, recording[17]);
+  check_int("unfiltered", "result", 1, read_int(recording + 26));
+
+  return exit_code;
+}
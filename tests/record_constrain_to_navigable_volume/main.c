@@ -0,0 +1,162 @@
+#include "../../src/navigation_recording.h"
+#include "../../src/record_constrain_to_navigable_volume.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const float edge_exit_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float vertex_up_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static float read_float(const unsigned char *const bytes) {
+  float value;
+  unsigned char *const destination = (unsigned char *)&value;
+
+  for (int index = 0; index < (int)sizeof(value); index++) {
+    destination[index] = bytes[index];
+  }
+
+  return value;
+}
+
+static int read_int(const unsigned char *const bytes) {
+  int value;
+  unsigned char *const destination = (unsigned char *)&value;
+
+  for (int index = 0; index < (int)sizeof(value); index++) {
+    destination[index] = bytes[index];
+  }
+
+  return value;
+}
+
+static void check_untouched(const char *const description,
+                            const unsigned char *const recording,
+                            const int from, const int to) {
+  for (int index = from; index < to; index++) {
+    check_int(description, "untouched byte", 170, recording[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  unsigned char recording[128];
+
+  for (int index = 0; index < 128; index++) {
+    recording[index] = 170;
+  }
+
+  int recording_length = 3;
+  const int size = NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME_SIZE;
+  float location[] = {2.4f, 0.5f, 0.3f};
+  float constrained_location[3];
+
+  record_constrain_to_navigable_volume(
+      location, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals, edge_normals,
+      edge_coefficients, vertex_up_normals, 1, constrained_location, 3 + size,
+      recording, &recording_length);
+
+  check_exact("fits", "constrained location x", 2.0f, constrained_location[0]);
+  check_exact("fits", "constrained location y", 0.5f, constrained_location[1]);
+  check_exact("fits", "constrained location z", 0.3f, constrained_location[2]);
+  check_int("fits", "recording length", 3 + size, recording_length);
+  check_untouched("fits", recording, 0, 3);
+  check_int("fits", "type", NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME,
+            recording[3]);
+  check_exact("fits", "location x", 2.4f, read_float(recording + 4));
+  check_exact("fits", "location y", 0.5f, read_float(recording + 8));
+  check_exact("fits", "location z", 0.3f, read_float(recording + 12));
+  check_int("fits", "face index", 1, read_int(recording + 16));
+  check_exact("fits", "result x", 2.0f, read_float(recording + 20));
+  check_exact("fits", "result y", 0.5f, read_float(recording + 24));
+  check_exact("fits", "result z", 0.3f, read_float(recording + 28));
+  check_untouched("fits", recording, 32, 128);
+
+  record_constrain_to_navigable_volume(
+      location, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals, edge_normals,
+      edge_coefficients, vertex_up_normals, 1, constrained_location,
+      3 + size * 2 - 1, recording, &recording_length);
+
+  check_int("overflows", "recording length", 3 + size * 2, recording_length);
+  check_untouched("overflows", recording, 32, 128);
+
+  recording_length = 0;
+
+  record_constrain_to_navigable_volume(
+      location, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals, edge_normals,
+      edge_coefficients, vertex_up_normals, 1, location, 128, recording,
+      &recording_length);
+
+  check_exact("in place", "location x", 2.0f, location[0]);
+  check_exact("in place", "recorded location x", 2.4f,
+              read_float(recording + 1));
+  check_exact("in place", "result x", 2.0f, read_float(recording + 17));
+
+  return exit_code;
+}
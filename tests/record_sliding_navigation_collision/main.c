@@ -0,0 +1,164 @@
+#include "../../src/navigation_recording.h"
+#include "../../src/record_sliding_navigation_collision.h"
+#include "../../src/sliding_navigation_collision_result.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_exit_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static float read_float(const unsigned char *const bytes) {
+  float value;
+  unsigned char *const destination = (unsigned char *)&value;
+
+  for (int index = 0; index < (int)sizeof(value); index++) {
+    destination[index] = bytes[index];
+  }
+
+  return value;
+}
+
+static int read_int(const unsigned char *const bytes) {
+  int value;
+  unsigned char *const destination = (unsigned char *)&value;
+
+  for (int index = 0; index < (int)sizeof(value); index++) {
+    destination[index] = bytes[index];
+  }
+
+  return value;
+}
+
+static void check_untouched(const char *const description,
+                            const unsigned char *const recording,
+                            const int from, const int to) {
+  for (int index = from; index < to; index++) {
+    check_int(description, "untouched byte", 170, recording[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  unsigned char recording[128];
+
+  for (int index = 0; index < 128; index++) {
+    recording[index] = 170;
+  }
+
+  int recording_length = 3;
+  const int size = NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION_SIZE;
+  float from[] = {0.5f, 0.5f, 0.5f};
+  float to[] = {0.5f, -0.5f, 0.5f};
+  float result_from[3];
+  float result_to[3];
+  int edge_index = 7;
+
+  check_int("fits", "result", SLIDING_NAVIGATION_COLLISION_RESULT_EDGE,
+            record_sliding_navigation_collision(
+                from, 0, to, face_vertex_counts, face_vertex_offsets,
+                face_vertex_locations, face_normals, edge_exit_normals,
+                face_edge_neighbor_counts, result_from, result_to,
+                &edge_index, 3 + size, recording, &recording_length));
+
+  check_int("fits", "edge index", 0, edge_index);
+  check_int("fits", "recording length", 3 + size, recording_length);
+  check_untouched("fits", recording, 0, 3);
+  check_int("fits", "type", NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION,
+            recording[3]);
+  check_exact("fits", "from x", 0.5f, read_float(recording + 4));
+  check_exact("fits", "from y", 0.5f, read_float(recording + 8));
+  check_exact("fits", "from z", 0.5f, read_float(recording + 12));
+  check_int("fits", "face index", 0, read_int(recording + 16));
+  check_exact("fits", "to x", 0.5f, read_float(recording + 20));
+  check_exact("fits", "to y", -0.5f, read_float(recording + 24));
+  check_exact("fits", "to z", 0.5f, read_float(recording + 28));
+  check_int("fits", "recorded result",
+            SLIDING_NAVIGATION_COLLISION_RESULT_EDGE, read_int(recording + 32));
+  check_exact("fits", "result from x", result_from[0],
+              read_float(recording + 36));
+  check_exact("fits", "result from y", result_from[1],
+              read_float(recording + 40));
+  check_exact("fits", "result from z", result_from[2],
+              read_float(recording + 44));
+  check_exact("fits", "result to x", result_to[0], read_float(recording + 48));
+  check_exact("fits", "result to y", result_to[1], read_float(recording + 52));
+  check_exact("fits", "result to z", result_to[2], read_float(recording + 56));
+  check_int("fits", "recorded edge index", 0, read_int(recording + 60));
+  check_untouched("fits", recording, 64, 128);
+
+  record_sliding_navigation_collision(
+      from, 0, to, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_exit_normals,
+      face_edge_neighbor_counts, result_from, result_to, &edge_index,
+      3 + size * 2 - 1, recording, &recording_length);
+
+  check_int("overflows", "recording length", 3 + size * 2, recording_length);
+  check_untouched("overflows", recording, 64, 128);
+
+  recording_length = 0;
+  to[1] = 0.6f;
+  edge_index = 7;
+
+  check_int("in place", "result", SLIDING_NAVIGATION_COLLISION_RESULT_NONE,
+            record_sliding_navigation_collision(
+                from, 0, to, face_vertex_counts, face_vertex_offsets,
+                face_vertex_locations, face_normals, edge_exit_normals,
+                face_edge_neighbor_counts, from, to, &edge_index, 128,
+                recording, &recording_length));
+
+  check_int("in place", "recording length", size, recording_length);
+  check_exact("in place", "from y", 0.5f, read_float(recording + 5));
+  check_exact("in place", "to y", 0.6f, read_float(recording + 21));
+  check_int("in place", "recorded result",
+            SLIDING_NAVIGATION_COLLISION_RESULT_NONE, read_int(recording + 29));
+  check_exact("in place", "result to y", 0.6f, read_float(recording + 49));
+  check_int("in place", "recorded edge index", -1, read_int(recording + 57));
+
+  return exit_code;
+}
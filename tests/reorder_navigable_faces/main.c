@@ -0,0 +1,152 @@
+#include "../../src/reorder_navigable_faces.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static void check_ints(const char *const description, const int count,
+                       const int *const expected, const int *const actual) {
+  for (int index = 0; index < count; index++) {
+    check_int(description, "value", expected[index], actual[index]);
+  }
+}
+
+static void check_floats(const char *const description, const int count,
+                         const float *const expected,
+                         const float *const actual) {
+  for (int index = 0; index < count; index++) {
+    check_exact(description, "value", expected[index], actual[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const int face_order[] = {2, 0, 3, 1};
+
+  int result_face_vertex_counts[4];
+  int result_face_vertex_offsets[4];
+  float result_face_vertex_locations[45];
+  float result_face_normals[12];
+  float result_edge_normals[45];
+  int result_face_edge_neighbor_counts[15];
+  int result_face_edge_neighbor_offsets[15];
+  int result_face_edge_neighbor_face_indices[4];
+  int result_face_indices[4];
+
+  reorder_navigable_faces(
+      4, face_order, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_normals, NULL, NULL, NULL,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, result_face_vertex_counts,
+      result_face_vertex_offsets, result_face_vertex_locations,
+      result_face_normals, result_edge_normals, NULL, NULL, NULL,
+      result_face_edge_neighbor_counts, result_face_edge_neighbor_offsets,
+      result_face_edge_neighbor_face_indices, result_face_indices);
+
+  const int expected_face_vertex_counts[] = {3, 4, 4, 4};
+
+  const int expected_face_vertex_offsets[] = {0, 3, 7, 11};
+
+  const float expected_face_vertex_locations[] = {
+      0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+      1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+      1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f, 1.0f, 0.0f, 0.0f,
+      2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+  };
+
+  const float expected_face_normals[] = {
+      0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+  };
+
+  const float expected_edge_normals[] = {
+      0.0f,  -1.0f, 0.0f, 0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f,
+      0.0f,  -1.0f, 0.0f, 1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f,
+      -1.0f, 0.0f,  0.0f, 0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f,
+      0.0f,  1.0f,  0.0f, -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f,
+      1.0f,  0.0f,  0.0f, 0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f,
+  };
+
+  const int expected_face_edge_neighbor_counts[] = {1, 0, 0, 0, 1, 1, 0, 0, 0,
+                                                    0, 0, 0, 0, 0, 1};
+
+  const int expected_face_edge_neighbor_offsets[] = {0, 1, 1, 1, 1, 2, 3, 3, 3,
+                                                     3, 3, 3, 3, 3, 3};
+
+  const int expected_face_edge_neighbor_face_indices[] = {1, 3, 0, 1};
+
+  const int expected_face_indices[] = {1, 3, 0, 2};
+
+  check_ints("face vertex counts", 4, expected_face_vertex_counts,
+             result_face_vertex_counts);
+  check_ints("face vertex offsets", 4, expected_face_vertex_offsets,
+             result_face_vertex_offsets);
+  check_floats("face vertex locations", 45, expected_face_vertex_locations,
+               result_face_vertex_locations);
+  check_floats("face normals", 12, expected_face_normals, result_face_normals);
+  check_floats("edge normals", 45, expected_edge_normals, result_edge_normals);
+  check_ints("face edge neighbor counts", 15,
+             expected_face_edge_neighbor_counts,
+             result_face_edge_neighbor_counts);
+  check_ints("face edge neighbor offsets", 15,
+             expected_face_edge_neighbor_offsets,
+             result_face_edge_neighbor_offsets);
+  check_ints("face edge neighbor face indices", 4,
+             expected_face_edge_neighbor_face_indices,
+             result_face_edge_neighbor_face_indices);
+  check_ints("face indices", 4, expected_face_indices, result_face_indices);
+
+  return exit_code;
+}
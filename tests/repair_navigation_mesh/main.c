@@ -0,0 +1,152 @@
+#include "../../src/repair_navigation_mesh.h"
+#include "../../src/validate_navigation_mesh.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const int unrepaired_face_vertex_counts[] = {4, 4, 3, 4, 4, 2, 4};
+
+static const int unrepaired_face_vertex_offsets[] = {0, 4, 8, 11, 15, 19, 21};
+
+static const float unrepaired_face_vertex_locations[] = {
+    0.0f, 0.0f,    0.0f, 1.0f, 0.0f, 0.0f, 1.0f,    1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 1.0004f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f,    2.0f, 1.0f, 0.0f, 1.0f,
+    1.0f, 0.0f,    0.0f, 1.0f, 0.0f, 1.0f, 1.0003f, 0.0f, 0.0f, 2.0f, 0.0f,
+    0.0f, 0.0f,    2.0f, 1.0f, 0.0f, 2.0f, 1.0f,    1.0f, 2.0f, 0.0f, 1.0f,
+    2.0f, 3.0f,    0.0f, 0.0f, 4.0f, 0.0f, 0.0f,    4.0f, 1.0f, 1.0f, 3.0f,
+    1.0f, 0.0f,    8.0f, 0.0f, 0.0f, 9.0f, 0.0f,    0.0f, 5.0f, 0.0f, 0.0f,
+    6.0f, 0.0f,    0.0f, 6.0f, 0.0f, 0.0f, 6.0f,    1.0f, 0.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  int bucket_first_vertices[8];
+  int vertex_next_indices[25];
+  int vertex_weld_indices[25];
+  int result_face_indices[11];
+  int result_face_vertex_counts[11];
+  int result_face_vertex_offsets[11];
+  float result_face_vertex_locations[99];
+  float result_face_normals[33];
+  float result_edge_normals[99];
+  float result_edge_coefficients[99];
+
+  check_int("repair", "face count", 7,
+            repair_navigation_mesh(
+                7, unrepaired_face_vertex_counts,
+                unrepaired_face_vertex_offsets,
+                unrepaired_face_vertex_locations, 0.001f, 0.001f, 8,
+                bucket_first_vertices, vertex_next_indices,
+                vertex_weld_indices, result_face_indices,
+                result_face_vertex_counts, result_face_vertex_offsets,
+                result_face_vertex_locations, result_face_normals,
+                result_edge_normals, result_edge_coefficients));
+
+  const int expected_vertex_weld_indices[] = {
+      0,  1,  2,  3,  1,  5,  6,  2,  3,  2,  10, 11, 12,
+      13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 22, 24,
+  };
+
+  for (int index = 0; index < 25; index++) {
+    check_int("repair", "vertex weld index",
+              expected_vertex_weld_indices[index], vertex_weld_indices[index]);
+  }
+
+  const int expected_face_indices[] = {0, 1, 2, 3, 4, 4, 6};
+  const int expected_face_vertex_counts[] = {4, 4, 3, 4, 3, 3, 3};
+  const int expected_face_vertex_offsets[] = {0, 4, 8, 11, 15, 18, 21};
+  const float expected_face_vertex_locations[] = {
+      0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+      1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+      0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+      1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f, 3.0f, 0.0f, 0.0f,
+      4.0f, 0.0f, 0.0f, 4.0f, 1.0f, 1.0f, 3.0f, 0.0f, 0.0f, 4.0f, 1.0f, 1.0f,
+      3.0f, 1.0f, 0.0f, 5.0f, 0.0f, 0.0f, 6.0f, 0.0f, 0.0f, 6.0f, 1.0f, 0.0f,
+  };
+  const float expected_face_normals[] = {
+      0.0f, 0.0f,       1.0f, 0.0f, 0.0f, 1.0f,        0.0f,       0.0f,
+      1.0f, 0.0f,       0.0f, 1.0f, 0.0f, -0.7071068f, 0.7071068f, -0.7071068f,
+      0.0f, 0.7071068f, 0.0f, 0.0f, 1.0f,
+  };
+
+  for (int index = 0; index < 7; index++) {
+    check_int("repair", "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int("repair", "face vertex count",
+              expected_face_vertex_counts[index],
+              result_face_vertex_counts[index]);
+    check_int("repair", "face vertex offset",
+              expected_face_vertex_offsets[index],
+              result_face_vertex_offsets[index]);
+  }
+
+  for (int index = 0; index < 72; index++) {
+    check_approximate("repair", "face vertex location",
+                      expected_face_vertex_locations[index],
+                      result_face_vertex_locations[index]);
+  }
+
+  for (int index = 0; index < 21; index++) {
+    check_approximate("repair", "face normal", expected_face_normals[index],
+                      result_face_normals[index]);
+  }
+
+  for (int index = 0; index < 45; index++) {
+    check_approximate("repair", "edge normal", edge_normals[index],
+                      result_edge_normals[index]);
+    check_approximate("repair", "edge coefficient", edge_coefficients[index],
+                      result_edge_coefficients[index]);
+  }
+
+  int result_violation_types[1];
+  int result_violation_face_indices[1];
+  int result_violation_edge_indices[1];
+
+  check_int("repair", "violation count", 0,
+            validate_navigation_mesh(
+                7, result_face_vertex_counts, result_face_vertex_offsets,
+                result_face_vertex_locations, result_face_normals,
+                result_edge_normals, result_edge_coefficients, 0.001f, 1,
+                result_violation_types, result_violation_face_indices,
+                result_violation_edge_indices));
+
+  return exit_code;
+}
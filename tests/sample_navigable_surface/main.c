@@ -0,0 +1,81 @@
+#include "../../src/sample_navigable_surface.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_fan_areas[] = {
+    0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.0f, 0.5f, 0.0f,
+    0.0f, 0.5f, 1.0f,
+};
+
+static const float cumulative_face_areas[] = {1.0f, 2.0f, 2.5f, 3.5f};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float random_numbers[] = {
+      0.0f, 0.0f, 0.0f, 0.5f, 0.25f, 0.25f, 0.6f, 0.75f, 0.5f, 0.99f, 0.1f,
+      0.2f,
+  };
+  int result_face_indices[] = {-1, -1, -1, -1, -1};
+  float result_locations[] = {
+      -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+  };
+
+  sample_navigable_surface(4, random_numbers, 4, face_vertex_counts,
+                           face_vertex_offsets, face_vertex_locations,
+                           face_fan_areas, cumulative_face_areas,
+                           result_face_indices, result_locations);
+
+  const int expected_face_indices[] = {0, 1, 2, 3, -1};
+  const float expected_locations[] = {
+      0.0f, 0.0f,  0.0f,  1.25f, 0.5f, 0.0f, 0.25f, 1.5f, 0.0f, 0.1f, 0.3f,
+      2.0f, -1.0f, -1.0f, -1.0f,
+  };
+
+  for (int index = 0; index < 5; index++) {
+    check_int("samples", "face index", expected_face_indices[index],
+              result_face_indices[index]);
+  }
+
+  for (int index = 0; index < 15; index++) {
+    check_approximate("samples", "location", expected_locations[index],
+                      result_locations[index]);
+  }
+
+  return exit_code;
+}
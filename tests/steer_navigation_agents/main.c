@@ -0,0 +1,263 @@
+#include "../../src/steer_navigation_agents.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_approximate(const char *const description_a,
+                              const char *const description_b,
+                              const float expected, const float actual) {
+  if (actual != actual || expected < actual - 0.0025f ||
+      expected > actual + 0.0025f) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_exit_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float agent_locations[] = {
+      0.5f, 0.5f, 2.0f, 0.3f, 0.5f, 0.0f, 1.2f, 0.45f, 0.0f, 0.7f, 0.55f, 0.0f,
+  };
+  const float agent_velocities[] = {
+      0.0f, 10.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+  };
+  const float agent_radii[] = {0.1f, 0.1f, 0.1f, 0.1f};
+  const int agent_face_indices[] = {3, 0, 1, 0};
+  int face_agent_offsets[5];
+  int face_agent_indices[4];
+  int face_search_marks[4];
+  int face_search_queue[4];
+  float result_agent_locations[12];
+  float result_agent_velocities[12];
+  int result_agent_face_indices[4];
+
+  steer_navigation_agents(
+      4, agent_locations, agent_velocities, agent_radii, agent_face_indices,
+      1.0f, 0.1f, 4, 4, face_vertex_counts, face_vertex_offsets,
+      face_vertex_locations, face_normals, edge_normals, edge_exit_normals,
+      edge_coefficients, face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, NULL, 0, 0, face_agent_offsets,
+      face_agent_indices, face_search_marks, face_search_queue,
+      result_agent_locations, result_agent_velocities,
+      result_agent_face_indices, 0, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  const int expected_face_agent_offsets[] = {0, 2, 3, 3, 4};
+
+  for (int index = 0; index < 5; index++) {
+    check_int("face agent offsets", "value", expected_face_agent_offsets[index],
+              face_agent_offsets[index]);
+  }
+
+  const int expected_face_agent_indices[] = {1, 3, 2, 0};
+
+  for (int index = 0; index < 4; index++) {
+    check_int("face agent indices", "value", expected_face_agent_indices[index],
+              face_agent_indices[index]);
+  }
+
+  const float expected_agent_locations[] = {
+      0.5f,   0.9999f, 2.0f, 0.4f, 0.4825f, 0.0f, 1.2f, 0.4425f, 0.0f, 0.6f,
+      0.575f, 0.0f,
+  };
+
+  for (int index = 0; index < 12; index++) {
+    check_approximate("result agent locations", "value",
+                      expected_agent_locations[index],
+                      result_agent_locations[index]);
+  }
+
+  const float expected_agent_velocities[] = {
+      0.0f,  4.999f, 0.0f, 1.0f, -0.175f, 0.0f, 0.0f, -0.075f, 0.0f, -1.0f,
+      0.25f, 0.0f,
+  };
+
+  for (int index = 0; index < 12; index++) {
+    check_approximate("result agent velocities", "value",
+                      expected_agent_velocities[index],
+                      result_agent_velocities[index]);
+  }
+
+  const int expected_agent_face_indices[] = {3, 0, 1, 0};
+
+  for (int index = 0; index < 4; index++) {
+    check_int("result agent face indices", "value",
+              expected_agent_face_indices[index],
+              result_agent_face_indices[index]);
+  }
+
+  const float crossing_agent_locations[] = {
+      0.9f, 0.5f, 0.0f, 0.5f, 0.9f, 0.0f, 1.5f, 0.5f, 2.0f,
+  };
+  const float crossing_agent_velocities[] = {
+      5.0f, 0.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  };
+  const int crossing_agent_face_indices[] = {0, 0, 3};
+  int event_count = 0;
+  int event_agent_indices[] = {-1, -1, -1};
+  int event_from_face_indices[] = {-1, -1, -1};
+  int event_to_face_indices[] = {-1, -1, -1};
+  int event_edge_indices[] = {-1, -1, -1};
+  float event_locations[] = {-1.0f, -1.0f, -1.0f, -1.0f, -1.0f,
+                             -1.0f, -1.0f, -1.0f, -1.0f};
+
+  steer_navigation_agents(
+      3, crossing_agent_locations, crossing_agent_velocities, agent_radii,
+      crossing_agent_face_indices, 1.0f, 0.1f, 4, 4, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals, edge_normals,
+      edge_exit_normals, edge_coefficients, face_edge_neighbor_counts,
+      face_edge_neighbor_offsets, face_edge_neighbor_face_indices, NULL, 0, 0,
+      face_agent_offsets, face_agent_indices, face_search_marks,
+      face_search_queue, result_agent_locations, result_agent_velocities,
+      result_agent_face_indices, 2, &event_count, event_agent_indices,
+      event_from_face_indices, event_to_face_indices, event_edge_indices,
+      event_locations);
+
+  check_int("event count", "value", 2, event_count);
+
+  const int expected_event_agent_indices[] = {0, 1, -1};
+  const int expected_event_from_face_indices[] = {0, 0, -1};
+  const int expected_event_to_face_indices[] = {1, 2, -1};
+  const int expected_event_edge_indices[] = {1, 2, -1};
+
+  for (int index = 0; index < 3; index++) {
+    check_int("event agent indices", "value",
+              expected_event_agent_indices[index], event_agent_indices[index]);
+    check_int("event from face indices", "value",
+              expected_event_from_face_indices[index],
+              event_from_face_indices[index]);
+    check_int("event to face indices", "value",
+              expected_event_to_face_indices[index],
+              event_to_face_indices[index]);
+    check_int("event edge indices", "value",
+              expected_event_edge_indices[index], event_edge_indices[index]);
+  }
+
+  const float expected_event_locations[] = {
+      1.0f, 0.5f, 0.0f, 0.5f, 1.0f, 0.0f, -1.0f, -1.0f, -1.0f,
+  };
+
+  for (int index = 0; index < 9; index++) {
+    check_approximate("event locations", "value",
+                      expected_event_locations[index], event_locations[index]);
+  }
+
+  const float head_on_agent_locations[] = {
+      0.3f, 0.5f, 0.0f, 0.7f, 0.5f, 0.0f,
+  };
+  const float head_on_agent_velocities[] = {
+      1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+  };
+  const int head_on_agent_face_indices[] = {0, 0};
+
+  steer_navigation_agents(
+      2, head_on_agent_locations, head_on_agent_velocities, agent_radii,
+      head_on_agent_face_indices, 1.0f, 0.1f, 4, 4, face_vertex_counts,
+      face_vertex_offsets, face_vertex_locations, face_normals, edge_normals,
+      edge_exit_normals, edge_coefficients, face_edge_neighbor_counts,
+      face_edge_neighbor_offsets, face_edge_neighbor_face_indices, NULL, 0, 0,
+      face_agent_offsets, face_agent_indices, face_search_marks,
+      face_search_queue, result_agent_locations, result_agent_velocities,
+      result_agent_face_indices, 0, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  const float expected_head_on_agent_velocities[] = {
+      1.0f, -0.3333f, 0.0f, -1.0f, 0.3333f, 0.0f,
+  };
+
+  for (int index = 0; index < 6; index++) {
+    check_approximate("head on agent velocities", "value",
+                      expected_head_on_agent_velocities[index],
+                      result_agent_velocities[index]);
+  }
+
+  const float distant_agent_locations[] = {
+      0.2f, 1.1f, 0.0f, 1.1f, 0.9f, 0.0f,
+  };
+  const float distant_agent_velocities[] = {
+      0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  };
+  const float distant_agent_radii[] = {0.5f, 0.5f};
+  const int distant_agent_face_indices[] = {2, 1};
+
+  steer_navigation_agents(
+      2, distant_agent_locations, distant_agent_velocities,
+      distant_agent_radii, distant_agent_face_indices, 1.0f, 0.1f, 4, 4,
+      face_vertex_counts, face_vertex_offsets, face_vertex_locations,
+      face_normals, edge_normals, edge_exit_normals, edge_coefficients,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, NULL, 0, 0, face_agent_offsets,
+      face_agent_indices, face_search_marks, face_search_queue,
+      result_agent_locations, result_agent_velocities,
+      result_agent_face_indices, 0, NULL, NULL, NULL, NULL, NULL, NULL);
+
+  const float expected_distant_agent_velocities[] = {
+      -0.3810f, 0.0847f, 0.0f, 0.3810f, -0.0847f, 0.0f,
+  };
+
+  for (int index = 0; index < 6; index++) {
+    check_approximate("distant agent velocities", "value",
+                      expected_distant_agent_velocities[index],
+                      result_agent_velocities[index]);
+  }
+
+  return exit_code;
+}
@@ -0,0 +1,180 @@
+#include "../../src/begin_navigation_path.h"
+#include "../../src/find_navigation_path.h"
+#include "../../src/finish_navigation_path.h"
+#include "../../src/navigation_path_status.h"
+#include "../../src/step_navigation_path.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int link_end_face_indices[] = {3, 3};
+
+static const float link_start_locations[] = {0.2f, 1.5f, 0.0f,
+                                             1.5f, 0.5f, 0.0f};
+
+static const float link_end_locations[] = {0.2f, 0.8f, 2.0f,
+                                           0.9f, 0.5f, 2.0f};
+
+static const float link_costs[] = {1.0f, 5.0f};
+
+static const int link_flags[] = {1, 2};
+
+static const int face_link_offsets[] = {0, 0, 1, 2, 2};
+
+static const int face_link_indices[] = {1, 0};
+
+static const int face_flags[] = {1, 1, 4, 1};
+
+static const float face_cost_multipliers[] = {10.0f, 1.0f, 1.0f, 1.0f};
+static void check(const char *const description,
+                  const float *const start_location, const int start_face_index,
+                  const float *const goal_location, const int goal_face_index,
+                  const int *const flags, const float *const cost_multipliers,
+                  const int *const offsets, const int include_flags,
+                  const int exclude_flags, const int maximum_iterations,
+                  const int expected_step_count,
+                  const int expected_iteration_count,
+                  const int expected_status) {
+  float face_costs[4];
+  float face_priorities[4];
+  float face_entry_locations[12];
+  int face_parent_indices[4];
+  int face_parent_link_indices[4];
+  int face_heap_positions[4];
+  int heap[4];
+  int expected_face_indices[] = {-1, -1, -1, -1, -1};
+  int expected_link_indices[] = {-1, -1, -1, -1, -1};
+
+  const int expected_result = find_navigation_path(
+      start_location, start_face_index, goal_location, goal_face_index, 4,
+      face_vertex_counts, face_vertex_offsets, face_vertex_locations,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, flags, cost_multipliers, offsets,
+      face_link_indices, link_end_face_indices, link_start_locations,
+      link_end_locations, link_costs, link_flags, include_flags,
+      exclude_flags, face_costs, face_priorities, face_entry_locations,
+      face_parent_indices, face_parent_link_indices, face_heap_positions, heap,
+      5, expected_face_indices, expected_link_indices);
+
+  int heap_count;
+  int iteration_count = 0;
+  int step_count = 0;
+  int status = NAVIGATION_PATH_STATUS_IN_PROGRESS;
+
+  begin_navigation_path(start_location, start_face_index, 4, face_costs,
+                        face_priorities, face_entry_locations,
+                        face_parent_indices, face_parent_link_indices,
+                        face_heap_positions, heap, &heap_count);
+
+  while (status == NAVIGATION_PATH_STATUS_IN_PROGRESS && step_count < 10) {
+    const int previous_iteration_count = iteration_count;
+
+    status = step_navigation_path(
+        goal_location, goal_face_index, face_vertex_counts,
+        face_vertex_offsets, face_vertex_locations, face_edge_neighbor_counts,
+        face_edge_neighbor_offsets, face_edge_neighbor_face_indices, flags,
+        cost_multipliers, offsets, face_link_indices, link_end_face_indices,
+        link_start_locations, link_end_locations, link_costs, link_flags,
+        include_flags, exclude_flags, face_costs, face_priorities,
+        face_entry_locations, face_parent_indices, face_parent_link_indices,
+        face_heap_positions, heap, &heap_count, maximum_iterations,
+        &iteration_count);
+
+    if (iteration_count - previous_iteration_count > maximum_iterations) {
+      printf("FAIL %s exceeded maximum iterations\n", description);
+      exit_code = 1;
+    }
+
+    step_count++;
+  }
+
+  check_int(description, "step count", expected_step_count, step_count);
+  check_int(description, "iteration count", expected_iteration_count,
+            iteration_count);
+  check_int(description, "status", expected_status, status);
+
+  int result_face_indices[] = {-1, -1, -1, -1, -1};
+  int result_link_indices[] = {-1, -1, -1, -1, -1};
+
+  check_int(description, "result", expected_result,
+            finish_navigation_path(goal_face_index, face_parent_indices,
+                                   face_parent_link_indices,
+                                   face_heap_positions, 5, result_face_indices,
+                                   result_link_indices));
+
+  for (int index = 0; index < 5; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int(description, "link index", expected_link_indices[index],
+              result_link_indices[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float ground_start[] = {1.5f, 0.5f, 0.0f};
+  const float upper_goal[] = {0.5f, 0.5f, 2.0f};
+  const float triangle_goal[] = {0.2f, 1.2f, 0.0f};
+
+  check("cheapest link one at a time", ground_start, 1, upper_goal, 3, NULL,
+        NULL, face_link_offsets, 3, 0, 1, 4, 4, NAVIGATION_PATH_STATUS_FOUND);
+
+  check("cheapest link two at a time", ground_start, 1, upper_goal, 3, NULL,
+        NULL, face_link_offsets, 3, 0, 2, 2, 4, NAVIGATION_PATH_STATUS_FOUND);
+
+  check("cheapest link all at once", ground_start, 1, upper_goal, 3, NULL,
+        NULL, face_link_offsets, 3, 0, 10, 1, 4, NAVIGATION_PATH_STATUS_FOUND);
+
+  check("excluded face", ground_start, 1, upper_goal, 3, face_flags, NULL,
+        face_link_offsets, 3, 4, 1, 3, 3, NAVIGATION_PATH_STATUS_FOUND);
+
+  check("expensive face", ground_start, 1, upper_goal, 3, NULL,
+        face_cost_multipliers, face_link_offsets, 3, 0, 1, 3, 3,
+        NAVIGATION_PATH_STATUS_FOUND);
+
+  check("links ignored one at a time", ground_start, 1, upper_goal, 3, NULL,
+        NULL, NULL, 3, 0, 1, 3, 3, NAVIGATION_PATH_STATUS_NOT_FOUND);
+
+  check("links ignored all at once", ground_start, 1, upper_goal, 3, NULL,
+        NULL, NULL, 3, 0, 10, 1, 3, NAVIGATION_PATH_STATUS_NOT_FOUND);
+
+  check("two edges", ground_start, 1, triangle_goal, 2, NULL, NULL, NULL, 0,
+        0, 1, 3, 3, NAVIGATION_PATH_STATUS_FOUND);
+
+  check("same face", triangle_goal, 2, triangle_goal, 2, NULL, NULL, NULL, 0,
+        0, 1, 1, 1, NAVIGATION_PATH_STATUS_FOUND);
+
+  return exit_code;
+}
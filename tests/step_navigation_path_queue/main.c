@@ -0,0 +1,167 @@
+#include "../../src/begin_navigation_path.h"
+#include "../../src/finish_navigation_path.h"
+#include "../../src/navigation_path_status.h"
+#include "../../src/step_navigation_path_queue.h"
+#include <stddef.h>
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const int face_edge_neighbor_counts[] = {0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                0, 0, 0, 0};
+
+static const int face_edge_neighbor_offsets[] = {0, 0, 1, 2, 2, 2, 2, 2, 3, 4,
+                                                 4, 4, 4, 4, 4};
+
+static const int face_edge_neighbor_face_indices[] = {1, 2, 0, 0};
+
+static const int link_end_face_indices[] = {3, 3};
+
+static const float link_start_locations[] = {0.2f, 1.5f, 0.0f,
+                                             1.5f, 0.5f, 0.0f};
+
+static const float link_end_locations[] = {0.2f, 0.8f, 2.0f,
+                                           0.9f, 0.5f, 2.0f};
+
+static const float link_costs[] = {1.0f, 5.0f};
+
+static const int link_flags[] = {1, 2};
+
+static const int face_link_offsets[] = {0, 0, 1, 2, 2};
+
+static const int face_link_indices[] = {1, 0};
+
+static const float request_start_locations[] = {
+    1.5f, 0.5f, 0.0f, 1.5f, 0.5f, 0.0f, 1.5f, 0.5f, 0.0f,
+};
+
+static const int request_start_face_indices[] = {1, 1, 1};
+
+static const float request_priorities[] = {1.0f, 5.0f, 100.0f};
+
+static const float request_goal_locations[] = {
+    0.5f, 0.5f, 2.0f, 0.2f, 1.2f, 0.0f, 0.5f, 0.5f, 0.0f,
+};
+
+static const int request_goal_face_indices[] = {3, 2, 0};
+
+static float face_costs[12];
+static float face_priorities[12];
+static float face_entry_locations[36];
+static int face_parent_indices[12];
+static int face_parent_link_indices[12];
+static int face_heap_positions[12];
+static int heaps[12];
+static int request_heap_counts[3];
+static int request_statuses[3];
+
+static int step(const int iteration_budget) {
+  return step_navigation_path_queue(
+      3, request_priorities, request_goal_locations, request_goal_face_indices,
+      4, face_vertex_counts, face_vertex_offsets, face_vertex_locations,
+      face_edge_neighbor_counts, face_edge_neighbor_offsets,
+      face_edge_neighbor_face_indices, NULL, NULL, face_link_offsets,
+      face_link_indices, link_end_face_indices, link_start_locations,
+      link_end_locations, link_costs, link_flags, 3, 0, face_costs,
+      face_priorities, face_entry_locations, face_parent_indices,
+      face_parent_link_indices, face_heap_positions, heaps,
+      request_heap_counts, iteration_budget, request_statuses);
+}
+
+static void check_path(const char *const description, const int request_index,
+                       const int expected_result,
+                       const int *const expected_face_indices,
+                       const int *const expected_link_indices) {
+  int result_face_indices[] = {-1, -1, -1, -1, -1};
+  int result_link_indices[] = {-1, -1, -1, -1, -1};
+
+  check_int(description, "result", expected_result,
+            finish_navigation_path(
+                request_goal_face_indices[request_index],
+                face_parent_indices + request_index * 4,
+                face_parent_link_indices + request_index * 4,
+                face_heap_positions + request_index * 4, 5,
+                result_face_indices, result_link_indices));
+
+  for (int index = 0; index < 5; index++) {
+    check_int(description, "face index", expected_face_indices[index],
+              result_face_indices[index]);
+    check_int(description, "link index", expected_link_indices[index],
+              result_link_indices[index]);
+  }
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  for (int request_index = 0; request_index < 2; request_index++) {
+    begin_navigation_path(
+        request_start_locations + request_index * 3,
+        request_start_face_indices[request_index], 4,
+        face_costs + request_index * 4, face_priorities + request_index * 4,
+        face_entry_locations + request_index * 12,
+        face_parent_indices + request_index * 4,
+        face_parent_link_indices + request_index * 4,
+        face_heap_positions + request_index * 4, heaps + request_index * 4,
+        request_heap_counts + request_index);
+    request_statuses[request_index] = NAVIGATION_PATH_STATUS_IN_PROGRESS;
+  }
+
+  request_statuses[2] = NAVIGATION_PATH_STATUS_NOT_FOUND;
+
+  check_int("first frame", "iterations", 4, step(4));
+  check_int("first frame", "low priority status",
+            NAVIGATION_PATH_STATUS_IN_PROGRESS, request_statuses[0]);
+  check_int("first frame", "high priority status",
+            NAVIGATION_PATH_STATUS_FOUND, request_statuses[1]);
+  check_int("first frame", "unused status", NAVIGATION_PATH_STATUS_NOT_FOUND,
+            request_statuses[2]);
+
+  check_int("second frame", "iterations", 3, step(10));
+  check_int("second frame", "low priority status",
+            NAVIGATION_PATH_STATUS_FOUND, request_statuses[0]);
+  check_int("second frame", "high priority status",
+            NAVIGATION_PATH_STATUS_FOUND, request_statuses[1]);
+  check_int("second frame", "unused status", NAVIGATION_PATH_STATUS_NOT_FOUND,
+            request_statuses[2]);
+
+  check_int("idle frame", "iterations", 0, step(10));
+
+  {
+    const int expected_face_indices[] = {1, 0, 2, 3, -1};
+    const int expected_link_indices[] = {-1, -1, -1, 0, -1};
+    check_path("low priority", 0, 4, expected_face_indices,
+               expected_link_indices);
+  }
+
+  {
+    const int expected_face_indices[] = {1, 0, 2, -1, -1};
+    const int expected_link_indices[] = {-1, -1, -1, -1, -1};
+    check_path("high priority", 1, 3, expected_face_indices,
+               expected_link_indices);
+  }
+
+  return exit_code;
+}
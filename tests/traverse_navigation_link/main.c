@@ -0,0 +1,73 @@
+#include "../../src/traverse_navigation_link.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_exact(const char *const description_a,
+                        const char *const description_b, const float expected,
+                        const float actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %f actual %f\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int link_start_face_indices[] = {2, 1};
+
+static const int link_end_face_indices[] = {3, 3};
+
+static const float link_start_locations[] = {0.2f, 1.5f, 0.0f,
+                                             1.5f, 0.5f, 0.0f};
+
+static const float link_end_locations[] = {0.2f, 0.8f, 2.0f,
+                                           0.9f, 0.5f, 2.0f};
+
+static void check(const char *const description, const float *const location,
+                  const int face_index, const int link_index,
+                  const int expected_result,
+                  const float *const expected_location,
+                  const int expected_face_index) {
+  float result_location[] = {-1.0f, -1.0f, -1.0f};
+  int result_face_index = -1;
+
+  check_int(description, "result", expected_result,
+            traverse_navigation_link(location, face_index, link_index, 0.25f,
+                                     link_start_face_indices,
+                                     link_start_locations,
+                                     link_end_face_indices,
+                                     link_end_locations, result_location,
+                                     &result_face_index));
+
+  check_exact(description, "location x", expected_location[0],
+              result_location[0]);
+  check_exact(description, "location y", expected_location[1],
+              result_location[1]);
+  check_exact(description, "location z", expected_location[2],
+              result_location[2]);
+  check_int(description, "face index", expected_face_index, result_face_index);
+}
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  const float at_start[] = {0.3f, 1.4f, 0.0f};
+  const float out_of_reach[] = {0.2f, 1.2f, 0.0f};
+
+  check("in reach", at_start, 2, 0, 1, link_end_locations, 3);
+  check("out of reach", out_of_reach, 2, 0, 0, out_of_reach, 2);
+  check("wrong face", at_start, 0, 0, 0, at_start, 0);
+
+  return exit_code;
+}
@@ -0,0 +1,172 @@
+#include "../../src/validate_navigation_mesh.h"
+#include <stdio.h>
+
+static int exit_code = 0;
+
+static void check_int(const char *const description_a,
+                      const char *const description_b, const int expected,
+                      const int actual) {
+  if (actual != expected) {
+    printf("FAIL %s %s expected %d actual %d\n", description_a, description_b,
+           expected, actual);
+    exit_code = 1;
+  }
+}
+
+static const int face_vertex_counts[] = {4, 4, 3, 4};
+
+static const int face_vertex_offsets[] = {0, 4, 8, 11};
+
+static const float face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f,
+};
+
+static const float face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float edge_normals[] = {
+    0.0f,        -1.0f,       0.0f, 1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,
+    -1.0f,       0.0f,        0.0f, 0.0f,  -1.0f, 0.0f, 1.0f,  0.0f,  0.0f,
+    0.0f,        1.0f,        0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    0.70710678f, 0.70710678f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f,  -1.0f, 0.0f,
+    1.0f,        0.0f,        0.0f, 0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,
+};
+
+static const float edge_coefficients[] = {
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 0.0f,  1.0f, 0.0f, -1.0f, 0.0f,  0.0f, 0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, -0.5f, 0.5f, 0.0f, 0.0f,  -1.0f, 0.0f, 1.0f, 0.0f,  0.0f,
+    0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f,  -1.0f, 0.0f,
+};
+
+static const int invalid_face_vertex_counts[] = {4, 4, 3, 4, 2, 4};
+
+static const int invalid_face_vertex_offsets[] = {0, 4, 8, 11, 15, 17};
+
+static const float invalid_face_vertex_locations[] = {
+    0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    1.0f, 0.0f, 2.0f, 1.0f, 1.0f, 2.5f, 0.0f, 1.0f, 2.0f, 5.0f, 5.0f, 0.0f,
+    6.0f, 5.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 0.5f, 0.0f,
+    1.0f, 2.0f, 0.0f,
+};
+
+static const float invalid_face_normals[] = {
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+    0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+
+static const float invalid_edge_normals[] = {
+    0.0f,       1.0f, 0.0f,  1.0f,  0.0f,        0.0f,       0.0f,
+    1.0f,       0.0f, -2.0f, 0.0f,  0.0f,        0.0f,       -0.6f,
+    0.8f,       1.0f, 0.0f,  0.0f,  0.0f,        1.0f,       0.0f,
+    -1.0f,      0.0f, 0.0f,  0.0f,  -1.0f,       0.0f,       0.7071068f,
+    0.7071068f, 0.0f, -1.0f, 0.0f,  0.0f,        0.0f,       -1.0f,
+    0.0f,       1.0f, 0.0f,  0.0f,  0.0f,        1.0f,       0.0f,
+    -1.0f,      0.0f, 0.0f,  0.0f,  -1.0f,       0.0f,       0.0f,
+    1.0f,       0.0f, 0.0f,  -1.0f, 0.0f,        0.4472136f, 0.8944272f,
+    0.0f,       1.0f, 0.0f,  0.0f,  -0.8944272f, 0.4472136f, 0.0f,
+};
+
+static const float invalid_edge_coefficients[] = {
+    1.0f,  0.0f,  0.0f,  0.0f,  1.0f,  0.0f, -1.0f, 0.0f,  0.0f,       0.0f,
+    -1.0f, 0.0f,  1.0f,  0.0f,  0.0f,  0.0f, 1.0f,  0.0f,  -1.0f,      0.0f,
+    0.0f,  0.0f,  -1.0f, 0.0f,  1.0f,  0.0f, 0.0f,  -1.0f, 1.0f,       0.0f,
+    0.0f,  -1.0f, 0.0f,  1.0f,  0.0f,  0.0f, 0.0f,  1.0f,  0.0f,       -1.0f,
+    0.0f,  0.0f,  0.0f,  -1.0f, 0.0f,  1.0f, 0.0f,  0.0f,  -1.0f,      0.0f,
+    0.0f,  0.5f,  0.0f,  0.0f,  -0.8f, 0.4f, 0.0f,  0.0f,  0.6666667f, 0.0f,
+    -0.2f, -0.4f, 0.0f,
+};
+
+int main(const int argc, const char *const *const argv) {
+  (void)(argc);
+  (void)(argv);
+
+  {
+    int result_violation_types[] = {-1};
+    int result_violation_face_indices[] = {-1};
+    int result_violation_edge_indices[] = {-1};
+
+    check_int("valid", "count", 0,
+              validate_navigation_mesh(
+                  4, face_vertex_counts, face_vertex_offsets,
+                  face_vertex_locations, face_normals, edge_normals,
+                  edge_coefficients, 0.001f, 1, result_violation_types,
+                  result_violation_face_indices,
+                  result_violation_edge_indices));
+
+    check_int("valid", "type", -1, result_violation_types[0]);
+    check_int("valid", "face index", -1, result_violation_face_indices[0]);
+    check_int("valid", "edge index", -1, result_violation_edge_indices[0]);
+  }
+
+  const int expected_violation_types[] = {5, 3, 1, 4, 6, 6, 2, 6, 0, 7};
+  const int expected_violation_face_indices[] = {0, 0, 1, 1, 2, 3, 3, 3, 4, 5};
+  const int expected_violation_edge_indices[] = {0, 3, -1, 0, 1, 1, 2, 2, -1,
+                                                 1};
+
+  {
+    int result_violation_types[11];
+    int result_violation_face_indices[11];
+    int result_violation_edge_indices[11];
+
+    for (int index = 0; index < 11; index++) {
+      result_violation_types[index] = -1;
+      result_violation_face_indices[index] = -1;
+      result_violation_edge_indices[index] = -1;
+    }
+
+    check_int("invalid", "count", 10,
+              validate_navigation_mesh(
+                  6, invalid_face_vertex_counts, invalid_face_vertex_offsets,
+                  invalid_face_vertex_locations, invalid_face_normals,
+                  invalid_edge_normals, invalid_edge_coefficients, 0.001f, 11,
+                  result_violation_types, result_violation_face_indices,
+                  result_violation_edge_indices));
+
+    for (int index = 0; index < 11; index++) {
+      check_int("invalid", "type",
+                index < 10 ? expected_violation_types[index] : -1,
+                result_violation_types[index]);
+      check_int("invalid", "face index",
+                index < 10 ? expected_violation_face_indices[index] : -1,
+                result_violation_face_indices[index]);
+      check_int("invalid", "edge index",
+                index < 10 ? expected_violation_edge_indices[index] : -1,
+                result_violation_edge_indices[index]);
+    }
+  }
+
+  {
+    int result_violation_types[] = {-1, -1, -1, -1};
+    int result_violation_face_indices[] = {-1, -1, -1, -1};
+    int result_violation_edge_indices[] = {-1, -1, -1, -1};
+
+    check_int("truncated", "count", 10,
+              validate_navigation_mesh(
+                  6, invalid_face_vertex_counts, invalid_face_vertex_offsets,
+                  invalid_face_vertex_locations, invalid_face_normals,
+                  invalid_edge_normals, invalid_edge_coefficients, 0.001f, 3,
+                  result_violation_types, result_violation_face_indices,
+                  result_violation_edge_indices));
+
+    for (int index = 0; index < 4; index++) {
+      check_int("truncated", "type",
+                index < 3 ? expected_violation_types[index] : -1,
+                result_violation_types[index]);
+      check_int("truncated", "face index",
+                index < 3 ? expected_violation_face_indices[index] : -1,
+                result_violation_face_indices[index]);
+      check_int("truncated", "edge index",
+                index < 3 ? expected_violation_edge_indices[index] : -1,
+                result_violation_edge_indices[index]);
+    }
+  }
+
+  return exit_code;
+}
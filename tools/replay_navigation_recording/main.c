@@ -0,0 +1,473 @@
+#include "../../src/closest_navigable_face.h"
+#include "../../src/constrain_to_navigable_surface.h"
+#include "../../src/constrain_to_navigable_volume.h"
+#include "../../src/navigation_recording.h"
+#include "../../src/sliding_navigation_collision.h"
+#include "../../src/sliding_navigation_collision_result.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TYPE_COUNT 4
+#define MINIMUM_TIMED_CALLS 1048576
+#define MAXIMUM_REPORTED_DIFFERENCES 10
+
+typedef struct {
+  int face_count;
+  int *face_vertex_counts;
+  int *face_vertex_offsets;
+  int *face_flags;
+  float *face_normals;
+  float *face_vertex_locations;
+  float *edge_normals;
+  float *edge_exit_normals;
+  float *edge_coefficients;
+  float *vertex_up_normals;
+  int *face_edge_neighbor_counts;
+} replay_mesh;
+
+static const char *const type_names[TYPE_COUNT] = {
+    "closest_navigable_face",
+    "constrain_to_navigable_surface",
+    "constrain_to_navigable_volume",
+    "sliding_navigation_collision",
+};
+
+static const int type_sizes[TYPE_COUNT] = {
+    NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE_SIZE,
+    NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_SURFACE_SIZE,
+    NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME_SIZE,
+    NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION_SIZE,
+};
+
+static volatile float sink;
+
+static float read_float(const unsigned char *const bytes) {
+  float value;
+  memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+static int read_int(const unsigned char *const bytes) {
+  int value;
+  memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+static void read_vector(const unsigned char *const bytes,
+                        float *const vector) {
+  vector[0] = read_float(bytes);
+  vector[1] = read_float(bytes + 4);
+  vector[2] = read_float(bytes + 8);
+}
+
+static int differs(const float expected, const float actual,
+                   const float tolerance) {
+  return actual != actual || expected < actual - tolerance ||
+         expected > actual + tolerance;
+}
+
+static int read_values(FILE *const file, const char *const format,
+                       void *const values, const int size, const int count) {
+  for (int index = 0; index < count; index++) {
+    if (fscanf(file, format, (char *)values + index * size) != 1) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static void free_mesh(replay_mesh *const mesh) {
+  free(mesh->face_vertex_counts);
+  free(mesh->face_vertex_offsets);
+  free(mesh->face_flags);
+  free(mesh->face_normals);
+  free(mesh->face_vertex_locations);
+  free(mesh->edge_normals);
+  free(mesh->edge_exit_normals);
+  free(mesh->edge_coefficients);
+  free(mesh->vertex_up_normals);
+  free(mesh->face_edge_neighbor_counts);
+}
+
+static int read_mesh(const char *const path, replay_mesh *const mesh) {
+  FILE *const file = fopen(path, "r");
+
+  if (file == NULL) {
+    return 0;
+  }
+
+  int output = 0;
+
+  if (!read_values(file, "%d", &mesh->face_count, sizeof(int), 1) ||
+      mesh->face_count <= 0) {
+    goto cleanup;
+  }
+
+  mesh->face_vertex_counts = malloc(sizeof(int) * mesh->face_count);
+  mesh->face_vertex_offsets = malloc(sizeof(int) * mesh->face_count);
+  mesh->face_flags = malloc(sizeof(int) * mesh->face_count);
+  mesh->face_normals = malloc(sizeof(float) * mesh->face_count * 3);
+
+  if (mesh->face_vertex_counts == NULL || mesh->face_vertex_offsets == NULL ||
+      mesh->face_flags == NULL || mesh->face_normals == NULL) {
+    goto cleanup;
+  }
+
+  const long start = ftell(file);
+  int vertex_count = 0;
+
+  for (int face_index = 0; face_index < mesh->face_count; face_index++) {
+    float ignored[16];
+
+    if (!read_values(file, "%d", mesh->face_vertex_counts + face_index,
+                     sizeof(int), 1) ||
+        mesh->face_vertex_counts[face_index] < 3 ||
+        !read_values(file, "%d", mesh->face_flags + face_index, sizeof(int),
+                     1) ||
+        !read_values(file, "%f", mesh->face_normals + face_index * 3,
+                     sizeof(float), 3)) {
+      goto cleanup;
+    }
+
+    mesh->face_vertex_offsets[face_index] = vertex_count;
+
+    for (int vertex_index = 0;
+         vertex_index < mesh->face_vertex_counts[face_index]; vertex_index++) {
+      if (!read_values(file, "%f", ignored, sizeof(float), 16)) {
+        goto cleanup;
+      }
+    }
+
+    vertex_count += mesh->face_vertex_counts[face_index];
+  }
+
+  mesh->face_vertex_locations = malloc(sizeof(float) * vertex_count * 3);
+  mesh->edge_normals = malloc(sizeof(float) * vertex_count * 3);
+  mesh->edge_exit_normals = malloc(sizeof(float) * vertex_count * 3);
+  mesh->edge_coefficients = malloc(sizeof(float) * vertex_count * 3);
+  mesh->vertex_up_normals = malloc(sizeof(float) * vertex_count * 3);
+  mesh->face_edge_neighbor_counts = malloc(sizeof(int) * vertex_count);
+
+  if (mesh->face_vertex_locations == NULL || mesh->edge_normals == NULL ||
+      mesh->edge_exit_normals == NULL || mesh->edge_coefficients == NULL ||
+      mesh->vertex_up_normals == NULL ||
+      mesh->face_edge_neighbor_counts == NULL ||
+      fseek(file, start, SEEK_SET) != 0) {
+    goto cleanup;
+  }
+
+  for (int face_index = 0; face_index < mesh->face_count; face_index++) {
+    int header[2];
+    float normal[3];
+
+    if (!read_values(file, "%d", header, sizeof(int), 2) ||
+        !read_values(file, "%f", normal, sizeof(float), 3)) {
+      goto cleanup;
+    }
+
+    const int offset = mesh->face_vertex_offsets[face_index];
+
+    for (int vertex_index = offset;
+         vertex_index < offset + mesh->face_vertex_counts[face_index];
+         vertex_index++) {
+      if (!read_values(file, "%f",
+                       mesh->face_vertex_locations + vertex_index * 3,
+                       sizeof(float), 3) ||
+          !read_values(file, "%f", mesh->edge_normals + vertex_index * 3,
+                       sizeof(float), 3) ||
+          !read_values(file, "%f", mesh->edge_exit_normals + vertex_index * 3,
+                       sizeof(float), 3) ||
+          !read_values(file, "%f", mesh->edge_coefficients + vertex_index * 3,
+                       sizeof(float), 3) ||
+          !read_values(file, "%f", mesh->vertex_up_normals + vertex_index * 3,
+                       sizeof(float), 3) ||
+          !read_values(file, "%d",
+                       mesh->face_edge_neighbor_counts + vertex_index,
+                       sizeof(int), 1)) {
+        goto cleanup;
+      }
+    }
+  }
+
+  output = 1;
+
+cleanup:
+  fclose(file);
+  return output;
+}
+
+static unsigned char *read_recording(const char *const path,
+                                     long *const length) {
+  FILE *const file = fopen(path, "rb");
+
+  if (file == NULL) {
+    return NULL;
+  }
+
+  unsigned char *output = NULL;
+
+  if (fseek(file, 0, SEEK_END) == 0) {
+    *length = ftell(file);
+
+    if (*length >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+      output = malloc(*length > 0 ? (size_t)*length : 1);
+
+      if (output != NULL &&
+          fread(output, 1, (size_t)*length, file) != (size_t)*length) {
+        free(output);
+        output = NULL;
+      }
+    }
+  }
+
+  fclose(file);
+  return output;
+}
+
+static int replay_record(const replay_mesh *const mesh,
+                         const unsigned char *const record,
+                         const float tolerance, const long record_index,
+                         const int check, const int report) {
+  int output = 0;
+
+  switch (record[0]) {
+  case NAVIGATION_RECORDING_CLOSEST_NAVIGABLE_FACE: {
+    float location[3];
+    read_vector(record + 1, location);
+
+    const int face_count = read_int(record + 13);
+    const int expected = read_int(record + 26);
+
+    const int actual = closest_navigable_face(
+        location,
+        face_count > mesh->face_count ? mesh->face_count : face_count,
+        mesh->face_vertex_counts, mesh->face_vertex_offsets,
+        mesh->face_vertex_locations, mesh->face_normals, mesh->edge_normals,
+        mesh->edge_coefficients, record[17] ? mesh->face_flags : NULL,
+        read_int(record + 18), read_int(record + 22));
+
+    if (check && actual != expected) {
+      if (report) {
+        printf("Record %ld (%s): expected face %d, actual face %d.\n",
+               record_index, type_names[record[0]], expected, actual);
+      }
+
+      output = 1;
+    }
+
+    sink = (float)actual;
+    break;
+  }
+
+  case NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_SURFACE:
+  case NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_VOLUME: {
+    float location[3];
+    float expected[3];
+    float actual[3];
+    read_vector(record + 1, location);
+    read_vector(record + 17, expected);
+
+    int face_index = read_int(record + 13);
+
+    if (face_index < 0 || face_index >= mesh->face_count) {
+      face_index = 0;
+    }
+
+    if (record[0] == NAVIGATION_RECORDING_CONSTRAIN_TO_NAVIGABLE_SURFACE) {
+      constrain_to_navigable_surface(
+          location, mesh->face_vertex_counts, mesh->face_vertex_offsets,
+          mesh->face_vertex_locations, mesh->face_normals, mesh->edge_normals,
+          mesh->edge_coefficients, face_index, actual);
+    } else {
+      constrain_to_navigable_volume(
+          location, mesh->face_vertex_counts, mesh->face_vertex_offsets,
+          mesh->face_vertex_locations, mesh->face_normals,
+          mesh->edge_exit_normals, mesh->edge_normals,
+          mesh->edge_coefficients, mesh->vertex_up_normals, face_index,
+          actual);
+    }
+
+    if (check && (differs(expected[0], actual[0], tolerance) ||
+                  differs(expected[1], actual[1], tolerance) ||
+                  differs(expected[2], actual[2], tolerance))) {
+      if (report) {
+        printf("Record %ld (%s): expected %f %f %f, actual %f %f %f.\n",
+               record_index, type_names[record[0]], expected[0], expected[1],
+               expected[2], actual[0], actual[1], actual[2]);
+      }
+
+      output = 1;
+    }
+
+    sink = actual[0];
+    break;
+  }
+
+  case NAVIGATION_RECORDING_SLIDING_NAVIGATION_COLLISION: {
+    float from[3];
+    float to[3];
+    float expected_from[3];
+    float expected_to[3];
+    float actual_from[3];
+    float actual_to[3];
+    int actual_edge_index = -1;
+    read_vector(record + 1, from);
+    read_vector(record + 17, to);
+    read_vector(record + 33, expected_from);
+    read_vector(record + 45, expected_to);
+
+    int face_index = read_int(record + 13);
+
+    if (face_index < 0 || face_index >= mesh->face_count) {
+      face_index = 0;
+    }
+
+    const int expected_result = read_int(record + 29);
+    const int expected_edge_index = read_int(record + 57);
+
+    const int actual_result = sliding_navigation_collision(
+        from, face_index, to, mesh->face_vertex_counts,
+        mesh->face_vertex_offsets, mesh->face_vertex_locations,
+        mesh->face_normals, mesh->edge_exit_normals,
+        mesh->face_edge_neighbor_counts, actual_from, actual_to,
+        &actual_edge_index);
+
+    if (actual_result != SLIDING_NAVIGATION_COLLISION_RESULT_EDGE) {
+      actual_edge_index = -1;
+    }
+
+    if (check &&
+        (actual_result != expected_result ||
+         actual_edge_index != expected_edge_index ||
+         differs(expected_from[0], actual_from[0], tolerance) ||
+         differs(expected_from[1], actual_from[1], tolerance) ||
+         differs(expected_from[2], actual_from[2], tolerance) ||
+         differs(expected_to[0], actual_to[0], tolerance) ||
+         differs(expected_to[1], actual_to[1], tolerance) ||
+         differs(expected_to[2], actual_to[2], tolerance))) {
+      if (report) {
+        printf("Record %ld (%s): expected result %d edge %d from %f %f %f "
+               "to %f %f %f, actual result %d edge %d from %f %f %f to %f "
+               "%f %f.\n",
+               record_index, type_names[record[0]], expected_result,
+               expected_edge_index, expected_from[0], expected_from[1],
+               expected_from[2], expected_to[0], expected_to[1],
+               expected_to[2], actual_result, actual_edge_index,
+               actual_from[0], actual_from[1], actual_from[2], actual_to[0],
+               actual_to[1], actual_to[2]);
+      }
+
+      output = 1;
+    }
+
+    sink = actual_to[0];
+    break;
+  }
+  }
+
+  return output;
+}
+
+int main(const int argc, const char *const *const argv) {
+  if (argc < 3 || argc > 4) {
+    fprintf(stderr, "Usage: %s mesh.txt recording.bin [tolerance]\n",
+            argv[0]);
+    return 1;
+  }
+
+  const float tolerance = argc == 4 ? (float)atof(argv[3]) : 0.0f;
+
+  replay_mesh mesh;
+  memset(&mesh, 0, sizeof(mesh));
+
+  if (!read_mesh(argv[1], &mesh)) {
+    fprintf(stderr, "Unable to read mesh \"%s\".\n", argv[1]);
+    free_mesh(&mesh);
+    return 1;
+  }
+
+  long length = 0;
+  unsigned char *const recording = read_recording(argv[2], &length);
+
+  if (recording == NULL) {
+    fprintf(stderr, "Unable to read recording \"%s\".\n", argv[2]);
+    free_mesh(&mesh);
+    return 1;
+  }
+
+  long counts[TYPE_COUNT] = {0, 0, 0, 0};
+  long differences = 0;
+  long record_count = 0;
+  long offset = 0;
+  int output = 0;
+
+  while (offset < length) {
+    const int type = recording[offset];
+
+    if (type >= TYPE_COUNT || offset + type_sizes[type] > length) {
+      fprintf(stderr, "Recording \"%s\" is malformed at byte %ld.\n",
+              argv[2], offset);
+      output = 1;
+      break;
+    }
+
+    const int report = differences < MAXIMUM_REPORTED_DIFFERENCES;
+
+    if (replay_record(&mesh, recording + offset, tolerance, record_count, 1,
+                      report) != 0) {
+      differences++;
+
+      if (report && differences == MAXIMUM_REPORTED_DIFFERENCES) {
+        printf("Further differences are counted but not reported.\n");
+      }
+    }
+
+    counts[type]++;
+    record_count++;
+    offset += type_sizes[type];
+  }
+
+  for (int type = 0; type < TYPE_COUNT; type++) {
+    if (counts[type] == 0) {
+      continue;
+    }
+
+    const long repetitions = counts[type] >= MINIMUM_TIMED_CALLS
+                                 ? 1
+                                 : MINIMUM_TIMED_CALLS / counts[type] + 1;
+    long calls = 0;
+    const clock_t start = clock();
+
+    for (long repetition = 0; repetition < repetitions; repetition++) {
+      for (long record_offset = 0; record_offset < offset;) {
+        const int record_type = recording[record_offset];
+
+        if (record_type == type) {
+          replay_record(&mesh, recording + record_offset, tolerance, 0, 0, 0);
+          calls++;
+        }
+
+        record_offset += type_sizes[record_type];
+      }
+    }
+
+    const clock_t end = clock();
+
+    printf("%-32s %10ld records %9.2f ns/call\n", type_names[type],
+           counts[type],
+           (double)(end - start) * 1.0e9 / CLOCKS_PER_SEC / calls);
+  }
+
+  printf("%ld records, %ld differences.\n", record_count, differences);
+
+  if (differences > 0) {
+    output = 1;
+  }
+
+  free(recording);
+  free_mesh(&mesh);
+  return output;
+}